@@ -102,6 +102,7 @@ enum class StatusCode {
   kInsufficientMemoryY       = -1007, // Vector Y's OpenCL buffer is too small
 
   // Custom additional status codes for CLBlast
+  kInvalidPackedMatrix       = -2051, // Packed matrix is invalid or does not match the arguments
   kInsufficientMemoryTemp    = -2050, // Temporary buffer provided to GEMM routine is too small
   kInvalidBatchCount         = -2049, // The batch count needs to be positive
   kInvalidOverrideKernel     = -2048, // Trying to override parameters for an invalid kernel
@@ -626,6 +627,52 @@ StatusCode Had(const size_t n,
                cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
                cl_command_queue* queue, cl_event* event = nullptr);
 
+// Vector-times-constant plus scaled vector: SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+template <typename T>
+StatusCode Axpby(const size_t n,
+                 const T alpha,
+                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta,
+                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// Sets all elements of a vector to a constant: SSET/DSET/CSET/ZSET/HSET
+template <typename T>
+StatusCode Set(const size_t n,
+               const T alpha,
+               cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_command_queue* queue, cl_event* event = nullptr);
+
+// Two fused vector-times-constant plus vector operations: SAXPY2/DAXPY2/CAXPY2/ZAXPY2/HAXPY2
+template <typename T>
+StatusCode Axpy2(const size_t n,
+                 const T alpha,
+                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                 const T beta,
+                 const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                 cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// Fused vector update and dot product: SAXPYDOT/DAXPYDOT/HAXPYDOT
+template <typename T>
+StatusCode Axpydot(const size_t n,
+                   cl_mem dot_buffer, const size_t dot_offset,
+                   const T alpha,
+                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                   const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                   cl_command_queue* queue, cl_event* event = nullptr);
+
+// Fused vector update and Euclidian norm: SAXPYNRM2/DAXPYNRM2/CAXPYNRM2/ZAXPYNRM2/HAXPYNRM2
+template <typename T>
+StatusCode Axpynrm2(const size_t n,
+                    cl_mem nrm2_buffer, const size_t nrm2_offset,
+                    const T alpha,
+                    const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                    cl_command_queue* queue, cl_event* event = nullptr);
+
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 template <typename T>
 StatusCode Omatcopy(const Layout layout, const Transpose a_transpose,
@@ -669,6 +716,24 @@ StatusCode AxpyBatched(const size_t n,
                        const size_t batch_count,
                        cl_command_queue* queue, cl_event* event = nullptr);
 
+// Batched version of AXPBY: SAXPBYBATCHED/DAXPBYBATCHED/CAXPBYBATCHED/ZAXPBYBATCHED/HAXPBYBATCHED
+template <typename T>
+StatusCode AxpbyBatched(const size_t n,
+                        const T *alphas,
+                        const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                        const T *betas,
+                        cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                        const size_t batch_count,
+                        cl_command_queue* queue, cl_event* event = nullptr);
+
+// Batched version of SET: SSETBATCHED/DSETBATCHED/CSETBATCHED/ZSETBATCHED/HSETBATCHED
+template <typename T>
+StatusCode SetBatched(const size_t n,
+                      const T *alphas,
+                      cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                      const size_t batch_count,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
 // Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
 template <typename T>
 StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
@@ -693,6 +758,265 @@ StatusCode GemmStridedBatched(const Layout layout, const Transpose a_transpose,
                               const size_t batch_count,
                               cl_command_queue* queue, cl_event* event = nullptr);
 
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+template <typename T>
+StatusCode GemvBatched(const Layout layout, const Transpose a_transpose,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const T *betas,
+                       cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
+// StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+template <typename T>
+StatusCode GemvStridedBatched(const Layout layout, const Transpose a_transpose,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const T beta,
+                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+
+// Batched version of DOT: SDOTBATCHED/DDOTBATCHED/HDOTBATCHED
+template <typename T>
+StatusCode DotBatched(const size_t n,
+                      cl_mem dot_buffer, const size_t *dot_offsets,
+                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                      const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                      const size_t batch_count,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
+// StridedBatched version of DOT: SDOTSTRIDEDBATCHED/DDOTSTRIDEDBATCHED/HDOTSTRIDEDBATCHED
+template <typename T>
+StatusCode DotStridedBatched(const size_t n,
+                             cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                             const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                             const size_t batch_count,
+                             cl_command_queue* queue, cl_event* event = nullptr);
+
+// Batched version of NRM2: SNRM2BATCHED/DNRM2BATCHED/ScNRM2BATCHED/DzNRM2BATCHED/HNRM2BATCHED
+template <typename T>
+StatusCode Nrm2Batched(const size_t n,
+                       cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
+// StridedBatched version of NRM2: SNRM2STRIDEDBATCHED/DNRM2STRIDEDBATCHED/ScNRM2STRIDEDBATCHED/DzNRM2STRIDEDBATCHED/HNRM2STRIDEDBATCHED
+template <typename T>
+StatusCode Nrm2StridedBatched(const size_t n,
+                              cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+
+// Batched version of ASUM: SASUMBATCHED/DASUMBATCHED/ScASUMBATCHED/DzASUMBATCHED/HASUMBATCHED
+template <typename T>
+StatusCode AsumBatched(const size_t n,
+                       cl_mem asum_buffer, const size_t *asum_offsets,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
+// StridedBatched version of ASUM: SASUMSTRIDEDBATCHED/DASUMSTRIDEDBATCHED/ScASUMSTRIDEDBATCHED/DzASUMSTRIDEDBATCHED/HASUMSTRIDEDBATCHED
+template <typename T>
+StatusCode AsumStridedBatched(const size_t n,
+                              cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Grouped version of GEMM: a batch of GEMMs with individual sizes and leading dimensions per problem
+// (non-BLAS function): SGEMMGROUPED/DGEMMGROUPED/CGEMMGROUPED/ZGEMMGROUPED/HGEMMGROUPED
+template <typename T>
+StatusCode GemmGrouped(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t *ms, const size_t *ns, const size_t *ks,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                       const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                       const T *betas,
+                       cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                       const size_t group_count,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Opaque handle to a matrix which is pre-packed into the internal layout of the GEMM kernel
+struct PackedMatrixData;
+using PackedMatrix = PackedMatrixData*;
+
+// Packs matrix A (side is left) or matrix B (side is right) of a GEMM once into a newly allocated
+// buffer, laid out as required by the GEMM kernel for the current tuning parameters (non-BLAS
+// function). The value of 'n' is ignored when packing A and the value of 'm' when packing B.
+template <typename T>
+StatusCode PackMatrix(const Layout layout, const Side side, const Transpose transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const cl_mem buffer, const size_t offset, const size_t ld,
+                      cl_command_queue* queue, PackedMatrix* packed, cl_event* event = nullptr);
+
+// Releases a packed matrix and its device memory (non-BLAS function)
+StatusCode PUBLIC_API ReleasePackedMatrix(PackedMatrix packed);
+
+// GEMM with optionally pre-packed A and/or B matrices: when a packed matrix is given, the
+// corresponding buffer, offset and leading dimension arguments are ignored and the packing
+// pre-processing is skipped (non-BLAS function): SGEMMPACKED/DGEMMPACKED/CGEMMPACKED/ZGEMMPACKED/HGEMMPACKED
+template <typename T>
+StatusCode GemmPacked(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const T alpha,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const PackedMatrix a_packed,
+                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const PackedMatrix b_packed,
+                      const T beta,
+                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Batched version of GEMM with all per-batch arguments stored in device buffers: alphas and betas
+// of type T and offsets of type int. No host-device transfers or allocations are performed (non-BLAS
+// function): SGEMMBATCHEDDEVICE/DGEMMBATCHEDDEVICE/CGEMMBATCHEDDEVICE/ZGEMMBATCHEDDEVICE/HGEMMBATCHEDDEVICE
+template <typename T>
+StatusCode GemmBatchedDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k,
+                             const cl_mem alphas_buffer,
+                             const cl_mem a_buffer, const cl_mem a_offsets_buffer, const size_t a_ld,
+                             const cl_mem b_buffer, const cl_mem b_offsets_buffer, const size_t b_ld,
+                             const cl_mem betas_buffer,
+                             cl_mem c_buffer, const cl_mem c_offsets_buffer, const size_t c_ld,
+                             const size_t batch_count,
+                             cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Strassen-Winograd version of GEMM for large matrices, trading accuracy for fewer flops (non-BLAS
+// function): SGEMMSTRASSEN/DGEMMSTRASSEN/CGEMMSTRASSEN/ZGEMMSTRASSEN/HGEMMSTRASSEN
+template <typename T>
+StatusCode GemmStrassen(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                        const size_t m, const size_t n, const size_t k,
+                        const T alpha,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                        const T beta,
+                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                        cl_command_queue* queue, cl_event* event = nullptr,
+                        cl_mem temp_buffer = nullptr);
+
+// Retrieves the required size of the temporary buffer for the Strassen-Winograd GEMM (optional)
+template <typename T>
+StatusCode GemmStrassenTempBufferSize(const size_t m, const size_t n, const size_t k,
+                                      cl_command_queue* queue, size_t& temp_buffer_size);
+
+// =================================================================================================
+
+// Cholesky factorization of a symmetric/hermitian positive-definite matrix. The result is written
+// to the 'info' buffer on the device (non-BLAS function): SPOTRF/DPOTRF/CPOTRF/ZPOTRF
+template <typename T>
+StatusCode Potrf(const Layout layout, const Triangle triangle,
+                 const size_t n,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_mem info_buffer, const size_t info_offset,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// LU factorization with partial pivoting of a general matrix. The pivot indices and the result
+// are written to the 'ipiv' and 'info' buffers on the device (non-BLAS function):
+// SGETRF/DGETRF/CGETRF/ZGETRF
+template <typename T>
+StatusCode Getrf(const Layout layout,
+                 const size_t m, const size_t n,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_mem ipiv_buffer, const size_t ipiv_offset,
+                 cl_mem info_buffer, const size_t info_offset,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Solves a general system of linear equations A * X = B in double precision using a single-
+// precision LU factorization and iterative refinement, falling back to double precision when
+// needed. The pivots, the result, and the number of iterations are written to device buffers
+// (non-BLAS function): DGESVMIXED/ZGESVMIXED
+template <typename T>
+StatusCode GesvMixed(const Layout layout,
+                     const size_t n, const size_t nrhs,
+                     cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                     cl_mem ipiv_buffer, const size_t ipiv_offset,
+                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                     cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                     cl_mem info_buffer, const size_t info_offset,
+                     cl_mem iter_buffer, const size_t iter_offset,
+                     cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Versions of AXPY, SCAL, AXPBY, GEMV and GEMM which read the scalars alpha and beta from device
+// buffers at the given offsets instead of taking them from the host. A scalar computed on the
+// device (e.g. by DOT) can thus be used without reading it back first, such that iterative methods
+// can run fully asynchronously (non-BLAS functions): xAXPYDEVICE/xSCALDEVICE/xAXPBYDEVICE/
+// xGEMVDEVICE/xGEMMDEVICE
+template <typename T>
+StatusCode AxpyDevice(const size_t n,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
+template <typename T>
+StatusCode ScalDevice(const size_t n,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
+template <typename T>
+StatusCode AxpbyDevice(const size_t n,
+                       const cl_mem alpha_buffer, const size_t alpha_offset,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem beta_buffer, const size_t beta_offset,
+                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
+template <typename T>
+StatusCode GemvDevice(const Layout layout, const Transpose a_transpose,
+                      const size_t m, const size_t n,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      const cl_mem beta_buffer, const size_t beta_offset,
+                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
+template <typename T>
+StatusCode GemmDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                      const cl_mem beta_buffer, const size_t beta_offset,
+                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
+// Fused sequence of k rank-1 updates A += alpha * x_i * y_i^T, computed as a single rank-k update
+// A += alpha * X * Y^T. In both layouts x_i is column i of the m-by-k matrix X and y_i column i of
+// the n-by-k matrix Y, with x_ld/y_ld as stride in row-major (non-BLAS function): SGERK/DGERK/HGERK
+template <typename T>
+StatusCode Gerk(const Layout layout,
+                const size_t m, const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_ld,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_command_queue* queue, cl_event* event = nullptr);
+
 // =================================================================================================
 
 // Retrieves the required size of the temporary buffer for the GEMM kernel (optional)
@@ -101,6 +101,7 @@ typedef enum CLBlastStatusCode_ {
   CLBlastInsufficientMemoryY       = -1007, // Vector Y's OpenCL buffer is too small
 
   // Custom additional status codes for CLBlast
+  CLBlastInvalidPackedMatrix       = -2051, // Packed matrix is invalid or does not match the arguments
   CLBlastInsufficientMemoryTemp    = -2050, // Temporary buffer provided to GEMM routine is too small
   CLBlastInvalidBatchCount         = -2049, // The batch count needs to be positive
   CLBlastInvalidOverrideKernel     = -2048, // Trying to override parameters for an invalid kernel
@@ -1362,6 +1363,157 @@ CLBlastStatusCode PUBLIC_API CLBlastHhad(const size_t n,
                                          cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
                                          cl_command_queue* queue, cl_event* event);
 
+// Vector-times-constant plus scaled vector: SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+CLBlastStatusCode PUBLIC_API CLBlastSaxpby(const size_t n,
+                                           const float alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const float beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpby(const size_t n,
+                                           const double alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const double beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCaxpby(const size_t n,
+                                           const cl_float2 alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const cl_float2 beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZaxpby(const size_t n,
+                                           const cl_double2 alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const cl_double2 beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpby(const size_t n,
+                                           const cl_half alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           const cl_half beta,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           cl_command_queue* queue, cl_event* event);
+
+// Sets all elements of a vector to a constant: SSET/DSET/CSET/ZSET/HSET
+CLBlastStatusCode PUBLIC_API CLBlastSset(const size_t n,
+                                         const float alpha,
+                                         cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDset(const size_t n,
+                                         const double alpha,
+                                         cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCset(const size_t n,
+                                         const cl_float2 alpha,
+                                         cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZset(const size_t n,
+                                         const cl_double2 alpha,
+                                         cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                         cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHset(const size_t n,
+                                         const cl_half alpha,
+                                         cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                         cl_command_queue* queue, cl_event* event);
+
+// Two fused vector-times-constant plus vector operations: SAXPY2/DAXPY2/CAXPY2/ZAXPY2/HAXPY2
+CLBlastStatusCode PUBLIC_API CLBlastSaxpy2(const size_t n,
+                                           const float alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           const float beta,
+                                           const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                           cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpy2(const size_t n,
+                                           const double alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           const double beta,
+                                           const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                           cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCaxpy2(const size_t n,
+                                           const cl_float2 alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           const cl_float2 beta,
+                                           const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                           cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZaxpy2(const size_t n,
+                                           const cl_double2 alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           const cl_double2 beta,
+                                           const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                           cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpy2(const size_t n,
+                                           const cl_half alpha,
+                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                           const cl_half beta,
+                                           const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                           cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                           cl_command_queue* queue, cl_event* event);
+
+// Fused vector update and dot product: SAXPYDOT/DAXPYDOT/HAXPYDOT
+CLBlastStatusCode PUBLIC_API CLBlastSaxpydot(const size_t n,
+                                             cl_mem dot_buffer, const size_t dot_offset,
+                                             const float alpha,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                             const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpydot(const size_t n,
+                                             cl_mem dot_buffer, const size_t dot_offset,
+                                             const double alpha,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                             const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpydot(const size_t n,
+                                             cl_mem dot_buffer, const size_t dot_offset,
+                                             const cl_half alpha,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                             const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                             cl_command_queue* queue, cl_event* event);
+
+// Fused vector update and Euclidian norm: SAXPYNRM2/DAXPYNRM2/CAXPYNRM2/ZAXPYNRM2/HAXPYNRM2
+CLBlastStatusCode PUBLIC_API CLBlastSaxpynrm2(const size_t n,
+                                              cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                              const float alpha,
+                                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                              cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpynrm2(const size_t n,
+                                              cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                              const double alpha,
+                                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                              cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCaxpynrm2(const size_t n,
+                                              cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                              const cl_float2 alpha,
+                                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                              cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZaxpynrm2(const size_t n,
+                                              cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                              const cl_double2 alpha,
+                                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                              cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpynrm2(const size_t n,
+                                              cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                              const cl_half alpha,
+                                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                              cl_command_queue* queue, cl_event* event);
+
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 CLBlastStatusCode PUBLIC_API CLBlastSomatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                                               const size_t m, const size_t n,
@@ -1500,6 +1652,70 @@ CLBlastStatusCode PUBLIC_API CLBlastHaxpyBatched(const size_t n,
                                                  const size_t batch_count,
                                                  cl_command_queue* queue, cl_event* event);
 
+// Batched version of AXPBY: SAXPBYBATCHED/DAXPBYBATCHED/CAXPBYBATCHED/ZAXPBYBATCHED/HAXPBYBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSaxpbyBatched(const size_t n,
+                                                  const float *alphas,
+                                                  const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                  const float *betas,
+                                                  cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpbyBatched(const size_t n,
+                                                  const double *alphas,
+                                                  const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                  const double *betas,
+                                                  cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCaxpbyBatched(const size_t n,
+                                                  const cl_float2 *alphas,
+                                                  const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                  const cl_float2 *betas,
+                                                  cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZaxpbyBatched(const size_t n,
+                                                  const cl_double2 *alphas,
+                                                  const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                  const cl_double2 *betas,
+                                                  cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpbyBatched(const size_t n,
+                                                  const cl_half *alphas,
+                                                  const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                  const cl_half *betas,
+                                                  cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
+
+// Batched version of SET: SSETBATCHED/DSETBATCHED/CSETBATCHED/ZSETBATCHED/HSETBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSsetBatched(const size_t n,
+                                                const float *alphas,
+                                                cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDsetBatched(const size_t n,
+                                                const double *alphas,
+                                                cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCsetBatched(const size_t n,
+                                                const cl_float2 *alphas,
+                                                cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZsetBatched(const size_t n,
+                                                const cl_double2 *alphas,
+                                                cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHsetBatched(const size_t n,
+                                                const cl_half *alphas,
+                                                cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event);
+
 // Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
 CLBlastStatusCode PUBLIC_API CLBlastSgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
                                                  const size_t m, const size_t n, const size_t k,
@@ -1594,6 +1810,248 @@ CLBlastStatusCode PUBLIC_API CLBlastHgemmStridedBatched(const CLBlastLayout layo
                                                         const size_t batch_count,
                                                         cl_command_queue* queue, cl_event* event);
 
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const float *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const float *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const double *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const double *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const cl_float2 *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const cl_float2 *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const cl_double2 *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const cl_double2 *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                 const size_t m, const size_t n,
+                                                 const cl_half *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const cl_half *betas,
+                                                 cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const float alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const float beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const double alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const double beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const cl_float2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const cl_float2 beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const cl_double2 alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const cl_double2 beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                        const size_t m, const size_t n,
+                                                        const cl_half alpha,
+                                                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const cl_half beta,
+                                                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// Batched version of DOT: SDOTBATCHED/DDOTBATCHED/HDOTBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSdotBatched(const size_t n,
+                                                cl_mem dot_buffer, const size_t *dot_offsets,
+                                                const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDdotBatched(const size_t n,
+                                                cl_mem dot_buffer, const size_t *dot_offsets,
+                                                const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHdotBatched(const size_t n,
+                                                cl_mem dot_buffer, const size_t *dot_offsets,
+                                                const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                                const size_t batch_count,
+                                                cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of DOT: SDOTSTRIDEDBATCHED/DDOTSTRIDEDBATCHED/HDOTSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSdotStridedBatched(const size_t n,
+                                                       cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                                                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDdotStridedBatched(const size_t n,
+                                                       cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                                                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHdotStridedBatched(const size_t n,
+                                                       cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                                                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                       const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+
+// Batched version of NRM2: SNRM2BATCHED/DNRM2BATCHED/ScNRM2BATCHED/DzNRM2BATCHED/HNRM2BATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSnrm2Batched(const size_t n,
+                                                 cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDnrm2Batched(const size_t n,
+                                                 cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastScnrm2Batched(const size_t n,
+                                                 cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDznrm2Batched(const size_t n,
+                                                 cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHnrm2Batched(const size_t n,
+                                                 cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of NRM2: SNRM2STRIDEDBATCHED/DNRM2STRIDEDBATCHED/ScNRM2STRIDEDBATCHED/DzNRM2STRIDEDBATCHED/HNRM2STRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSnrm2StridedBatched(const size_t n,
+                                                        cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDnrm2StridedBatched(const size_t n,
+                                                        cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastScnrm2StridedBatched(const size_t n,
+                                                        cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDznrm2StridedBatched(const size_t n,
+                                                        cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHnrm2StridedBatched(const size_t n,
+                                                        cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
+// Batched version of ASUM: SASUMBATCHED/DASUMBATCHED/ScASUMBATCHED/DzASUMBATCHED/HASUMBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSasumBatched(const size_t n,
+                                                 cl_mem asum_buffer, const size_t *asum_offsets,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDasumBatched(const size_t n,
+                                                 cl_mem asum_buffer, const size_t *asum_offsets,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastScasumBatched(const size_t n,
+                                                 cl_mem asum_buffer, const size_t *asum_offsets,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDzasumBatched(const size_t n,
+                                                 cl_mem asum_buffer, const size_t *asum_offsets,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHasumBatched(const size_t n,
+                                                 cl_mem asum_buffer, const size_t *asum_offsets,
+                                                 const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+
+// StridedBatched version of ASUM: SASUMSTRIDEDBATCHED/DASUMSTRIDEDBATCHED/ScASUMSTRIDEDBATCHED/DzASUMSTRIDEDBATCHED/HASUMSTRIDEDBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSasumStridedBatched(const size_t n,
+                                                        cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDasumStridedBatched(const size_t n,
+                                                        cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastScasumStridedBatched(const size_t n,
+                                                        cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDzasumStridedBatched(const size_t n,
+                                                        cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHasumStridedBatched(const size_t n,
+                                                        cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                                        const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                        const size_t batch_count,
+                                                        cl_command_queue* queue, cl_event* event);
+
 // =================================================================================================
 // General matrix-matrix multiplication with temporary buffer from user (optional, for advanced users): SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
 CLBlastStatusCode PUBLIC_API CLBlastSgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
@@ -1638,6 +2096,516 @@ CLBlastStatusCode PUBLIC_API CLBlastHgemmWithTempBuffer(const CLBlastLayout layo
                                                         cl_command_queue* queue, cl_event* event, cl_mem temp_buffer);
 
 // =================================================================================================
+// Grouped version of GEMM: SGEMMGROUPED/DGEMMGROUPED/CGEMMGROUPED/ZGEMMGROUPED/HGEMMGROUPED
+CLBlastStatusCode PUBLIC_API CLBlastSgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                 const size_t *ms, const size_t *ns, const size_t *ks,
+                                                 const float *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                                 const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                                 const float *betas,
+                                                 cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                                 const size_t group_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                 const size_t *ms, const size_t *ns, const size_t *ks,
+                                                 const double *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                                 const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                                 const double *betas,
+                                                 cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                                 const size_t group_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                 const size_t *ms, const size_t *ns, const size_t *ks,
+                                                 const cl_float2 *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                                 const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                                 const cl_float2 *betas,
+                                                 cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                                 const size_t group_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                 const size_t *ms, const size_t *ns, const size_t *ks,
+                                                 const cl_double2 *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                                 const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                                 const cl_double2 *betas,
+                                                 cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                                 const size_t group_count,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                 const size_t *ms, const size_t *ns, const size_t *ks,
+                                                 const cl_half *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                                 const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                                 const cl_half *betas,
+                                                 cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                                 const size_t group_count,
+                                                 cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+// Opaque handle to a matrix which is pre-packed into the internal layout of the GEMM kernel
+typedef struct CLBlastPackedMatrix_* CLBlastPackedMatrix;
+
+// Packs matrix A or B of a GEMM into the internal layout of the GEMM kernel (non-BLAS function):
+// SPACKMATRIX/DPACKMATRIX/CPACKMATRIX/ZPACKMATRIX/HPACKMATRIX
+CLBlastStatusCode PUBLIC_API CLBlastSpackMatrix(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTranspose transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_mem buffer, const size_t offset, const size_t ld,
+                                                cl_command_queue* queue, CLBlastPackedMatrix* packed, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDpackMatrix(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTranspose transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_mem buffer, const size_t offset, const size_t ld,
+                                                cl_command_queue* queue, CLBlastPackedMatrix* packed, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCpackMatrix(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTranspose transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_mem buffer, const size_t offset, const size_t ld,
+                                                cl_command_queue* queue, CLBlastPackedMatrix* packed, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZpackMatrix(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTranspose transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_mem buffer, const size_t offset, const size_t ld,
+                                                cl_command_queue* queue, CLBlastPackedMatrix* packed, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHpackMatrix(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTranspose transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_mem buffer, const size_t offset, const size_t ld,
+                                                cl_command_queue* queue, CLBlastPackedMatrix* packed, cl_event* event);
+
+// Releases a packed matrix and its device memory (non-BLAS function)
+CLBlastStatusCode PUBLIC_API CLBlastReleasePackedMatrix(CLBlastPackedMatrix packed);
+
+// GEMM with optionally pre-packed A and/or B matrices (non-BLAS function):
+// SGEMMPACKED/DGEMMPACKED/CGEMMPACKED/ZGEMMPACKED/HGEMMPACKED
+CLBlastStatusCode PUBLIC_API CLBlastSgemmPacked(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const float alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const CLBlastPackedMatrix a_packed,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const CLBlastPackedMatrix b_packed,
+                                                const float beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemmPacked(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const double alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const CLBlastPackedMatrix a_packed,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const CLBlastPackedMatrix b_packed,
+                                                const double beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemmPacked(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_float2 alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const CLBlastPackedMatrix a_packed,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const CLBlastPackedMatrix b_packed,
+                                                const cl_float2 beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemmPacked(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_double2 alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const CLBlastPackedMatrix a_packed,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const CLBlastPackedMatrix b_packed,
+                                                const cl_double2 beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemmPacked(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_half alpha,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const CLBlastPackedMatrix a_packed,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const CLBlastPackedMatrix b_packed,
+                                                const cl_half beta,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+
+// Batched version of GEMM with device-resident arguments (non-BLAS function):
+// SGEMMBATCHEDDEVICE/DGEMMBATCHEDDEVICE/CGEMMBATCHEDDEVICE/ZGEMMBATCHEDDEVICE/HGEMMBATCHEDDEVICE
+CLBlastStatusCode PUBLIC_API CLBlastSgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                       const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem alphas_buffer,
+                                                       const cl_mem a_buffer, const cl_mem a_offsets_buffer, const size_t a_ld,
+                                                       const cl_mem b_buffer, const cl_mem b_offsets_buffer, const size_t b_ld,
+                                                       const cl_mem betas_buffer,
+                                                       cl_mem c_buffer, const cl_mem c_offsets_buffer, const size_t c_ld,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                       const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem alphas_buffer,
+                                                       const cl_mem a_buffer, const cl_mem a_offsets_buffer, const size_t a_ld,
+                                                       const cl_mem b_buffer, const cl_mem b_offsets_buffer, const size_t b_ld,
+                                                       const cl_mem betas_buffer,
+                                                       cl_mem c_buffer, const cl_mem c_offsets_buffer, const size_t c_ld,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                       const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem alphas_buffer,
+                                                       const cl_mem a_buffer, const cl_mem a_offsets_buffer, const size_t a_ld,
+                                                       const cl_mem b_buffer, const cl_mem b_offsets_buffer, const size_t b_ld,
+                                                       const cl_mem betas_buffer,
+                                                       cl_mem c_buffer, const cl_mem c_offsets_buffer, const size_t c_ld,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                       const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem alphas_buffer,
+                                                       const cl_mem a_buffer, const cl_mem a_offsets_buffer, const size_t a_ld,
+                                                       const cl_mem b_buffer, const cl_mem b_offsets_buffer, const size_t b_ld,
+                                                       const cl_mem betas_buffer,
+                                                       cl_mem c_buffer, const cl_mem c_offsets_buffer, const size_t c_ld,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                       const size_t m, const size_t n, const size_t k,
+                                                       const cl_mem alphas_buffer,
+                                                       const cl_mem a_buffer, const cl_mem a_offsets_buffer, const size_t a_ld,
+                                                       const cl_mem b_buffer, const cl_mem b_offsets_buffer, const size_t b_ld,
+                                                       const cl_mem betas_buffer,
+                                                       cl_mem c_buffer, const cl_mem c_offsets_buffer, const size_t c_ld,
+                                                       const size_t batch_count,
+                                                       cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+
+// Strassen-Winograd version of GEMM for large matrices, trading accuracy for fewer flops (non-BLAS
+// function): SGEMMSTRASSEN/DGEMMSTRASSEN/CGEMMSTRASSEN/ZGEMMSTRASSEN/HGEMMSTRASSEN
+CLBlastStatusCode PUBLIC_API CLBlastSgemmStrassen(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const float alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const float beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  cl_command_queue* queue, cl_event* event,
+                                                  cl_mem temp_buffer);
+CLBlastStatusCode PUBLIC_API CLBlastDgemmStrassen(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const double alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const double beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  cl_command_queue* queue, cl_event* event,
+                                                  cl_mem temp_buffer);
+CLBlastStatusCode PUBLIC_API CLBlastCgemmStrassen(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const cl_float2 alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const cl_float2 beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  cl_command_queue* queue, cl_event* event,
+                                                  cl_mem temp_buffer);
+CLBlastStatusCode PUBLIC_API CLBlastZgemmStrassen(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const cl_double2 alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const cl_double2 beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  cl_command_queue* queue, cl_event* event,
+                                                  cl_mem temp_buffer);
+CLBlastStatusCode PUBLIC_API CLBlastHgemmStrassen(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                  const size_t m, const size_t n, const size_t k,
+                                                  const cl_half alpha,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                  const cl_half beta,
+                                                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                  cl_command_queue* queue, cl_event* event,
+                                                  cl_mem temp_buffer);
+
+// Retrieves the required size of the temporary buffer for the Strassen-Winograd GEMM:
+// SGEMMSTRASSEN/DGEMMSTRASSEN/CGEMMSTRASSEN/ZGEMMSTRASSEN/HGEMMSTRASSEN (optional)
+CLBlastStatusCode PUBLIC_API CLBlastSGemmStrassenTempBufferSize(const size_t m, const size_t n, const size_t k,
+                                                                cl_command_queue* queue,
+                                                                size_t* temp_buffer_size);
+CLBlastStatusCode PUBLIC_API CLBlastDGemmStrassenTempBufferSize(const size_t m, const size_t n, const size_t k,
+                                                                cl_command_queue* queue,
+                                                                size_t* temp_buffer_size);
+CLBlastStatusCode PUBLIC_API CLBlastCGemmStrassenTempBufferSize(const size_t m, const size_t n, const size_t k,
+                                                                cl_command_queue* queue,
+                                                                size_t* temp_buffer_size);
+CLBlastStatusCode PUBLIC_API CLBlastZGemmStrassenTempBufferSize(const size_t m, const size_t n, const size_t k,
+                                                                cl_command_queue* queue,
+                                                                size_t* temp_buffer_size);
+CLBlastStatusCode PUBLIC_API CLBlastHGemmStrassenTempBufferSize(const size_t m, const size_t n, const size_t k,
+                                                                cl_command_queue* queue,
+                                                                size_t* temp_buffer_size);
+
+// =================================================================================================
+
+// Cholesky factorization of a symmetric/hermitian positive-definite matrix. The result is written
+// to the 'info' buffer on the device (non-BLAS function): SPOTRF/DPOTRF/CPOTRF/ZPOTRF
+CLBlastStatusCode PUBLIC_API CLBlastSpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                           const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                           const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                           const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                           const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+
+// LU factorization with partial pivoting of a general matrix. The pivot indices and the result
+// are written to the 'ipiv' and 'info' buffers on the device (non-BLAS function):
+// SGETRF/DGETRF/CGETRF/ZGETRF
+CLBlastStatusCode PUBLIC_API CLBlastSgetrf(const CLBlastLayout layout,
+                                           const size_t m, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgetrf(const CLBlastLayout layout,
+                                           const size_t m, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgetrf(const CLBlastLayout layout,
+                                           const size_t m, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgetrf(const CLBlastLayout layout,
+                                           const size_t m, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                           cl_mem info_buffer, const size_t info_offset,
+                                           cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+
+// Solves a general system of linear equations A * X = B in double precision using a single-
+// precision LU factorization and iterative refinement, falling back to double precision when
+// needed. The pivots, the result, and the number of iterations are written to device buffers
+// (non-BLAS function): DGESVMIXED/ZGESVMIXED
+CLBlastStatusCode PUBLIC_API CLBlastDgesvMixed(const CLBlastLayout layout,
+                                               const size_t n, const size_t nrhs,
+                                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                               cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                               const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                               cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                                               cl_mem info_buffer, const size_t info_offset,
+                                               cl_mem iter_buffer, const size_t iter_offset,
+                                               cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgesvMixed(const CLBlastLayout layout,
+                                               const size_t n, const size_t nrhs,
+                                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                               cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                               const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                               cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                                               cl_mem info_buffer, const size_t info_offset,
+                                               cl_mem iter_buffer, const size_t iter_offset,
+                                               cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+
+// Versions of AXPY, SCAL, AXPBY, GEMV and GEMM which read the scalars alpha and beta from device
+// buffers at the given offsets instead of taking them from the host. A scalar computed on the
+// device (e.g. by DOT) can thus be used without reading it back first, such that iterative methods
+// can run fully asynchronously (non-BLAS functions): xAXPYDEVICE/xSCALDEVICE/xAXPBYDEVICE/
+// xGEMVDEVICE/xGEMMDEVICE
+CLBlastStatusCode PUBLIC_API CLBlastSaxpyDevice(const size_t n,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpyDevice(const size_t n,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCaxpyDevice(const size_t n,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZaxpyDevice(const size_t n,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpyDevice(const size_t n,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastSscalDevice(const size_t n,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDscalDevice(const size_t n,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCscalDevice(const size_t n,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZscalDevice(const size_t n,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHscalDevice(const size_t n,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastSaxpbyDevice(const size_t n,
+                                                 const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                 const cl_mem beta_buffer, const size_t beta_offset,
+                                                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDaxpbyDevice(const size_t n,
+                                                 const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                 const cl_mem beta_buffer, const size_t beta_offset,
+                                                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCaxpbyDevice(const size_t n,
+                                                 const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                 const cl_mem beta_buffer, const size_t beta_offset,
+                                                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZaxpbyDevice(const size_t n,
+                                                 const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                 const cl_mem beta_buffer, const size_t beta_offset,
+                                                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHaxpbyDevice(const size_t n,
+                                                 const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                 const cl_mem beta_buffer, const size_t beta_offset,
+                                                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastSgemvDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                const size_t m, const size_t n,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                const cl_mem beta_buffer, const size_t beta_offset,
+                                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemvDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                const size_t m, const size_t n,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                const cl_mem beta_buffer, const size_t beta_offset,
+                                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemvDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                const size_t m, const size_t n,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                const cl_mem beta_buffer, const size_t beta_offset,
+                                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemvDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                const size_t m, const size_t n,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                const cl_mem beta_buffer, const size_t beta_offset,
+                                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemvDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                const size_t m, const size_t n,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                const cl_mem beta_buffer, const size_t beta_offset,
+                                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastSgemmDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const cl_mem beta_buffer, const size_t beta_offset,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgemmDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const cl_mem beta_buffer, const size_t beta_offset,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgemmDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const cl_mem beta_buffer, const size_t beta_offset,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemmDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const cl_mem beta_buffer, const size_t beta_offset,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgemmDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_mem alpha_buffer, const size_t alpha_offset,
+                                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                const cl_mem beta_buffer, const size_t beta_offset,
+                                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+
+// Fused sequence of k rank-1 updates A += alpha * x_i * y_i^T, computed as a single rank-k update
+// A += alpha * X * Y^T. In both layouts x_i is column i of the m-by-k matrix X and y_i column i of
+// the n-by-k matrix Y, with x_ld/y_ld as stride in row-major (non-BLAS function): SGERK/DGERK/HGERK
+CLBlastStatusCode PUBLIC_API CLBlastSgerk(const CLBlastLayout layout,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const float alpha,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                                          const cl_mem y_buffer, const size_t y_offset, const size_t y_ld,
+                                          cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgerk(const CLBlastLayout layout,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const double alpha,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                                          const cl_mem y_buffer, const size_t y_offset, const size_t y_ld,
+                                          cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgerk(const CLBlastLayout layout,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const cl_half alpha,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                                          const cl_mem y_buffer, const size_t y_offset, const size_t y_ld,
+                                          cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+
 // Retrieves the required size of the temporary buffer for the GEMM kernel: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM (optional)
 CLBlastStatusCode PUBLIC_API CLBlastSGemmTempBufferSize(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
                                                         const size_t m, const size_t n, const size_t k,
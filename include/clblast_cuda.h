@@ -69,6 +69,7 @@ enum class StatusCode {
   kInsufficientMemoryY       = -1007, // Vector Y's OpenCL buffer is too small
 
   // Custom additional status codes for CLBlast
+  kInvalidPackedMatrix       = -2051, // Packed matrix is invalid or does not match the arguments
   kInsufficientMemoryTemp    = -2050, // Temporary buffer provided to GEMM routine is too small
   kInvalidBatchCount         = -2049, // The batch count needs to be positive
   kInvalidOverrideKernel     = -2048, // Trying to override parameters for an invalid kernel
@@ -593,6 +594,52 @@ StatusCode Had(const size_t n,
                CUdeviceptr z_buffer, const size_t z_offset, const size_t z_inc,
                const CUcontext context, const CUdevice device);
 
+// Vector-times-constant plus scaled vector: SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+template <typename T>
+StatusCode Axpby(const size_t n,
+                 const T alpha,
+                 const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta,
+                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                 const CUcontext context, const CUdevice device);
+
+// Sets all elements of a vector to a constant: SSET/DSET/CSET/ZSET/HSET
+template <typename T>
+StatusCode Set(const size_t n,
+               const T alpha,
+               CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+               const CUcontext context, const CUdevice device);
+
+// Two fused vector-times-constant plus vector operations: SAXPY2/DAXPY2/CAXPY2/ZAXPY2/HAXPY2
+template <typename T>
+StatusCode Axpy2(const size_t n,
+                 const T alpha,
+                 const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                 const T beta,
+                 const CUdeviceptr z_buffer, const size_t z_offset, const size_t z_inc,
+                 CUdeviceptr w_buffer, const size_t w_offset, const size_t w_inc,
+                 const CUcontext context, const CUdevice device);
+
+// Fused vector update and dot product: SAXPYDOT/DAXPYDOT/HAXPYDOT
+template <typename T>
+StatusCode Axpydot(const size_t n,
+                   CUdeviceptr dot_buffer, const size_t dot_offset,
+                   const T alpha,
+                   const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                   CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                   const CUdeviceptr z_buffer, const size_t z_offset, const size_t z_inc,
+                   const CUcontext context, const CUdevice device);
+
+// Fused vector update and Euclidian norm: SAXPYNRM2/DAXPYNRM2/CAXPYNRM2/ZAXPYNRM2/HAXPYNRM2
+template <typename T>
+StatusCode Axpynrm2(const size_t n,
+                    CUdeviceptr nrm2_buffer, const size_t nrm2_offset,
+                    const T alpha,
+                    const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                    CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                    const CUcontext context, const CUdevice device);
+
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 template <typename T>
 StatusCode Omatcopy(const Layout layout, const Transpose a_transpose,
@@ -636,6 +683,24 @@ StatusCode AxpyBatched(const size_t n,
                        const size_t batch_count,
                        const CUcontext context, const CUdevice device);
 
+// Batched version of AXPBY: SAXPBYBATCHED/DAXPBYBATCHED/CAXPBYBATCHED/ZAXPBYBATCHED/HAXPBYBATCHED
+template <typename T>
+StatusCode AxpbyBatched(const size_t n,
+                        const T *alphas,
+                        const CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                        const T *betas,
+                        CUdeviceptr y_buffer, const size_t *y_offsets, const size_t y_inc,
+                        const size_t batch_count,
+                        const CUcontext context, const CUdevice device);
+
+// Batched version of SET: SSETBATCHED/DSETBATCHED/CSETBATCHED/ZSETBATCHED/HSETBATCHED
+template <typename T>
+StatusCode SetBatched(const size_t n,
+                      const T *alphas,
+                      CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                      const size_t batch_count,
+                      const CUcontext context, const CUdevice device);
+
 // Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
 template <typename T>
 StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
@@ -660,6 +725,95 @@ StatusCode GemmStridedBatched(const Layout layout, const Transpose a_transpose,
                               const size_t batch_count,
                               const CUcontext context, const CUdevice device);
 
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+template <typename T>
+StatusCode GemvBatched(const Layout layout, const Transpose a_transpose,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const CUdeviceptr a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       const CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const T *betas,
+                       CUdeviceptr y_buffer, const size_t *y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       const CUcontext context, const CUdevice device);
+
+// StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+template <typename T>
+StatusCode GemvStridedBatched(const Layout layout, const Transpose a_transpose,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const T beta,
+                              CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// Batched version of DOT: SDOTBATCHED/DDOTBATCHED/HDOTBATCHED
+template <typename T>
+StatusCode DotBatched(const size_t n,
+                      CUdeviceptr dot_buffer, const size_t *dot_offsets,
+                      const CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                      const CUdeviceptr y_buffer, const size_t *y_offsets, const size_t y_inc,
+                      const size_t batch_count,
+                      const CUcontext context, const CUdevice device);
+
+// StridedBatched version of DOT: SDOTSTRIDEDBATCHED/DDOTSTRIDEDBATCHED/HDOTSTRIDEDBATCHED
+template <typename T>
+StatusCode DotStridedBatched(const size_t n,
+                             CUdeviceptr dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                             const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                             const CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                             const size_t batch_count,
+                             const CUcontext context, const CUdevice device);
+
+// Batched version of NRM2: SNRM2BATCHED/DNRM2BATCHED/ScNRM2BATCHED/DzNRM2BATCHED/HNRM2BATCHED
+template <typename T>
+StatusCode Nrm2Batched(const size_t n,
+                       CUdeviceptr nrm2_buffer, const size_t *nrm2_offsets,
+                       const CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const size_t batch_count,
+                       const CUcontext context, const CUdevice device);
+
+// StridedBatched version of NRM2: SNRM2STRIDEDBATCHED/DNRM2STRIDEDBATCHED/ScNRM2STRIDEDBATCHED/DzNRM2STRIDEDBATCHED/HNRM2STRIDEDBATCHED
+template <typename T>
+StatusCode Nrm2StridedBatched(const size_t n,
+                              CUdeviceptr nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                              const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// Batched version of ASUM: SASUMBATCHED/DASUMBATCHED/ScASUMBATCHED/DzASUMBATCHED/HASUMBATCHED
+template <typename T>
+StatusCode AsumBatched(const size_t n,
+                       CUdeviceptr asum_buffer, const size_t *asum_offsets,
+                       const CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const size_t batch_count,
+                       const CUcontext context, const CUdevice device);
+
+// StridedBatched version of ASUM: SASUMSTRIDEDBATCHED/DASUMSTRIDEDBATCHED/ScASUMSTRIDEDBATCHED/DzASUMSTRIDEDBATCHED/HASUMSTRIDEDBATCHED
+template <typename T>
+StatusCode AsumStridedBatched(const size_t n,
+                              CUdeviceptr asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                              const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device);
+
+// =================================================================================================
+
+// Grouped version of GEMM: a batch of GEMMs with individual sizes and leading dimensions per problem
+// (non-BLAS function): SGEMMGROUPED/DGEMMGROUPED/CGEMMGROUPED/ZGEMMGROUPED/HGEMMGROUPED
+template <typename T>
+StatusCode GemmGrouped(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t *ms, const size_t *ns, const size_t *ks,
+                       const T *alphas,
+                       const CUdeviceptr a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                       const CUdeviceptr b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                       const T *betas,
+                       CUdeviceptr c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                       const size_t group_count,
+                       const CUcontext context, const CUdevice device);
+
 // =================================================================================================
 
 // Retrieves the required size of the temporary buffer for the GEMM kernel (optional)
@@ -925,6 +925,102 @@ void PUBLIC_API cblas_zhad(const int n,
                            const void* beta,
                            void* z, const int z_inc);
 
+// Vector-times-constant plus scaled vector: SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+void PUBLIC_API cblas_saxpby(const int n,
+                             const float alpha,
+                             const float* x, const int x_inc,
+                             const float beta,
+                             float* y, const int y_inc);
+void PUBLIC_API cblas_daxpby(const int n,
+                             const double alpha,
+                             const double* x, const int x_inc,
+                             const double beta,
+                             double* y, const int y_inc);
+void PUBLIC_API cblas_caxpby(const int n,
+                             const void* alpha,
+                             const void* x, const int x_inc,
+                             const void* beta,
+                             void* y, const int y_inc);
+void PUBLIC_API cblas_zaxpby(const int n,
+                             const void* alpha,
+                             const void* x, const int x_inc,
+                             const void* beta,
+                             void* y, const int y_inc);
+
+// Sets all elements of a vector to a constant: SSET/DSET/CSET/ZSET/HSET
+void PUBLIC_API cblas_sset(const int n,
+                           const float alpha,
+                           float* x, const int x_inc);
+void PUBLIC_API cblas_dset(const int n,
+                           const double alpha,
+                           double* x, const int x_inc);
+void PUBLIC_API cblas_cset(const int n,
+                           const void* alpha,
+                           void* x, const int x_inc);
+void PUBLIC_API cblas_zset(const int n,
+                           const void* alpha,
+                           void* x, const int x_inc);
+
+// Two fused vector-times-constant plus vector operations: SAXPY2/DAXPY2/CAXPY2/ZAXPY2/HAXPY2
+void PUBLIC_API cblas_saxpy2(const int n,
+                             const float alpha,
+                             const float* x, const int x_inc,
+                             float* y, const int y_inc,
+                             const float beta,
+                             const float* z, const int z_inc,
+                             float* w, const int w_inc);
+void PUBLIC_API cblas_daxpy2(const int n,
+                             const double alpha,
+                             const double* x, const int x_inc,
+                             double* y, const int y_inc,
+                             const double beta,
+                             const double* z, const int z_inc,
+                             double* w, const int w_inc);
+void PUBLIC_API cblas_caxpy2(const int n,
+                             const void* alpha,
+                             const void* x, const int x_inc,
+                             void* y, const int y_inc,
+                             const void* beta,
+                             const void* z, const int z_inc,
+                             void* w, const int w_inc);
+void PUBLIC_API cblas_zaxpy2(const int n,
+                             const void* alpha,
+                             const void* x, const int x_inc,
+                             void* y, const int y_inc,
+                             const void* beta,
+                             const void* z, const int z_inc,
+                             void* w, const int w_inc);
+
+// Fused vector update and dot product: SAXPYDOT/DAXPYDOT/HAXPYDOT
+float PUBLIC_API cblas_saxpydot(const int n,
+                                const float alpha,
+                                const float* x, const int x_inc,
+                                float* y, const int y_inc,
+                                const float* z, const int z_inc);
+double PUBLIC_API cblas_daxpydot(const int n,
+                                 const double alpha,
+                                 const double* x, const int x_inc,
+                                 double* y, const int y_inc,
+                                 const double* z, const int z_inc);
+
+// Fused vector update and Euclidian norm: SAXPYNRM2/DAXPYNRM2/CAXPYNRM2/ZAXPYNRM2/HAXPYNRM2
+float PUBLIC_API cblas_saxpynrm2(const int n,
+                                 const float alpha,
+                                 const float* x, const int x_inc,
+                                 float* y, const int y_inc);
+double PUBLIC_API cblas_daxpynrm2(const int n,
+                                  const double alpha,
+                                  const double* x, const int x_inc,
+                                  double* y, const int y_inc);
+float PUBLIC_API cblas_caxpynrm2(const int n,
+                                 const void* alpha,
+                                 const void* x, const int x_inc,
+                                 void* y, const int y_inc);
+double PUBLIC_API cblas_zaxpynrm2(const int n,
+                                  const void* alpha,
+                                  const void* x, const int x_inc,
+                                  void* y, const int y_inc);
+
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 void PUBLIC_API cblas_somatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                                 const int m, const int n,
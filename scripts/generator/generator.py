@@ -49,10 +49,10 @@ FILES = [
     "/src/clblast_cuda.cpp",
     "/src/pyclblast/src/pyclblast.pyx"
 ]
-HEADER_LINES = [129, 21, 133, 24, 29, 45, 29, 66, 40, 96, 21, 327]
-FOOTER_LINES = [98, 57, 112, 275, 6, 6, 6, 9, 2, 41, 56, 37]
+HEADER_LINES = [130, 21, 134, 24, 29, 45, 29, 66, 40, 97, 21, 327]
+FOOTER_LINES = [283, 913, 622, 1644, 6, 6, 6, 9, 2, 56, 136, 37]
 HEADER_LINES_DOC = 0
-FOOTER_LINES_DOC = 232
+FOOTER_LINES_DOC = 1039
 
 # Different possibilities for requirements
 ald_m = "The value of `a_ld` must be at least `m`."
@@ -87,6 +87,7 @@ xm = "m * x_inc"
 yn = "n * y_inc"
 ym = "m * y_inc"
 zn = "n * z_inc"
+wn = "n * w_inc"
 an = "n * a_ld"
 apn = "((n*(n+1)) / 2)"
 cn = "n * c_ld"
@@ -118,10 +119,10 @@ im2col_constants = ["channels", "height", "width", "kernel_h", "kernel_w", "pad_
 convgemm_constants = im2col_constants + ["num_kernels", "batch_count"]
 ROUTINES = [
 [  # Level 1: vector-vector
-  Routine(False, True,  0, False, "1", "rotg",  T, [S,D],            [],                  [],                                                     [],         ["sa","sb","sc","ss"],        ["1","1","1","1"], [],       "",    "Generate givens plane rotation", "", []),
-  Routine(False, True,  0, False, "1", "rotmg", T, [S,D],            [],                  [],                                                     ["sy1"],    ["sd1","sd2","sx1","sparam"], ["1","1","1","1","1"], [],   "",    "Generate modified givens plane rotation", "", []),
-  Routine(False, True,  0, False, "1", "rot",   T, [S,D],            ["n"],               [],                                                     [],         ["x","y"],                    [xn,yn],       ["cos","sin"],"",    "Apply givens plane rotation", "", []),
-  Routine(False, True,  0, False, "1", "rotm",  T, [S,D],            ["n"],               [],                                                     [],         ["x","y","sparam"],           [xn,yn,"1"],   [],           "",    "Apply modified givens plane rotation", "", []),
+  Routine(True,  True,  0, False, "1", "rotg",  T, [S,D],            [],                  [],                                                     [],         ["sa","sb","sc","ss"],        ["1","1","1","1"], [],       "",    "Generate givens plane rotation", "", []),
+  Routine(True,  True,  0, False, "1", "rotmg", T, [S,D],            [],                  [],                                                     ["sy1"],    ["sd1","sd2","sx1","sparam"], ["1","1","1","1","1"], [],   "",    "Generate modified givens plane rotation", "", []),
+  Routine(True,  True,  0, False, "1", "rot",   T, [S,D],            ["n"],               [],                                                     [],         ["x","y"],                    [xn,yn],       ["cos","sin"],"",    "Apply givens plane rotation", "", []),
+  Routine(True,  True,  0, False, "1", "rotm",  T, [S,D],            ["n"],               [],                                                     [],         ["x","y","sparam"],           [xn,yn,"1"],   [],           "",    "Apply modified givens plane rotation", "", []),
   Routine(True,  True,  0, False, "1", "swap",  T, [S,D,C,Z,H],      ["n"],               [],                                                     [],         ["x","y"],                    [xn,yn],       [],           "",    "Swap two vectors", "Interchanges _n_ elements of vectors _x_ and _y_.", []),
   Routine(True,  True,  0, False, "1", "scal",  T, [S,D,C,Z,H],      ["n"],               [],                                                     [],         ["x"],                        [xn],          ["alpha"],    "",    "Vector scaling", "Multiplies _n_ elements of vector _x_ by a scalar constant _alpha_.", []),
   Routine(True,  True,  0, False, "1", "copy",  T, [S,D,C,Z,H],      ["n"],               [],                                                     ["x"],      ["y"],                        [xn,yn],       [],           "",    "Vector copy", "Copies the contents of vector _x_ into vector _y_.", []),
@@ -150,8 +151,8 @@ ROUTINES = [
   Routine(True,  True,  0, False, "2a", "tbmv",  T,  [S,D,C,Z,H],    ["n","k"],           ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "n",   "Triangular banded matrix-vector multiplication", "Same operation as xGEMV, but matrix _A_ is triangular and banded instead.", [ald_k_one]),
   Routine(True,  True,  0, False, "2a", "tpmv",  T,  [S,D,C,Z,H],    ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["ap"],     ["x"],                        [apn,xn],      [],               "n",   "Triangular packed matrix-vector multiplication", "Same operation as xGEMV, but matrix _A_ is a triangular packed matrix instead and repreented as _AP_.", []),
   Routine(True,  True,  0, False, "2a", "trsv",  T,  [S,D,C,Z],      ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "",    "Solves a triangular system of equations", "", []),
-  Routine(False, True,  0, False, "2a", "tbsv",  T,  [S,D,C,Z],      ["n","k"],           ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "",    "Solves a banded triangular system of equations", "", [ald_k_one]),
-  Routine(False, True,  0, False, "2a", "tpsv",  T,  [S,D,C,Z],      ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["ap"],     ["x"],                        [apn,xn],      [],               "",    "Solves a packed triangular system of equations", "", []),
+  Routine(True,  True,  0, False, "2a", "tbsv",  T,  [S,D,C,Z],      ["n","k"],           ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "",    "Solves a banded triangular system of equations", "", [ald_k_one]),
+  Routine(True,  True,  0, False, "2a", "tpsv",  T,  [S,D,C,Z],      ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["ap"],     ["x"],                        [apn,xn],      [],               "",    "Solves a packed triangular system of equations", "", []),
   # Level 2: matrix update
   Routine(True,  True,  0, False, "2b", "ger",   T,  [S,D,H],        ["m","n"],           ["layout"],                                             ["x","y"],  ["a"],                        [xm,yn,amn],   ["alpha"],        "",    "General rank-1 matrix update", "Performs the operation _A = alpha * x * y^T + A_, in which _x_ is an input vector, _y^T_ is the transpose of the input vector _y_, _A_ is the matrix to be updated, and _alpha_ is a scalar value.", [ald_m]),
   Routine(True,  True,  0, False, "2b", "geru",  T,  [C,Z],          ["m","n"],           ["layout"],                                             ["x","y"],  ["a"],                        [xm,yn,amn],   ["alpha"],        "",    "General rank-1 complex matrix update", "Same operation as xGER, but with complex data-types.", [ald_m]),
@@ -179,14 +180,29 @@ ROUTINES = [
 [  # Level X: extra routines (not part of BLAS)
   # Special routines:
   Routine(True,  True,  0, False, "x", "had",      T, [S,D,C,Z,H],   ["n"],                [],                                                    ["x","y"],  ["z"],                        [xn,yn,zn],      ["alpha","beta"], "",    "Element-wise vector product (Hadamard)", "Performs the Hadamard element-wise product _z = alpha * x * y + beta * z_, in which _x_, _y_, and _z_ are vectors and _alpha_ and _beta_ are scalar constants.", []),
+  Routine(True,  True,  0, False, "x", "axpby",    T, [S,D,C,Z,H],   ["n"],                [],                                                    ["x"],      ["y"],                        [xn,yn],         ["alpha","beta"], "",    "Vector-times-constant plus scaled vector", "Performs the operation _y = alpha * x + beta * y_, in which _x_ and _y_ are vectors and _alpha_ and _beta_ are scalar constants. This replaces a call to xSCAL followed by a call to xAXPY, reading and writing _y_ only once.", []),
+  Routine(True,  True,  0, False, "x", "set",      T, [S,D,C,Z,H],   ["n"],                [],                                                    [],         ["x"],                        [xn],            ["alpha"],        "",    "Sets all elements of a vector to a constant", "Performs the operation _x = alpha_ for each element of the vector _x_, in which _alpha_ is a scalar constant.", []),
+  Routine(True,  True,  0, False, "x", "axpy2",    T, [S,D,C,Z,H],   ["n"],                [],                                                    ["x","z"],  ["y","w"],                    [xn,zn,yn,wn],   ["alpha","beta"], "",    "Two fused vector-times-constant plus vector operations", "Performs the operations _y = alpha * x + y_ and _w = beta * z + w_ in a single pass, in which _x_, _y_, _z_, and _w_ are vectors and _alpha_ and _beta_ are scalar constants. This is for example the update of the solution and the residual in a conjugate gradient iteration.", []),
+  Routine(True,  True,  0, False, "x", "axpydot",  T, [S,D,H],       ["n"],                [],                                                    ["x","z"],  ["y","dot"],                  [xn,zn,yn,"1"],  ["alpha"],        "n",   "Fused vector update and dot product", "Performs the operation _y = alpha * x + y_ and computes the dot product of the updated vector _y_ with the vector _z_ in a single pass. The result is stored in the _dot_ buffer.", []),
+  Routine(True,  True,  0, False, "x", "axpynrm2", T, [S,D,C,Z,H],   ["n"],                [],                                                    ["x"],      ["y","nrm2"],                 [xn,yn,"1"],     ["alpha"],        "2*n", "Fused vector update and Euclidian norm", "Performs the operation _y = alpha * x + y_ and computes the L2 norm of the updated vector _y_ in a single pass. The result is stored in the _nrm2_ buffer.", []),
   Routine(True,  True,  0, False, "x", "omatcopy", T, [S,D,C,Z,H],   ["m","n"],            ["layout","a_transpose"],                              ["a"],      ["b"],                        [amn,bnma],      ["alpha"],        "",    "Scaling and out-place transpose/copy (non-BLAS function)", "Performs scaling and out-of-place transposition/copying of matrices according to _B = alpha*op(A)_, in which _A_ is an input matrix (_m_ rows by _n_ columns), _B_ an output matrix, and _alpha_ a scalar value. The operation _op_ can be a normal matrix copy, a transposition or a conjugate transposition.", [ald_m, bld_n]),
   Routine(True,  True,  0, False, "x", "im2col",   T, [S,D,C,Z,H],   im2col_constants,     ["kernel_mode"],                                       ["im"],     ["col"],                      [im,col],        [""],             "",    "Im2col function (non-BLAS function)", "Performs the im2col algorithm, in which _im_ is the input matrix and _col_ is the output matrix. Overwrites any existing values in the _col_ buffer", []),
   Routine(True,  True,  0, False, "x", "col2im",   T, [S,D,C,Z,H],   im2col_constants,     ["kernel_mode"],                                       ["col"],    ["im"],                       [col,im],        [""],             "",    "Col2im function (non-BLAS function)", "Performs the col2im algorithm, in which _col_ is the input matrix and _im_ is the output matrix. Accumulates results on top of the existing values in the _im_ buffer.", []),
   Routine(True,  True,  0, False, "x", "convgemm", T, [S,D,H],       convgemm_constants,   ["kernel_mode"],                                       ["im","kernel"], ["result"],              [imb,kernel,result],[""],          "",    "Batched convolution as GEMM (non-BLAS function)", "Integrates im2col and GEMM for batched 3D convolution, in which _im_ is the 4D input tensor (NCHW - batch-channelin-height-width), _kernel_ the 4D kernel weights tensor (KCHW - channelout-channelin-height-width), and _result_ the 4D output tensor (NCHW - batch-channelout-height-width).", []),
   # Batched routines:
   Routine(True,  True,  1, False, "x", "axpy",     T, [S,D,C,Z,H],   ["n"],                [],                                                    ["x"],      ["y"],                        [xn,yn],         ["alpha"],        "",    "Batched version of AXPY", "As AXPY, but multiple operations are batched together for better performance.", []),
+  Routine(True,  True,  1, False, "x", "axpby",    T, [S,D,C,Z,H],   ["n"],                [],                                                    ["x"],      ["y"],                        [xn,yn],         ["alpha","beta"], "",    "Batched version of AXPBY", "As AXPBY, but multiple operations are batched together for better performance.", []),
+  Routine(True,  True,  1, False, "x", "set",      T, [S,D,C,Z,H],   ["n"],                [],                                                    [],         ["x"],                        [xn],            ["alpha"],        "",    "Batched version of SET", "As SET, but multiple operations are batched together for better performance.", []),
   Routine(True,  True,  1, False, "x", "gemm",     T, [S,D,C,Z,H],   ["m","n","k"],        ["layout","a_transpose","b_transpose"],                ["a","b"],  ["c"],                        [amk,bkn,cmn],   ["alpha","beta"], "",    "Batched version of GEMM", "As GEMM, but multiple operations are batched together for better performance.", [ald_transa_m_k, bld_transb_k_n, cld_m]),
   Routine(True,  True,  2, False, "x", "gemm",     T, [S,D,C,Z,H],   ["m","n","k"],        ["layout","a_transpose","b_transpose"],                ["a","b"],  ["c"],                        [amk,bkn,cmn],   ["alpha","beta"], "",    "StridedBatched version of GEMM", "As GEMM, but multiple strided operations are batched together for better performance.", [ald_transa_m_k, bld_transb_k_n, cld_m]),
+  Routine(True,  True,  1, False, "x", "gemv",     T, [S,D,C,Z,H],   ["m","n"],            ["layout","a_transpose"],                              ["a","x"],  ["y"],                        [amn,xmn,ynm],   ["alpha","beta"], "",    "Batched version of GEMV", "As GEMV, but multiple operations are batched together for better performance.", [ald_m]),
+  Routine(True,  True,  2, False, "x", "gemv",     T, [S,D,C,Z,H],   ["m","n"],            ["layout","a_transpose"],                              ["a","x"],  ["y"],                        [amn,xmn,ynm],   ["alpha","beta"], "",    "StridedBatched version of GEMV", "As GEMV, but multiple strided operations are batched together for better performance.", [ald_m]),
+  Routine(True,  True,  1, False, "x", "dot",      T, [S,D,H],       ["n"],                [],                                                    ["x","y"],  ["dot"],                      [xn,yn,"1"],     [],               "",    "Batched version of DOT", "As DOT, but multiple operations are batched together for better performance.", []),
+  Routine(True,  True,  2, False, "x", "dot",      T, [S,D,H],       ["n"],                [],                                                    ["x","y"],  ["dot"],                      [xn,yn,"1"],     [],               "",    "StridedBatched version of DOT", "As DOT, but multiple strided operations are batched together for better performance.", []),
+  Routine(True,  True,  1, False, "x", "nrm2",     T, [S,D,Sc,Dz,H], ["n"],                [],                                                    ["x"],      ["nrm2"],                     [xn,"1"],        [],               "",    "Batched version of NRM2", "As NRM2, but multiple operations are batched together for better performance.", []),
+  Routine(True,  True,  2, False, "x", "nrm2",     T, [S,D,Sc,Dz,H], ["n"],                [],                                                    ["x"],      ["nrm2"],                     [xn,"1"],        [],               "",    "StridedBatched version of NRM2", "As NRM2, but multiple strided operations are batched together for better performance.", []),
+  Routine(True,  True,  1, False, "x", "asum",     T, [S,D,Sc,Dz,H], ["n"],                [],                                                    ["x"],      ["asum"],                     [xn,"1"],        [],               "",    "Batched version of ASUM", "As ASUM, but multiple operations are batched together for better performance.", []),
+  Routine(True,  True,  2, False, "x", "asum",     T, [S,D,Sc,Dz,H], ["n"],                [],                                                    ["x"],      ["asum"],                     [xn,"1"],        [],               "",    "StridedBatched version of ASUM", "As ASUM, but multiple strided operations are batched together for better performance.", []),
 ]]
 
 
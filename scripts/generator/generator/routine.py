@@ -129,12 +129,12 @@ class Routine:
     @staticmethod
     def postfix(name):
         """Retrieves the postfix for a buffer"""
-        return "inc" if (name in ["x", "y", "z"]) else "ld"
+        return "inc" if (name in ["x", "y", "z", "w"]) else "ld"
 
     @staticmethod
     def buffers_vector():
         """Distinguish between vectors and matrices"""
-        return ["x", "y", "z"]
+        return ["x", "y", "z", "w"]
 
     @staticmethod
     def buffers_matrix():
@@ -224,14 +224,14 @@ class Routine:
 
     def buffers_first(self):
         """Determines which buffers go first (between alpha and beta) and which ones go after"""
-        if self.level == "2b" or self.name == "had":
+        if self.level == "2b" or self.name in ["had", "axpydot", "axpynrm2", "axpy2"]:
             return ["x", "y"]
         extra_buffer = "col" if self.name == "col2im" else "im"
         return ["ap", "a", "b", "x", extra_buffer, "kernel"]
 
     def buffers_second(self):
-        if self.level == "2b" or self.name == "had":
-            return ["z", "ap", "a", "b", "c"]
+        if self.level == "2b" or self.name in ["had", "axpydot", "axpynrm2", "axpy2"]:
+            return ["z", "w", "ap", "a", "b", "c"]
         extra_buffer = "im" if self.name == "col2im" else "col"
         return ["y", "c", extra_buffer, "result"]
 
@@ -833,13 +833,12 @@ class Routine:
             for buf in buffers:
                 if buf in self.buffers_matrix():
                     result.append(buf + "_ld")
+            if self.batched == 2:  # strided batched
+                for buf in buffers:
+                    result.append(buf + "_stride")
             for buf in buffers:
                 if buf in self.buffers_vector():
                     result.append(buf + "_inc = 1")
-            if self.batched == 2:  # strided batched
-                for buf in buffers:
-                    if buf in self.buffers_matrix():
-                        result.append(buf + "_stride")
             for scalar in self.scalars:
                 if scalar != "":
                     default = "1.0" if scalar == "alpha" else "0.0"
@@ -851,8 +850,7 @@ class Routine:
                 if buf in self.buffers_matrix():
                     result.append(buf + "_ld")
             for buf in buffers:
-                if buf in self.buffers_vector() + self.buffers_matrix():
-                    result.append(buf + "_offsets")
+                result.append(buf + "_offsets")
             for buf in buffers:
                 if buf in self.buffers_vector():
                     result.append(buf + "_inc = 1")
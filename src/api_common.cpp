@@ -24,6 +24,7 @@ StatusCode ClearCache() {
   try {
     ProgramCache::Instance().Invalidate();
     BinaryCache::Instance().Invalidate();
+    SyncBufferCache::Instance().Invalidate();
   } catch (...) { return DispatchException(); }
   return StatusCode::kSuccess;
 }
@@ -123,6 +123,11 @@ template void ProgramCache::RemoveBySubset<1, 2>(const ProgramKey &); // precisi
 
 // =================================================================================================
 
+template class Cache<SyncBufferKey, std::shared_ptr<Buffer<int>>>;
+template std::shared_ptr<Buffer<int>> SyncBufferCache::Get(const SyncBufferKeyRef &, bool *) const;
+
+// =================================================================================================
+
 template class Cache<DatabaseKey, Database>;
 template Database DatabaseCache::Get(const DatabaseKeyRef &, bool *) const;
 
@@ -90,6 +90,20 @@ extern template std::shared_ptr<Program> ProgramCache::Get(const ProgramKeyRef &
 
 // =================================================================================================
 
+// The key struct for the cache of small buffers with which the work-groups of a single kernel
+// launch synchronise (e.g. ticket counters). The kernels leave these zeroed when they finish, such
+// that they are cleared only once when created. They are queue-specific, since kernels on different
+// queues may run concurrently. Order of fields: context, queue, name (smaller fields first)
+typedef std::tuple<RawContext, RawCommandQueue, std::string> SyncBufferKey;
+typedef std::tuple<const RawContext &, const RawCommandQueue &, const std::string &> SyncBufferKeyRef;
+
+typedef Cache<SyncBufferKey, std::shared_ptr<Buffer<int>>> SyncBufferCache;
+
+extern template class Cache<SyncBufferKey, std::shared_ptr<Buffer<int>>>;
+extern template std::shared_ptr<Buffer<int>> SyncBufferCache::Get(const SyncBufferKeyRef &, bool *) const;
+
+// =================================================================================================
+
 class Database;
 
 // The key struct for the cache of database maps.
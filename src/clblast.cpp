@@ -26,12 +26,20 @@ namespace clblast {
 
 // Generate givens plane rotation: SROTG/DROTG
 template <typename T>
-StatusCode Rotg(cl_mem, const size_t,
-                cl_mem, const size_t,
-                cl_mem, const size_t,
-                cl_mem, const size_t,
-                cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotg(cl_mem sa_buffer, const size_t sa_offset,
+                cl_mem sb_buffer, const size_t sb_offset,
+                cl_mem sc_buffer, const size_t sc_offset,
+                cl_mem ss_buffer, const size_t ss_offset,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrotg<T>(queue_cpp, event);
+    routine.DoRotg(Buffer<T>(sa_buffer), sa_offset,
+                   Buffer<T>(sb_buffer), sb_offset,
+                   Buffer<T>(sc_buffer), sc_offset,
+                   Buffer<T>(ss_buffer), ss_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rotg<float>(cl_mem, const size_t,
                                            cl_mem, const size_t,
@@ -46,13 +54,22 @@ template StatusCode PUBLIC_API Rotg<double>(cl_mem, const size_t,
 
 // Generate modified givens plane rotation: SROTMG/DROTMG
 template <typename T>
-StatusCode Rotmg(cl_mem, const size_t,
-                 cl_mem, const size_t,
-                 cl_mem, const size_t,
-                 const cl_mem, const size_t,
-                 cl_mem, const size_t,
-                 cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotmg(cl_mem sd1_buffer, const size_t sd1_offset,
+                 cl_mem sd2_buffer, const size_t sd2_offset,
+                 cl_mem sx1_buffer, const size_t sx1_offset,
+                 const cl_mem sy1_buffer, const size_t sy1_offset,
+                 cl_mem sparam_buffer, const size_t sparam_offset,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrotmg<T>(queue_cpp, event);
+    routine.DoRotmg(Buffer<T>(sd1_buffer), sd1_offset,
+                    Buffer<T>(sd2_buffer), sd2_offset,
+                    Buffer<T>(sx1_buffer), sx1_offset,
+                    Buffer<T>(sy1_buffer), sy1_offset,
+                    Buffer<T>(sparam_buffer), sparam_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rotmg<float>(cl_mem, const size_t,
                                             cl_mem, const size_t,
@@ -69,13 +86,22 @@ template StatusCode PUBLIC_API Rotmg<double>(cl_mem, const size_t,
 
 // Apply givens plane rotation: SROT/DROT
 template <typename T>
-StatusCode Rot(const size_t,
-               cl_mem, const size_t, const size_t,
-               cl_mem, const size_t, const size_t,
-               const T,
-               const T,
-               cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rot(const size_t n,
+               cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+               const T cos,
+               const T sin,
+               cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrot<T>(queue_cpp, event);
+    routine.DoRot(n,
+                  Buffer<T>(x_buffer), x_offset, x_inc,
+                  Buffer<T>(y_buffer), y_offset, y_inc,
+                  cos,
+                  sin);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rot<float>(const size_t,
                                           cl_mem, const size_t, const size_t,
@@ -92,12 +118,20 @@ template StatusCode PUBLIC_API Rot<double>(const size_t,
 
 // Apply modified givens plane rotation: SROTM/DROTM
 template <typename T>
-StatusCode Rotm(const size_t,
-                cl_mem, const size_t, const size_t,
-                cl_mem, const size_t, const size_t,
-                cl_mem, const size_t,
-                cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotm(const size_t n,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                cl_mem sparam_buffer, const size_t sparam_offset,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xrotm<T>(queue_cpp, event);
+    routine.DoRotm(n,
+                   Buffer<T>(x_buffer), x_offset, x_inc,
+                   Buffer<T>(y_buffer), y_offset, y_inc,
+                   Buffer<T>(sparam_buffer), sparam_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rotm<float>(const size_t,
                                            cl_mem, const size_t, const size_t,
@@ -1167,12 +1201,20 @@ template StatusCode PUBLIC_API Trsv<double2>(const Layout, const Triangle, const
 
 // Solves a banded triangular system of equations: STBSV/DTBSV/CTBSV/ZTBSV
 template <typename T>
-StatusCode Tbsv(const Layout, const Triangle, const Transpose, const Diagonal,
-                const size_t, const size_t,
-                const cl_mem, const size_t, const size_t,
-                cl_mem, const size_t, const size_t,
-                cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Tbsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n, const size_t k,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xtbsv<T>(queue_cpp, event);
+    routine.DoTbsv(layout, triangle, a_transpose, diagonal,
+                   n, k,
+                   Buffer<T>(a_buffer), a_offset, a_ld,
+                   Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Tbsv<float>(const Layout, const Triangle, const Transpose, const Diagonal,
                                            const size_t, const size_t,
@@ -1197,12 +1239,20 @@ template StatusCode PUBLIC_API Tbsv<double2>(const Layout, const Triangle, const
 
 // Solves a packed triangular system of equations: STPSV/DTPSV/CTPSV/ZTPSV
 template <typename T>
-StatusCode Tpsv(const Layout, const Triangle, const Transpose, const Diagonal,
-                const size_t,
-                const cl_mem, const size_t,
-                cl_mem, const size_t, const size_t,
-                cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Tpsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n,
+                const cl_mem ap_buffer, const size_t ap_offset,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xtpsv<T>(queue_cpp, event);
+    routine.DoTpsv(layout, triangle, a_transpose, diagonal,
+                   n,
+                   Buffer<T>(ap_buffer), ap_offset,
+                   Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Tpsv<float>(const Layout, const Triangle, const Transpose, const Diagonal,
                                            const size_t,
@@ -2166,6 +2216,249 @@ template StatusCode PUBLIC_API Had<half>(const size_t,
                                          cl_mem, const size_t, const size_t,
                                          cl_command_queue*, cl_event*);
 
+// Vector-times-constant plus scaled vector: SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+template <typename T>
+StatusCode Axpby(const size_t n,
+                 const T alpha,
+                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta,
+                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xaxpby<T>(queue_cpp, event);
+    routine.DoAxpby(n,
+                    alpha,
+                    Buffer<T>(x_buffer), x_offset, x_inc,
+                    beta,
+                    Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Axpby<float>(const size_t,
+                                            const float,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpby<double>(const size_t,
+                                             const double,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpby<float2>(const size_t,
+                                             const float2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const float2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpby<double2>(const size_t,
+                                              const double2,
+                                              const cl_mem, const size_t, const size_t,
+                                              const double2,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpby<half>(const size_t,
+                                           const half,
+                                           const cl_mem, const size_t, const size_t,
+                                           const half,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+
+// Sets all elements of a vector to a constant: SSET/DSET/CSET/ZSET/HSET
+template <typename T>
+StatusCode Set(const size_t n,
+               const T alpha,
+               cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+               cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xset<T>(queue_cpp, event);
+    routine.DoSet(n,
+                  alpha,
+                  Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Set<float>(const size_t,
+                                          const float,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Set<double>(const size_t,
+                                           const double,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Set<float2>(const size_t,
+                                           const float2,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Set<double2>(const size_t,
+                                            const double2,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Set<half>(const size_t,
+                                         const half,
+                                         cl_mem, const size_t, const size_t,
+                                         cl_command_queue*, cl_event*);
+
+// Two fused vector-times-constant plus vector operations: SAXPY2/DAXPY2/CAXPY2/ZAXPY2/HAXPY2
+template <typename T>
+StatusCode Axpy2(const size_t n,
+                 const T alpha,
+                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                 const T beta,
+                 const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                 cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xaxpy2<T>(queue_cpp, event);
+    routine.DoAxpy2(n,
+                    alpha,
+                    Buffer<T>(x_buffer), x_offset, x_inc,
+                    Buffer<T>(y_buffer), y_offset, y_inc,
+                    beta,
+                    Buffer<T>(z_buffer), z_offset, z_inc,
+                    Buffer<T>(w_buffer), w_offset, w_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Axpy2<float>(const size_t,
+                                            const float,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            const float,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpy2<double>(const size_t,
+                                             const double,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             const double,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpy2<float2>(const size_t,
+                                             const float2,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             const float2,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpy2<double2>(const size_t,
+                                              const double2,
+                                              const cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              const double2,
+                                              const cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpy2<half>(const size_t,
+                                           const half,
+                                           const cl_mem, const size_t, const size_t,
+                                           cl_mem, const size_t, const size_t,
+                                           const half,
+                                           const cl_mem, const size_t, const size_t,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+
+// Fused vector update and dot product: SAXPYDOT/DAXPYDOT/HAXPYDOT
+template <typename T>
+StatusCode Axpydot(const size_t n,
+                   cl_mem dot_buffer, const size_t dot_offset,
+                   const T alpha,
+                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                   const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                   cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xaxpydot<T>(queue_cpp, event);
+    routine.DoAxpydot(n,
+                      Buffer<T>(dot_buffer), dot_offset,
+                      alpha,
+                      Buffer<T>(x_buffer), x_offset, x_inc,
+                      Buffer<T>(y_buffer), y_offset, y_inc,
+                      Buffer<T>(z_buffer), z_offset, z_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Axpydot<float>(const size_t,
+                                              cl_mem, const size_t,
+                                              const float,
+                                              const cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              const cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpydot<double>(const size_t,
+                                               cl_mem, const size_t,
+                                               const double,
+                                               const cl_mem, const size_t, const size_t,
+                                               cl_mem, const size_t, const size_t,
+                                               const cl_mem, const size_t, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpydot<half>(const size_t,
+                                             cl_mem, const size_t,
+                                             const half,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+
+// Fused vector update and Euclidian norm: SAXPYNRM2/DAXPYNRM2/CAXPYNRM2/ZAXPYNRM2/HAXPYNRM2
+template <typename T>
+StatusCode Axpynrm2(const size_t n,
+                    cl_mem nrm2_buffer, const size_t nrm2_offset,
+                    const T alpha,
+                    const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                    cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                    cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xaxpynrm2<T>(queue_cpp, event);
+    routine.DoAxpynrm2(n,
+                       Buffer<T>(nrm2_buffer), nrm2_offset,
+                       alpha,
+                       Buffer<T>(x_buffer), x_offset, x_inc,
+                       Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Axpynrm2<float>(const size_t,
+                                               cl_mem, const size_t,
+                                               const float,
+                                               const cl_mem, const size_t, const size_t,
+                                               cl_mem, const size_t, const size_t,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpynrm2<double>(const size_t,
+                                                cl_mem, const size_t,
+                                                const double,
+                                                const cl_mem, const size_t, const size_t,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpynrm2<float2>(const size_t,
+                                                cl_mem, const size_t,
+                                                const float2,
+                                                const cl_mem, const size_t, const size_t,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpynrm2<double2>(const size_t,
+                                                 cl_mem, const size_t,
+                                                 const double2,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpynrm2<half>(const size_t,
+                                              cl_mem, const size_t,
+                                              const half,
+                                              const cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 template <typename T>
 StatusCode Omatcopy(const Layout layout, const Transpose a_transpose,
@@ -2398,56 +2691,172 @@ template StatusCode PUBLIC_API AxpyBatched<half>(const size_t,
                                                  const size_t,
                                                  cl_command_queue*, cl_event*);
 
-// Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
+// Batched version of AXPBY: SAXPBYBATCHED/DAXPBYBATCHED/CAXPBYBATCHED/ZAXPBYBATCHED/HAXPBYBATCHED
 template <typename T>
-StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
-                       const size_t m, const size_t n, const size_t k,
-                       const T *alphas,
-                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
-                       const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
-                       const T *betas,
-                       cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld,
-                       const size_t batch_count,
-                       cl_command_queue* queue, cl_event* event) {
+StatusCode AxpbyBatched(const size_t n,
+                        const T *alphas,
+                        const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                        const T *betas,
+                        cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                        const size_t batch_count,
+                        cl_command_queue* queue, cl_event* event) {
   try {
     auto queue_cpp = Queue(*queue);
-    auto routine = XgemmBatched<T>(queue_cpp, event);
+    auto routine = XaxpbyBatched<T>(queue_cpp, event);
     auto alphas_cpp = std::vector<T>();
     auto betas_cpp = std::vector<T>();
-    auto a_offsets_cpp = std::vector<size_t>();
-    auto b_offsets_cpp = std::vector<size_t>();
-    auto c_offsets_cpp = std::vector<size_t>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
     for (auto batch = size_t{0}; batch < batch_count; ++batch) {
       alphas_cpp.push_back(alphas[batch]);
       betas_cpp.push_back(betas[batch]);
-      a_offsets_cpp.push_back(a_offsets[batch]);
-      b_offsets_cpp.push_back(b_offsets[batch]);
-      c_offsets_cpp.push_back(c_offsets[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
     }
-    routine.DoGemmBatched(layout, a_transpose, b_transpose,
-                          m, n, k,
-                          alphas_cpp,
-                          Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
-                          Buffer<T>(b_buffer), b_offsets_cpp, b_ld,
-                          betas_cpp,
-                          Buffer<T>(c_buffer), c_offsets_cpp, c_ld,
-                          batch_count);
+    routine.DoAxpbyBatched(n,
+                           alphas_cpp,
+                           Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                           betas_cpp,
+                           Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
+                           batch_count);
     return StatusCode::kSuccess;
   } catch (...) { return DispatchException(); }
 }
-template StatusCode PUBLIC_API GemmBatched<float>(const Layout, const Transpose, const Transpose,
-                                                  const size_t, const size_t, const size_t,
-                                                  const float*,
-                                                  const cl_mem, const size_t*, const size_t,
-                                                  const cl_mem, const size_t*, const size_t,
-                                                  const float*,
-                                                  cl_mem, const size_t*, const size_t,
-                                                  const size_t,
-                                                  cl_command_queue*, cl_event*);
-template StatusCode PUBLIC_API GemmBatched<double>(const Layout, const Transpose, const Transpose,
-                                                   const size_t, const size_t, const size_t,
-                                                   const double*,
-                                                   const cl_mem, const size_t*, const size_t,
+template StatusCode PUBLIC_API AxpbyBatched<float>(const size_t,
+                                                   const float*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const float*,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpbyBatched<double>(const size_t,
+                                                    const double*,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    const double*,
+                                                    cl_mem, const size_t*, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpbyBatched<float2>(const size_t,
+                                                    const float2*,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    const float2*,
+                                                    cl_mem, const size_t*, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpbyBatched<double2>(const size_t,
+                                                     const double2*,
+                                                     const cl_mem, const size_t*, const size_t,
+                                                     const double2*,
+                                                     cl_mem, const size_t*, const size_t,
+                                                     const size_t,
+                                                     cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpbyBatched<half>(const size_t,
+                                                  const half*,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const half*,
+                                                  cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+
+// Batched version of SET: SSETBATCHED/DSETBATCHED/CSETBATCHED/ZSETBATCHED/HSETBATCHED
+template <typename T>
+StatusCode SetBatched(const size_t n,
+                      const T *alphas,
+                      cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                      const size_t batch_count,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XsetBatched<T>(queue_cpp, event);
+    auto alphas_cpp = std::vector<T>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+    }
+    routine.DoSetBatched(n,
+                         alphas_cpp,
+                         Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                         batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API SetBatched<float>(const size_t,
+                                                 const float*,
+                                                 cl_mem, const size_t*, const size_t,
+                                                 const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SetBatched<double>(const size_t,
+                                                  const double*,
+                                                  cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SetBatched<float2>(const size_t,
+                                                  const float2*,
+                                                  cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SetBatched<double2>(const size_t,
+                                                   const double2*,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API SetBatched<half>(const size_t,
+                                                const half*,
+                                                cl_mem, const size_t*, const size_t,
+                                                const size_t,
+                                                cl_command_queue*, cl_event*);
+
+// Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
+template <typename T>
+StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t m, const size_t n, const size_t k,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                       const T *betas,
+                       cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmBatched<T>(queue_cpp, event);
+    auto alphas_cpp = std::vector<T>();
+    auto betas_cpp = std::vector<T>();
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto b_offsets_cpp = std::vector<size_t>();
+    auto c_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      betas_cpp.push_back(betas[batch]);
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      b_offsets_cpp.push_back(b_offsets[batch]);
+      c_offsets_cpp.push_back(c_offsets[batch]);
+    }
+    routine.DoGemmBatched(layout, a_transpose, b_transpose,
+                          m, n, k,
+                          alphas_cpp,
+                          Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                          Buffer<T>(b_buffer), b_offsets_cpp, b_ld,
+                          betas_cpp,
+                          Buffer<T>(c_buffer), c_offsets_cpp, c_ld,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmBatched<float>(const Layout, const Transpose, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const float*,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const float*,
+                                                  cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatched<double>(const Layout, const Transpose, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const double*,
+                                                   const cl_mem, const size_t*, const size_t,
                                                    const cl_mem, const size_t*, const size_t,
                                                    const double*,
                                                    cl_mem, const size_t*, const size_t,
@@ -2552,6 +2961,1284 @@ template StatusCode PUBLIC_API GemmStridedBatched<half>(const Layout, const Tran
                                                         const size_t,
                                                         cl_command_queue*, cl_event*);
 
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+template <typename T>
+StatusCode GemvBatched(const Layout layout, const Transpose a_transpose,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const T *betas,
+                       cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemvBatched<T>(queue_cpp, event);
+    auto alphas_cpp = std::vector<T>();
+    auto betas_cpp = std::vector<T>();
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      betas_cpp.push_back(betas[batch]);
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+    }
+    routine.DoGemvBatched(layout, a_transpose,
+                          m, n,
+                          alphas_cpp,
+                          Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                          Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                          betas_cpp,
+                          Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvBatched<float>(const Layout, const Transpose,
+                                                  const size_t, const size_t,
+                                                  const float*,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const float*,
+                                                  cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<double>(const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const double*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const double*,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<float2>(const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const float2*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const float2*,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<double2>(const Layout, const Transpose,
+                                                    const size_t, const size_t,
+                                                    const double2*,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    const double2*,
+                                                    cl_mem, const size_t*, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvBatched<half>(const Layout, const Transpose,
+                                                 const size_t, const size_t,
+                                                 const half*,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const half*,
+                                                 cl_mem, const size_t*, const size_t,
+                                                 const size_t,
+                                                 cl_command_queue*, cl_event*);
+
+// StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+template <typename T>
+StatusCode GemvStridedBatched(const Layout layout, const Transpose a_transpose,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const T beta,
+                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemvStridedBatched<T>(queue_cpp, event);
+    routine.DoGemvStridedBatched(layout, a_transpose,
+                                 m, n,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 beta,
+                                 Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvStridedBatched<float>(const Layout, const Transpose,
+                                                         const size_t, const size_t,
+                                                         const float,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const float,
+                                                         cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<double>(const Layout, const Transpose,
+                                                          const size_t, const size_t,
+                                                          const double,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const double,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<float2>(const Layout, const Transpose,
+                                                          const size_t, const size_t,
+                                                          const float2,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const float2,
+                                                          cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<double2>(const Layout, const Transpose,
+                                                           const size_t, const size_t,
+                                                           const double2,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const double2,
+                                                           cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvStridedBatched<half>(const Layout, const Transpose,
+                                                        const size_t, const size_t,
+                                                        const half,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const half,
+                                                        cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// Batched version of DOT: SDOTBATCHED/DDOTBATCHED/HDOTBATCHED
+template <typename T>
+StatusCode DotBatched(const size_t n,
+                      cl_mem dot_buffer, const size_t *dot_offsets,
+                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                      const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                      const size_t batch_count,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XdotBatched<T>(queue_cpp, event);
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    auto dot_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+      dot_offsets_cpp.push_back(dot_offsets[batch]);
+    }
+    routine.DoDotBatched(n,
+                         Buffer<T>(dot_buffer), dot_offsets_cpp,
+                         Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                         Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
+                         batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API DotBatched<float>(const size_t,
+                                                 cl_mem, const size_t*,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DotBatched<double>(const size_t,
+                                                  cl_mem, const size_t*,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DotBatched<half>(const size_t,
+                                                cl_mem, const size_t*,
+                                                const cl_mem, const size_t*, const size_t,
+                                                const cl_mem, const size_t*, const size_t,
+                                                const size_t,
+                                                cl_command_queue*, cl_event*);
+
+// StridedBatched version of DOT: SDOTSTRIDEDBATCHED/DDOTSTRIDEDBATCHED/HDOTSTRIDEDBATCHED
+template <typename T>
+StatusCode DotStridedBatched(const size_t n,
+                             cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                             const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                             const size_t batch_count,
+                             cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XdotStridedBatched<T>(queue_cpp, event);
+    routine.DoDotStridedBatched(n,
+                                Buffer<T>(dot_buffer), dot_offset, dot_stride,
+                                Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                                batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API DotStridedBatched<float>(const size_t,
+                                                        cl_mem, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DotStridedBatched<double>(const size_t,
+                                                         cl_mem, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API DotStridedBatched<half>(const size_t,
+                                                       cl_mem, const size_t, const size_t,
+                                                       const cl_mem, const size_t, const size_t, const size_t,
+                                                       const cl_mem, const size_t, const size_t, const size_t,
+                                                       const size_t,
+                                                       cl_command_queue*, cl_event*);
+
+// Batched version of NRM2: SNRM2BATCHED/DNRM2BATCHED/ScNRM2BATCHED/DzNRM2BATCHED/HNRM2BATCHED
+template <typename T>
+StatusCode Nrm2Batched(const size_t n,
+                       cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xnrm2Batched<T>(queue_cpp, event);
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto nrm2_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      nrm2_offsets_cpp.push_back(nrm2_offsets[batch]);
+    }
+    routine.DoNrm2Batched(n,
+                          Buffer<T>(nrm2_buffer), nrm2_offsets_cpp,
+                          Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Nrm2Batched<float>(const size_t,
+                                                  cl_mem, const size_t*,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2Batched<double>(const size_t,
+                                                   cl_mem, const size_t*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2Batched<float2>(const size_t,
+                                                   cl_mem, const size_t*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2Batched<double2>(const size_t,
+                                                    cl_mem, const size_t*,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2Batched<half>(const size_t,
+                                                 cl_mem, const size_t*,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const size_t,
+                                                 cl_command_queue*, cl_event*);
+
+// StridedBatched version of NRM2: SNRM2STRIDEDBATCHED/DNRM2STRIDEDBATCHED/ScNRM2STRIDEDBATCHED/DzNRM2STRIDEDBATCHED/HNRM2STRIDEDBATCHED
+template <typename T>
+StatusCode Nrm2StridedBatched(const size_t n,
+                              cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xnrm2StridedBatched<T>(queue_cpp, event);
+    routine.DoNrm2StridedBatched(n,
+                                 Buffer<T>(nrm2_buffer), nrm2_offset, nrm2_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Nrm2StridedBatched<float>(const size_t,
+                                                         cl_mem, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2StridedBatched<double>(const size_t,
+                                                          cl_mem, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2StridedBatched<float2>(const size_t,
+                                                          cl_mem, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2StridedBatched<double2>(const size_t,
+                                                           cl_mem, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Nrm2StridedBatched<half>(const size_t,
+                                                        cl_mem, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// Batched version of ASUM: SASUMBATCHED/DASUMBATCHED/ScASUMBATCHED/DzASUMBATCHED/HASUMBATCHED
+template <typename T>
+StatusCode AsumBatched(const size_t n,
+                       cl_mem asum_buffer, const size_t *asum_offsets,
+                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const size_t batch_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XasumBatched<T>(queue_cpp, event);
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto asum_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      asum_offsets_cpp.push_back(asum_offsets[batch]);
+    }
+    routine.DoAsumBatched(n,
+                          Buffer<T>(asum_buffer), asum_offsets_cpp,
+                          Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AsumBatched<float>(const size_t,
+                                                  cl_mem, const size_t*,
+                                                  const cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumBatched<double>(const size_t,
+                                                   cl_mem, const size_t*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumBatched<float2>(const size_t,
+                                                   cl_mem, const size_t*,
+                                                   const cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumBatched<double2>(const size_t,
+                                                    cl_mem, const size_t*,
+                                                    const cl_mem, const size_t*, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumBatched<half>(const size_t,
+                                                 cl_mem, const size_t*,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const size_t,
+                                                 cl_command_queue*, cl_event*);
+
+// StridedBatched version of ASUM: SASUMSTRIDEDBATCHED/DASUMSTRIDEDBATCHED/ScASUMSTRIDEDBATCHED/DzASUMSTRIDEDBATCHED/HASUMSTRIDEDBATCHED
+template <typename T>
+StatusCode AsumStridedBatched(const size_t n,
+                              cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XasumStridedBatched<T>(queue_cpp, event);
+    routine.DoAsumStridedBatched(n,
+                                 Buffer<T>(asum_buffer), asum_offset, asum_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AsumStridedBatched<float>(const size_t,
+                                                         cl_mem, const size_t, const size_t,
+                                                         const cl_mem, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumStridedBatched<double>(const size_t,
+                                                          cl_mem, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumStridedBatched<float2>(const size_t,
+                                                          cl_mem, const size_t, const size_t,
+                                                          const cl_mem, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumStridedBatched<double2>(const size_t,
+                                                           cl_mem, const size_t, const size_t,
+                                                           const cl_mem, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AsumStridedBatched<half>(const size_t,
+                                                        cl_mem, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Grouped version of GEMM: SGEMMGROUPED/DGEMMGROUPED/CGEMMGROUPED/ZGEMMGROUPED/HGEMMGROUPED
+template <typename T>
+StatusCode GemmGrouped(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t *ms, const size_t *ns, const size_t *ks,
+                       const T *alphas,
+                       const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                       const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                       const T *betas,
+                       cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                       const size_t group_count,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmGrouped<T>(queue_cpp, event);
+    routine.DoGemmGrouped(layout, a_transpose, b_transpose,
+                          std::vector<size_t>(ms, ms + group_count),
+                          std::vector<size_t>(ns, ns + group_count),
+                          std::vector<size_t>(ks, ks + group_count),
+                          std::vector<T>(alphas, alphas + group_count),
+                          Buffer<T>(a_buffer), std::vector<size_t>(a_offsets, a_offsets + group_count),
+                          std::vector<size_t>(a_lds, a_lds + group_count),
+                          Buffer<T>(b_buffer), std::vector<size_t>(b_offsets, b_offsets + group_count),
+                          std::vector<size_t>(b_lds, b_lds + group_count),
+                          std::vector<T>(betas, betas + group_count),
+                          Buffer<T>(c_buffer), std::vector<size_t>(c_offsets, c_offsets + group_count),
+                          std::vector<size_t>(c_lds, c_lds + group_count),
+                          group_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmGrouped<float>(const Layout, const Transpose, const Transpose,
+                                                  const size_t*, const size_t*, const size_t*,
+                                                  const float*,
+                                                  const cl_mem, const size_t*, const size_t*,
+                                                  const cl_mem, const size_t*, const size_t*,
+                                                  const float*,
+                                                  cl_mem, const size_t*, const size_t*,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGrouped<double>(const Layout, const Transpose, const Transpose,
+                                                   const size_t*, const size_t*, const size_t*,
+                                                   const double*,
+                                                   const cl_mem, const size_t*, const size_t*,
+                                                   const cl_mem, const size_t*, const size_t*,
+                                                   const double*,
+                                                   cl_mem, const size_t*, const size_t*,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGrouped<float2>(const Layout, const Transpose, const Transpose,
+                                                   const size_t*, const size_t*, const size_t*,
+                                                   const float2*,
+                                                   const cl_mem, const size_t*, const size_t*,
+                                                   const cl_mem, const size_t*, const size_t*,
+                                                   const float2*,
+                                                   cl_mem, const size_t*, const size_t*,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGrouped<double2>(const Layout, const Transpose, const Transpose,
+                                                    const size_t*, const size_t*, const size_t*,
+                                                    const double2*,
+                                                    const cl_mem, const size_t*, const size_t*,
+                                                    const cl_mem, const size_t*, const size_t*,
+                                                    const double2*,
+                                                    cl_mem, const size_t*, const size_t*,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmGrouped<half>(const Layout, const Transpose, const Transpose,
+                                                 const size_t*, const size_t*, const size_t*,
+                                                 const half*,
+                                                 const cl_mem, const size_t*, const size_t*,
+                                                 const cl_mem, const size_t*, const size_t*,
+                                                 const half*,
+                                                 cl_mem, const size_t*, const size_t*,
+                                                 const size_t,
+                                                 cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Internal representation of a packed matrix: the packed device buffer plus all the arguments and
+// tuning parameters it was packed for, such that any mismatch can be detected when it is used
+struct PackedMatrixData {
+  cl_mem buffer;
+  Precision precision;
+  cl_device_id device;
+  Layout layout;
+  Side side;
+  Transpose transpose;
+  size_t m;
+  size_t n;
+  size_t k;
+  std::vector<size_t> parameters;
+};
+
+// Packs matrix A or B into the internal layout of the GEMM kernel
+template <typename T>
+StatusCode PackMatrix(const Layout layout, const Side side, const Transpose transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const cl_mem buffer, const size_t offset, const size_t ld,
+                      cl_command_queue* queue, PackedMatrix* packed, cl_event* event) {
+  try {
+    if (packed == nullptr) { throw BLASError(StatusCode::kInvalidPackedMatrix); }
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgemm<T>(queue_cpp, event);
+    const auto parameters = routine.GetPackingParameters();
+    const auto packed_size = Xgemm<T>::GetPackedSize(side, (side == Side::kLeft) ? m : 1,
+                                                     (side == Side::kLeft) ? 1 : n, k,
+                                                     parameters[0], parameters[1], parameters[2],
+                                                     parameters[3]);
+
+    // The buffer is not owned by the C++ object, it is released in 'ReleasePackedMatrix' instead
+    const auto context = queue_cpp.GetContext();
+    auto packed_buffer = Buffer<T>(context, BufferAccess::kNotOwned, packed_size);
+    try {
+      routine.DoPackMatrix(layout, side, transpose, m, n, k,
+                           Buffer<T>(buffer), offset, ld, packed_buffer);
+    } catch (...) {
+      if (packed_buffer() != nullptr) { clReleaseMemObject(packed_buffer()); }
+      throw;
+    }
+    *packed = new PackedMatrixData{packed_buffer(), PrecisionValue<T>(), queue_cpp.GetDevice()(),
+                                   layout, side, transpose,
+                                   (side == Side::kLeft) ? m : 0, (side == Side::kLeft) ? 0 : n, k,
+                                   parameters};
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API PackMatrix<float>(const Layout, const Side, const Transpose,
+                                                 const size_t, const size_t, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, PackedMatrix*, cl_event*);
+template StatusCode PUBLIC_API PackMatrix<double>(const Layout, const Side, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, PackedMatrix*, cl_event*);
+template StatusCode PUBLIC_API PackMatrix<float2>(const Layout, const Side, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, PackedMatrix*, cl_event*);
+template StatusCode PUBLIC_API PackMatrix<double2>(const Layout, const Side, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, PackedMatrix*, cl_event*);
+template StatusCode PUBLIC_API PackMatrix<half>(const Layout, const Side, const Transpose,
+                                                const size_t, const size_t, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, PackedMatrix*, cl_event*);
+
+// Releases a packed matrix
+StatusCode ReleasePackedMatrix(PackedMatrix packed) {
+  try {
+    if (packed == nullptr) { throw BLASError(StatusCode::kInvalidPackedMatrix); }
+    CheckError(clReleaseMemObject(packed->buffer));
+    delete packed;
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+
+// Verifies whether a packed matrix was created for the current arguments and tuning parameters
+template <typename T>
+void TestPackedMatrix(const PackedMatrix packed, const Side side,
+                      const Layout layout, const Transpose transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const Device &device, const std::vector<size_t> &parameters) {
+  if (packed->precision != PrecisionValue<T>() || packed->device != device() ||
+      packed->side != side || packed->layout != layout || packed->transpose != transpose ||
+      packed->m != m || packed->n != n || packed->k != k || packed->parameters != parameters) {
+    throw BLASError(StatusCode::kInvalidPackedMatrix);
+  }
+}
+
+// GEMM with pre-packed matrices
+template <typename T>
+StatusCode GemmPacked(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const T alpha,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const PackedMatrix a_packed,
+                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const PackedMatrix b_packed,
+                      const T beta,
+                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgemm<T>(queue_cpp, event);
+    const auto device = queue_cpp.GetDevice();
+    const auto parameters = routine.GetPackingParameters();
+    const auto a_is_packed = a_packed != nullptr;
+    const auto b_is_packed = b_packed != nullptr;
+    if (a_is_packed) {
+      TestPackedMatrix<T>(a_packed, Side::kLeft, layout, a_transpose, m, 0, k, device, parameters);
+    }
+    if (b_is_packed) {
+      TestPackedMatrix<T>(b_packed, Side::kRight, layout, b_transpose, 0, n, k, device, parameters);
+    }
+    routine.DoGemm(layout, a_transpose, b_transpose,
+                   m, n, k,
+                   alpha,
+                   Buffer<T>((a_is_packed) ? a_packed->buffer : a_buffer),
+                   (a_is_packed) ? 0 : a_offset, a_ld,
+                   Buffer<T>((b_is_packed) ? b_packed->buffer : b_buffer),
+                   (b_is_packed) ? 0 : b_offset, b_ld,
+                   beta,
+                   Buffer<T>(c_buffer), c_offset, c_ld,
+                   Buffer<T>(nullptr), false,
+                   a_is_packed, b_is_packed);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmPacked<float>(const Layout, const Transpose, const Transpose,
+                                                 const size_t, const size_t, const size_t,
+                                                 const float,
+                                                 const cl_mem, const size_t, const size_t, const PackedMatrix,
+                                                 const cl_mem, const size_t, const size_t, const PackedMatrix,
+                                                 const float,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmPacked<double>(const Layout, const Transpose, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const double,
+                                                  const cl_mem, const size_t, const size_t, const PackedMatrix,
+                                                  const cl_mem, const size_t, const size_t, const PackedMatrix,
+                                                  const double,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmPacked<float2>(const Layout, const Transpose, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const float2,
+                                                  const cl_mem, const size_t, const size_t, const PackedMatrix,
+                                                  const cl_mem, const size_t, const size_t, const PackedMatrix,
+                                                  const float2,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmPacked<double2>(const Layout, const Transpose, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const double2,
+                                                   const cl_mem, const size_t, const size_t, const PackedMatrix,
+                                                   const cl_mem, const size_t, const size_t, const PackedMatrix,
+                                                   const double2,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmPacked<half>(const Layout, const Transpose, const Transpose,
+                                                const size_t, const size_t, const size_t,
+                                                const half,
+                                                const cl_mem, const size_t, const size_t, const PackedMatrix,
+                                                const cl_mem, const size_t, const size_t, const PackedMatrix,
+                                                const half,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Batched version of GEMM with device-resident arguments
+template <typename T>
+StatusCode GemmBatchedDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k,
+                             const cl_mem alphas_buffer,
+                             const cl_mem a_buffer, const cl_mem a_offsets_buffer, const size_t a_ld,
+                             const cl_mem b_buffer, const cl_mem b_offsets_buffer, const size_t b_ld,
+                             const cl_mem betas_buffer,
+                             cl_mem c_buffer, const cl_mem c_offsets_buffer, const size_t c_ld,
+                             const size_t batch_count,
+                             cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmBatched<T>(queue_cpp, event);
+    routine.DoGemmBatchedDevice(layout, a_transpose, b_transpose,
+                                m, n, k,
+                                Buffer<T>(alphas_buffer),
+                                Buffer<T>(a_buffer), Buffer<int>(a_offsets_buffer), a_ld,
+                                Buffer<T>(b_buffer), Buffer<int>(b_offsets_buffer), b_ld,
+                                Buffer<T>(betas_buffer),
+                                Buffer<T>(c_buffer), Buffer<int>(c_offsets_buffer), c_ld,
+                                batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmBatchedDevice<float>(const Layout, const Transpose, const Transpose,
+                                                        const size_t, const size_t, const size_t,
+                                                        const cl_mem,
+                                                        const cl_mem, const cl_mem, const size_t,
+                                                        const cl_mem, const cl_mem, const size_t,
+                                                        const cl_mem,
+                                                        cl_mem, const cl_mem, const size_t,
+                                                        const size_t,
+                                                        cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatchedDevice<double>(const Layout, const Transpose, const Transpose,
+                                                         const size_t, const size_t, const size_t,
+                                                         const cl_mem,
+                                                         const cl_mem, const cl_mem, const size_t,
+                                                         const cl_mem, const cl_mem, const size_t,
+                                                         const cl_mem,
+                                                         cl_mem, const cl_mem, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatchedDevice<float2>(const Layout, const Transpose, const Transpose,
+                                                         const size_t, const size_t, const size_t,
+                                                         const cl_mem,
+                                                         const cl_mem, const cl_mem, const size_t,
+                                                         const cl_mem, const cl_mem, const size_t,
+                                                         const cl_mem,
+                                                         cl_mem, const cl_mem, const size_t,
+                                                         const size_t,
+                                                         cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatchedDevice<double2>(const Layout, const Transpose, const Transpose,
+                                                          const size_t, const size_t, const size_t,
+                                                          const cl_mem,
+                                                          const cl_mem, const cl_mem, const size_t,
+                                                          const cl_mem, const cl_mem, const size_t,
+                                                          const cl_mem,
+                                                          cl_mem, const cl_mem, const size_t,
+                                                          const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatchedDevice<half>(const Layout, const Transpose, const Transpose,
+                                                       const size_t, const size_t, const size_t,
+                                                       const cl_mem,
+                                                       const cl_mem, const cl_mem, const size_t,
+                                                       const cl_mem, const cl_mem, const size_t,
+                                                       const cl_mem,
+                                                       cl_mem, const cl_mem, const size_t,
+                                                       const size_t,
+                                                       cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Strassen-Winograd version of GEMM
+template <typename T>
+StatusCode GemmStrassen(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                        const size_t m, const size_t n, const size_t k,
+                        const T alpha,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                        const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                        const T beta,
+                        cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                        cl_command_queue* queue, cl_event* event,
+                        cl_mem temp_buffer) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = XgemmStrassen<T>(queue_cpp, event);
+    const auto temp_buffer_provided = temp_buffer != nullptr;
+    auto temp_buffer_cpp = temp_buffer_provided ? Buffer<T>(temp_buffer) : Buffer<T>(nullptr);
+    routine.DoGemmStrassen(layout, a_transpose, b_transpose,
+                           m, n, k,
+                           alpha,
+                           Buffer<T>(a_buffer), a_offset, a_ld,
+                           Buffer<T>(b_buffer), b_offset, b_ld,
+                           beta,
+                           Buffer<T>(c_buffer), c_offset, c_ld,
+                           temp_buffer_cpp, temp_buffer_provided);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmStrassen<float>(const Layout, const Transpose, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const float,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const float,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*, cl_mem);
+template StatusCode PUBLIC_API GemmStrassen<double>(const Layout, const Transpose, const Transpose,
+                                                    const size_t, const size_t, const size_t,
+                                                    const double,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const double,
+                                                    cl_mem, const size_t, const size_t,
+                                                    cl_command_queue*, cl_event*, cl_mem);
+template StatusCode PUBLIC_API GemmStrassen<float2>(const Layout, const Transpose, const Transpose,
+                                                    const size_t, const size_t, const size_t,
+                                                    const float2,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const float2,
+                                                    cl_mem, const size_t, const size_t,
+                                                    cl_command_queue*, cl_event*, cl_mem);
+template StatusCode PUBLIC_API GemmStrassen<double2>(const Layout, const Transpose, const Transpose,
+                                                     const size_t, const size_t, const size_t,
+                                                     const double2,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     const double2,
+                                                     cl_mem, const size_t, const size_t,
+                                                     cl_command_queue*, cl_event*, cl_mem);
+template StatusCode PUBLIC_API GemmStrassen<half>(const Layout, const Transpose, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const half,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const half,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*, cl_mem);
+
+// Retrieves the required size of the temporary buffer for the Strassen-Winograd GEMM
+template <typename T>
+StatusCode GemmStrassenTempBufferSize(const size_t m, const size_t n, const size_t k,
+                                      cl_command_queue* queue, size_t& temp_buffer_size) {
+  try {
+
+    // Retrieves the tuning database
+    const auto queue_cpp = Queue(*queue);
+    const auto device = queue_cpp.GetDevice();
+    const auto kernel_names = std::vector<std::string>{"GemmStrassen"};
+    Databases db(kernel_names);
+    Routine::InitDatabase(device, kernel_names, PrecisionValue<T>(), {}, db);
+
+    // Computes the buffer size
+    temp_buffer_size = XgemmStrassen<T>::GetTempSize(m, n, k, db["XGEMM_STRASSEN_MIN_SIZE"],
+                                                     db["XGEMM_STRASSEN_MAX_DEPTH"]);
+    temp_buffer_size *= sizeof(T); // translate from num-elements to bytes
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmStrassenTempBufferSize<float>(const size_t, const size_t, const size_t,
+                                                                 cl_command_queue*, size_t&);
+template StatusCode PUBLIC_API GemmStrassenTempBufferSize<double>(const size_t, const size_t, const size_t,
+                                                                  cl_command_queue*, size_t&);
+template StatusCode PUBLIC_API GemmStrassenTempBufferSize<float2>(const size_t, const size_t, const size_t,
+                                                                  cl_command_queue*, size_t&);
+template StatusCode PUBLIC_API GemmStrassenTempBufferSize<double2>(const size_t, const size_t, const size_t,
+                                                                   cl_command_queue*, size_t&);
+template StatusCode PUBLIC_API GemmStrassenTempBufferSize<half>(const size_t, const size_t, const size_t,
+                                                                cl_command_queue*, size_t&);
+
+// =================================================================================================
+
+// Cholesky factorization
+template <typename T>
+StatusCode Potrf(const Layout layout, const Triangle triangle,
+                 const size_t n,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_mem info_buffer, const size_t info_offset,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xpotrf<T>(queue_cpp, event);
+    routine.DoPotrf(layout, triangle,
+                    n,
+                    Buffer<T>(a_buffer), a_offset, a_ld,
+                    Buffer<int>(info_buffer), info_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Potrf<float>(const Layout, const Triangle,
+                                            const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Potrf<double>(const Layout, const Triangle,
+                                             const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Potrf<float2>(const Layout, const Triangle,
+                                             const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Potrf<double2>(const Layout, const Triangle,
+                                              const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t,
+                                              cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// LU factorization with partial pivoting
+template <typename T>
+StatusCode Getrf(const Layout layout,
+                 const size_t m, const size_t n,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_mem ipiv_buffer, const size_t ipiv_offset,
+                 cl_mem info_buffer, const size_t info_offset,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgetrf<T>(queue_cpp, event);
+    routine.DoGetrf(layout,
+                    m, n,
+                    Buffer<T>(a_buffer), a_offset, a_ld,
+                    Buffer<int>(ipiv_buffer), ipiv_offset,
+                    Buffer<int>(info_buffer), info_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Getrf<float>(const Layout,
+                                            const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Getrf<double>(const Layout,
+                                             const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Getrf<float2>(const Layout,
+                                             const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Getrf<double2>(const Layout,
+                                              const size_t, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t,
+                                              cl_mem, const size_t,
+                                              cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Mixed-precision linear solver with iterative refinement
+template <typename T>
+StatusCode GesvMixed(const Layout layout,
+                     const size_t n, const size_t nrhs,
+                     cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                     cl_mem ipiv_buffer, const size_t ipiv_offset,
+                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                     cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                     cl_mem info_buffer, const size_t info_offset,
+                     cl_mem iter_buffer, const size_t iter_offset,
+                     cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgesvmixed<T>(queue_cpp, event);
+    routine.DoGesvMixed(layout,
+                        n, nrhs,
+                        Buffer<T>(a_buffer), a_offset, a_ld,
+                        Buffer<int>(ipiv_buffer), ipiv_offset,
+                        Buffer<T>(b_buffer), b_offset, b_ld,
+                        Buffer<T>(x_buffer), x_offset, x_ld,
+                        Buffer<int>(info_buffer), info_offset,
+                        Buffer<int>(iter_buffer), iter_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GesvMixed<double>(const Layout,
+                                                 const size_t, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_mem, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_mem, const size_t,
+                                                 cl_mem, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GesvMixed<double2>(const Layout,
+                                                  const size_t, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_mem, const size_t,
+                                                  cl_mem, const size_t,
+                                                  cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Device-scalar versions of AXPY, SCAL, AXPBY, GEMV and GEMM
+template <typename T>
+StatusCode AxpyDevice(const size_t n,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xaxpy<T>(queue_cpp, event, "AXPY", true);
+    routine.DoAxpy(n,
+                   Scalar<T>(Buffer<T>(alpha_buffer), alpha_offset),
+                   Buffer<T>(x_buffer), x_offset, x_inc,
+                   Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AxpyDevice<float>(const size_t,
+                                                 const cl_mem, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyDevice<double>(const size_t,
+                                                  const cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyDevice<float2>(const size_t,
+                                                  const cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyDevice<double2>(const size_t,
+                                                   const cl_mem, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyDevice<half>(const size_t,
+                                                const cl_mem, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+
+template <typename T>
+StatusCode ScalDevice(const size_t n,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xscal<T>(queue_cpp, event, "SCAL", true);
+    routine.DoScal(n,
+                   Scalar<T>(Buffer<T>(alpha_buffer), alpha_offset),
+                   Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API ScalDevice<float>(const size_t,
+                                                 const cl_mem, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalDevice<double>(const size_t,
+                                                  const cl_mem, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalDevice<float2>(const size_t,
+                                                  const cl_mem, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalDevice<double2>(const size_t,
+                                                   const cl_mem, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalDevice<half>(const size_t,
+                                                const cl_mem, const size_t,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+
+template <typename T>
+StatusCode AxpbyDevice(const size_t n,
+                       const cl_mem alpha_buffer, const size_t alpha_offset,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       const cl_mem beta_buffer, const size_t beta_offset,
+                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xaxpby<T>(queue_cpp, event, "AXPBY", true);
+    routine.DoAxpby(n,
+                    Scalar<T>(Buffer<T>(alpha_buffer), alpha_offset),
+                    Buffer<T>(x_buffer), x_offset, x_inc,
+                    Scalar<T>(Buffer<T>(beta_buffer), beta_offset),
+                    Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AxpbyDevice<float>(const size_t,
+                                                  const cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpbyDevice<double>(const size_t,
+                                                   const cl_mem, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpbyDevice<float2>(const size_t,
+                                                   const cl_mem, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpbyDevice<double2>(const size_t,
+                                                    const cl_mem, const size_t,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const cl_mem, const size_t,
+                                                    cl_mem, const size_t, const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpbyDevice<half>(const size_t,
+                                                 const cl_mem, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const cl_mem, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+
+template <typename T>
+StatusCode GemvDevice(const Layout layout, const Transpose a_transpose,
+                      const size_t m, const size_t n,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                      const cl_mem beta_buffer, const size_t beta_offset,
+                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgemv<T>(queue_cpp, event, "GEMV", true);
+    routine.DoGemv(layout, a_transpose,
+                   m, n,
+                   Scalar<T>(Buffer<T>(alpha_buffer), alpha_offset),
+                   Buffer<T>(a_buffer), a_offset, a_ld,
+                   Buffer<T>(x_buffer), x_offset, x_inc,
+                   Scalar<T>(Buffer<T>(beta_buffer), beta_offset),
+                   Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvDevice<float>(const Layout, const Transpose,
+                                                 const size_t, const size_t,
+                                                 const cl_mem, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const cl_mem, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvDevice<double>(const Layout, const Transpose,
+                                                  const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvDevice<float2>(const Layout, const Transpose,
+                                                  const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvDevice<double2>(const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const cl_mem, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvDevice<half>(const Layout, const Transpose,
+                                                const size_t, const size_t,
+                                                const cl_mem, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                const cl_mem, const size_t,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+
+template <typename T>
+StatusCode GemmDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                      const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                      const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                      const cl_mem beta_buffer, const size_t beta_offset,
+                      cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                      cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgemm<T>(queue_cpp, event, "GEMM", true);
+    routine.DoGemm(layout, a_transpose, b_transpose,
+                   m, n, k,
+                   Scalar<T>(Buffer<T>(alpha_buffer), alpha_offset),
+                   Buffer<T>(a_buffer), a_offset, a_ld,
+                   Buffer<T>(b_buffer), b_offset, b_ld,
+                   Scalar<T>(Buffer<T>(beta_buffer), beta_offset),
+                   Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmDevice<float>(const Layout, const Transpose, const Transpose,
+                                                 const size_t, const size_t, const size_t,
+                                                 const cl_mem, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 const cl_mem, const size_t,
+                                                 cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmDevice<double>(const Layout, const Transpose, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmDevice<float2>(const Layout, const Transpose, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmDevice<double2>(const Layout, const Transpose, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const cl_mem, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmDevice<half>(const Layout, const Transpose, const Transpose,
+                                                const size_t, const size_t, const size_t,
+                                                const cl_mem, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                const cl_mem, const size_t, const size_t,
+                                                const cl_mem, const size_t,
+                                                cl_mem, const size_t, const size_t,
+                                                cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Fused sequence of rank-1 updates: SGERK/DGERK/HGERK
+template <typename T>
+StatusCode Gerk(const Layout layout,
+                const size_t m, const size_t n, const size_t k,
+                const T alpha,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                const cl_mem y_buffer, const size_t y_offset, const size_t y_ld,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(*queue);
+    auto routine = Xgerk<T>(queue_cpp, event);
+    routine.DoGerk(layout,
+                   m, n, k,
+                   alpha,
+                   Buffer<T>(x_buffer), x_offset, x_ld,
+                   Buffer<T>(y_buffer), y_offset, y_ld,
+                   Buffer<T>(a_buffer), a_offset, a_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Gerk<float>(const Layout,
+                                           const size_t, const size_t, const size_t,
+                                           const float,
+                                           const cl_mem, const size_t, const size_t,
+                                           const cl_mem, const size_t, const size_t,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gerk<double>(const Layout,
+                                            const size_t, const size_t, const size_t,
+                                            const double,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gerk<half>(const Layout,
+                                          const size_t, const size_t, const size_t,
+                                          const half,
+                                          const cl_mem, const size_t, const size_t,
+                                          const cl_mem, const size_t, const size_t,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_command_queue*, cl_event*);
+
 // =================================================================================================
 
 // Retrieves the required size of the temporary buffer for the GEMM kernel (optional)
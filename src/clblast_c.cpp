@@ -3520,6 +3520,413 @@ CLBlastStatusCode CLBlastHhad(const size_t n,
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
+// AXPBY
+CLBlastStatusCode CLBlastSaxpby(const size_t n,
+                                const float alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                const float beta,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpby(n,
+                     alpha,
+                     x_buffer, x_offset, x_inc,
+                     beta,
+                     y_buffer, y_offset, y_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDaxpby(const size_t n,
+                                const double alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                const double beta,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpby(n,
+                     alpha,
+                     x_buffer, x_offset, x_inc,
+                     beta,
+                     y_buffer, y_offset, y_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCaxpby(const size_t n,
+                                const cl_float2 alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                const cl_float2 beta,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpby(n,
+                     float2{alpha.s[0], alpha.s[1]},
+                     x_buffer, x_offset, x_inc,
+                     float2{beta.s[0], beta.s[1]},
+                     y_buffer, y_offset, y_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZaxpby(const size_t n,
+                                const cl_double2 alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                const cl_double2 beta,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpby(n,
+                     double2{alpha.s[0], alpha.s[1]},
+                     x_buffer, x_offset, x_inc,
+                     double2{beta.s[0], beta.s[1]},
+                     y_buffer, y_offset, y_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHaxpby(const size_t n,
+                                const cl_half alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                const cl_half beta,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpby(n,
+                     alpha,
+                     x_buffer, x_offset, x_inc,
+                     beta,
+                     y_buffer, y_offset, y_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// SET
+CLBlastStatusCode CLBlastSset(const size_t n,
+                              const float alpha,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Set(n,
+                   alpha,
+                   x_buffer, x_offset, x_inc,
+                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDset(const size_t n,
+                              const double alpha,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Set(n,
+                   alpha,
+                   x_buffer, x_offset, x_inc,
+                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCset(const size_t n,
+                              const cl_float2 alpha,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Set(n,
+                   float2{alpha.s[0], alpha.s[1]},
+                   x_buffer, x_offset, x_inc,
+                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZset(const size_t n,
+                              const cl_double2 alpha,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Set(n,
+                   double2{alpha.s[0], alpha.s[1]},
+                   x_buffer, x_offset, x_inc,
+                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHset(const size_t n,
+                              const cl_half alpha,
+                              cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Set(n,
+                   alpha,
+                   x_buffer, x_offset, x_inc,
+                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// AXPY2
+CLBlastStatusCode CLBlastSaxpy2(const size_t n,
+                                const float alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                const float beta,
+                                const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpy2(n,
+                     alpha,
+                     x_buffer, x_offset, x_inc,
+                     y_buffer, y_offset, y_inc,
+                     beta,
+                     z_buffer, z_offset, z_inc,
+                     w_buffer, w_offset, w_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDaxpy2(const size_t n,
+                                const double alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                const double beta,
+                                const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpy2(n,
+                     alpha,
+                     x_buffer, x_offset, x_inc,
+                     y_buffer, y_offset, y_inc,
+                     beta,
+                     z_buffer, z_offset, z_inc,
+                     w_buffer, w_offset, w_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCaxpy2(const size_t n,
+                                const cl_float2 alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                const cl_float2 beta,
+                                const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpy2(n,
+                     float2{alpha.s[0], alpha.s[1]},
+                     x_buffer, x_offset, x_inc,
+                     y_buffer, y_offset, y_inc,
+                     float2{beta.s[0], beta.s[1]},
+                     z_buffer, z_offset, z_inc,
+                     w_buffer, w_offset, w_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZaxpy2(const size_t n,
+                                const cl_double2 alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                const cl_double2 beta,
+                                const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpy2(n,
+                     double2{alpha.s[0], alpha.s[1]},
+                     x_buffer, x_offset, x_inc,
+                     y_buffer, y_offset, y_inc,
+                     double2{beta.s[0], beta.s[1]},
+                     z_buffer, z_offset, z_inc,
+                     w_buffer, w_offset, w_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHaxpy2(const size_t n,
+                                const cl_half alpha,
+                                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                const cl_half beta,
+                                const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                cl_mem w_buffer, const size_t w_offset, const size_t w_inc,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpy2(n,
+                     alpha,
+                     x_buffer, x_offset, x_inc,
+                     y_buffer, y_offset, y_inc,
+                     beta,
+                     z_buffer, z_offset, z_inc,
+                     w_buffer, w_offset, w_inc,
+                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// AXPYDOT
+CLBlastStatusCode CLBlastSaxpydot(const size_t n,
+                                  cl_mem dot_buffer, const size_t dot_offset,
+                                  const float alpha,
+                                  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                  const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpydot(n,
+                       dot_buffer, dot_offset,
+                       alpha,
+                       x_buffer, x_offset, x_inc,
+                       y_buffer, y_offset, y_inc,
+                       z_buffer, z_offset, z_inc,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDaxpydot(const size_t n,
+                                  cl_mem dot_buffer, const size_t dot_offset,
+                                  const double alpha,
+                                  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                  const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpydot(n,
+                       dot_buffer, dot_offset,
+                       alpha,
+                       x_buffer, x_offset, x_inc,
+                       y_buffer, y_offset, y_inc,
+                       z_buffer, z_offset, z_inc,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHaxpydot(const size_t n,
+                                  cl_mem dot_buffer, const size_t dot_offset,
+                                  const cl_half alpha,
+                                  const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                  const cl_mem z_buffer, const size_t z_offset, const size_t z_inc,
+                                  cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpydot(n,
+                       dot_buffer, dot_offset,
+                       alpha,
+                       x_buffer, x_offset, x_inc,
+                       y_buffer, y_offset, y_inc,
+                       z_buffer, z_offset, z_inc,
+                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// AXPYNRM2
+CLBlastStatusCode CLBlastSaxpynrm2(const size_t n,
+                                   cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                   const float alpha,
+                                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                   cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpynrm2(n,
+                        nrm2_buffer, nrm2_offset,
+                        alpha,
+                        x_buffer, x_offset, x_inc,
+                        y_buffer, y_offset, y_inc,
+                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDaxpynrm2(const size_t n,
+                                   cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                   const double alpha,
+                                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                   cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpynrm2(n,
+                        nrm2_buffer, nrm2_offset,
+                        alpha,
+                        x_buffer, x_offset, x_inc,
+                        y_buffer, y_offset, y_inc,
+                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCaxpynrm2(const size_t n,
+                                   cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                   const cl_float2 alpha,
+                                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                   cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpynrm2(n,
+                        nrm2_buffer, nrm2_offset,
+                        float2{alpha.s[0], alpha.s[1]},
+                        x_buffer, x_offset, x_inc,
+                        y_buffer, y_offset, y_inc,
+                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZaxpynrm2(const size_t n,
+                                   cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                   const cl_double2 alpha,
+                                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                   cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpynrm2(n,
+                        nrm2_buffer, nrm2_offset,
+                        double2{alpha.s[0], alpha.s[1]},
+                        x_buffer, x_offset, x_inc,
+                        y_buffer, y_offset, y_inc,
+                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHaxpynrm2(const size_t n,
+                                   cl_mem nrm2_buffer, const size_t nrm2_offset,
+                                   const cl_half alpha,
+                                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                   cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpynrm2(n,
+                        nrm2_buffer, nrm2_offset,
+                        alpha,
+                        x_buffer, x_offset, x_inc,
+                        y_buffer, y_offset, y_inc,
+                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
 // OMATCOPY
 CLBlastStatusCode CLBlastSomatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                                    const size_t m, const size_t n,
@@ -3926,16 +4333,14 @@ CLBlastStatusCode CLBlastHaxpyBatched(const size_t n,
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
-// GEMM
-CLBlastStatusCode CLBlastSgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                                      const size_t m, const size_t n, const size_t k,
-                                      const float *alphas,
-                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
-                                      const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
-                                      const float *betas,
-                                      cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld,
-                                      const size_t batch_count,
-                                      cl_command_queue* queue, cl_event* event) {
+// AXPBY
+CLBlastStatusCode CLBlastSaxpbyBatched(const size_t n,
+                                       const float *alphas,
+                                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                       const float *betas,
+                                       cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                       const size_t batch_count,
+                                       cl_command_queue* queue, cl_event* event) {
   auto alphas_cpp = std::vector<float>();
   auto betas_cpp = std::vector<float>();
   for (auto batch = size_t{0}; batch < batch_count; ++batch) {
@@ -3944,24 +4349,250 @@ CLBlastStatusCode CLBlastSgemmBatched(const CLBlastLayout layout, const CLBlastT
   }
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::GemmBatched(static_cast<clblast::Layout>(layout),
-                           static_cast<clblast::Transpose>(a_transpose),
-                           static_cast<clblast::Transpose>(b_transpose),
-                           m, n, k,
-                           alphas_cpp.data(),
-                           a_buffer, a_offsets, a_ld,
-                           b_buffer, b_offsets, b_ld,
-                           betas_cpp.data(),
-                           c_buffer, c_offsets, c_ld,
-                           batch_count,
-                           queue, event)
+      clblast::AxpbyBatched(n,
+                            alphas_cpp.data(),
+                            x_buffer, x_offsets, x_inc,
+                            betas_cpp.data(),
+                            y_buffer, y_offsets, y_inc,
+                            batch_count,
+                            queue, event)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
-CLBlastStatusCode CLBlastDgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                                      const size_t m, const size_t n, const size_t k,
-                                      const double *alphas,
-                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+CLBlastStatusCode CLBlastDaxpbyBatched(const size_t n,
+                                       const double *alphas,
+                                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                       const double *betas,
+                                       cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                       const size_t batch_count,
+                                       cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double>();
+  auto betas_cpp = std::vector<double>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpbyBatched(n,
+                            alphas_cpp.data(),
+                            x_buffer, x_offsets, x_inc,
+                            betas_cpp.data(),
+                            y_buffer, y_offsets, y_inc,
+                            batch_count,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCaxpbyBatched(const size_t n,
+                                       const cl_float2 *alphas,
+                                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                       const cl_float2 *betas,
+                                       cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                       const size_t batch_count,
+                                       cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float2>();
+  auto betas_cpp = std::vector<float2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(float2{alphas[batch].s[0], alphas[batch].s[1]});
+    betas_cpp.push_back(float2{betas[batch].s[0], betas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpbyBatched(n,
+                            alphas_cpp.data(),
+                            x_buffer, x_offsets, x_inc,
+                            betas_cpp.data(),
+                            y_buffer, y_offsets, y_inc,
+                            batch_count,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZaxpbyBatched(const size_t n,
+                                       const cl_double2 *alphas,
+                                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                       const cl_double2 *betas,
+                                       cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                       const size_t batch_count,
+                                       cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double2>();
+  auto betas_cpp = std::vector<double2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(double2{alphas[batch].s[0], alphas[batch].s[1]});
+    betas_cpp.push_back(double2{betas[batch].s[0], betas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpbyBatched(n,
+                            alphas_cpp.data(),
+                            x_buffer, x_offsets, x_inc,
+                            betas_cpp.data(),
+                            y_buffer, y_offsets, y_inc,
+                            batch_count,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHaxpbyBatched(const size_t n,
+                                       const cl_half *alphas,
+                                       const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                       const cl_half *betas,
+                                       cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                       const size_t batch_count,
+                                       cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<half>();
+  auto betas_cpp = std::vector<half>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpbyBatched(n,
+                            alphas_cpp.data(),
+                            x_buffer, x_offsets, x_inc,
+                            betas_cpp.data(),
+                            y_buffer, y_offsets, y_inc,
+                            batch_count,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// SET
+CLBlastStatusCode CLBlastSsetBatched(const size_t n,
+                                     const float *alphas,
+                                     cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                     const size_t batch_count,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SetBatched(n,
+                          alphas_cpp.data(),
+                          x_buffer, x_offsets, x_inc,
+                          batch_count,
+                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDsetBatched(const size_t n,
+                                     const double *alphas,
+                                     cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                     const size_t batch_count,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SetBatched(n,
+                          alphas_cpp.data(),
+                          x_buffer, x_offsets, x_inc,
+                          batch_count,
+                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCsetBatched(const size_t n,
+                                     const cl_float2 *alphas,
+                                     cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                     const size_t batch_count,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(float2{alphas[batch].s[0], alphas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SetBatched(n,
+                          alphas_cpp.data(),
+                          x_buffer, x_offsets, x_inc,
+                          batch_count,
+                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZsetBatched(const size_t n,
+                                     const cl_double2 *alphas,
+                                     cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                     const size_t batch_count,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(double2{alphas[batch].s[0], alphas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SetBatched(n,
+                          alphas_cpp.data(),
+                          x_buffer, x_offsets, x_inc,
+                          batch_count,
+                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHsetBatched(const size_t n,
+                                     const cl_half *alphas,
+                                     cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                     const size_t batch_count,
+                                     cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<half>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SetBatched(n,
+                          alphas_cpp.data(),
+                          x_buffer, x_offsets, x_inc,
+                          batch_count,
+                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// GEMM
+CLBlastStatusCode CLBlastSgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                      const size_t m, const size_t n, const size_t k,
+                                      const float *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                      const float *betas,
+                                      cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float>();
+  auto betas_cpp = std::vector<float>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Transpose>(b_transpose),
+                           m, n, k,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           b_buffer, b_offsets, b_ld,
+                           betas_cpp.data(),
+                           c_buffer, c_offsets, c_ld,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                      const size_t m, const size_t n, const size_t k,
+                                      const double *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
                                       const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
                                       const double *betas,
                                       cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld,
@@ -4210,126 +4841,2209 @@ CLBlastStatusCode CLBlastHgemmStridedBatched(const CLBlastLayout layout, const C
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
-// =================================================================================================
-
-// GEMM with temporary buffer (optional, for advanced users)
-CLBlastStatusCode CLBlastSgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                                             const size_t m, const size_t n, const size_t k,
-                                             const float alpha,
-                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
-                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
-                                             const float beta,
-                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
-                                             cl_command_queue* queue, cl_event* event,
-                                             cl_mem temp_buffer) {
+// GEMV
+CLBlastStatusCode CLBlastSgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const float *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const float *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float>();
+  auto betas_cpp = std::vector<float>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::Gemm(static_cast<clblast::Layout>(layout),
-                    static_cast<clblast::Transpose>(a_transpose),
-                    static_cast<clblast::Transpose>(b_transpose),
-                    m, n, k,
-                    alpha,
-                    a_buffer, a_offset, a_ld,
-                    b_buffer, b_offset, b_ld,
-                    beta,
-                    c_buffer, c_offset, c_ld,
-                    queue, event, temp_buffer)
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
-CLBlastStatusCode CLBlastDgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                                             const size_t m, const size_t n, const size_t k,
-                                             const double alpha,
-                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
-                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
-                                             const double beta,
-                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
-                                             cl_command_queue* queue, cl_event* event,
-                                             cl_mem temp_buffer) {
+CLBlastStatusCode CLBlastDgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const double *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const double *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double>();
+  auto betas_cpp = std::vector<double>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::Gemm(static_cast<clblast::Layout>(layout),
-                    static_cast<clblast::Transpose>(a_transpose),
-                    static_cast<clblast::Transpose>(b_transpose),
-                    m, n, k,
-                    alpha,
-                    a_buffer, a_offset, a_ld,
-                    b_buffer, b_offset, b_ld,
-                    beta,
-                    c_buffer, c_offset, c_ld,
-                    queue, event, temp_buffer)
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
-CLBlastStatusCode CLBlastCgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                                             const size_t m, const size_t n, const size_t k,
-                                             const cl_float2 alpha,
-                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
-                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
-                                             const cl_float2 beta,
-                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
-                                             cl_command_queue* queue, cl_event* event,
-                                             cl_mem temp_buffer) {
+CLBlastStatusCode CLBlastCgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const cl_float2 *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const cl_float2 *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float2>();
+  auto betas_cpp = std::vector<float2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(float2{alphas[batch].s[0], alphas[batch].s[1]});
+    betas_cpp.push_back(float2{betas[batch].s[0], betas[batch].s[1]});
+  }
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::Gemm(static_cast<clblast::Layout>(layout),
-                    static_cast<clblast::Transpose>(a_transpose),
-                    static_cast<clblast::Transpose>(b_transpose),
-                    m, n, k,
-                    float2{alpha.s[0], alpha.s[1]},
-                    a_buffer, a_offset, a_ld,
-                    b_buffer, b_offset, b_ld,
-                    float2{beta.s[0], beta.s[1]},
-                    c_buffer, c_offset, c_ld,
-                    queue, event, temp_buffer)
-    );
-  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
-}
-CLBlastStatusCode CLBlastZgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const cl_double2 *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const cl_double2 *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double2>();
+  auto betas_cpp = std::vector<double2>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(double2{alphas[batch].s[0], alphas[batch].s[1]});
+    betas_cpp.push_back(double2{betas[batch].s[0], betas[batch].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                      const size_t m, const size_t n,
+                                      const cl_half *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const cl_half *betas,
+                                      cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<half>();
+  auto betas_cpp = std::vector<half>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           m, n,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           x_buffer, x_offsets, x_inc,
+                           betas_cpp.data(),
+                           y_buffer, y_offsets, y_inc,
+                           batch_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// GEMV
+CLBlastStatusCode CLBlastSgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const float beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  beta,
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const double beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  beta,
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const cl_float2 beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  float2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  float2{beta.s[0], beta.s[1]},
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const cl_double2 beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  double2{alpha.s[0], alpha.s[1]},
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  double2{beta.s[0], beta.s[1]},
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                             const size_t m, const size_t n,
+                                             const cl_half alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const cl_half beta,
+                                             cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvStridedBatched(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld, a_stride,
+                                  x_buffer, x_offset, x_inc, x_stride,
+                                  beta,
+                                  y_buffer, y_offset, y_inc, y_stride,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// DOT
+CLBlastStatusCode CLBlastSdotBatched(const size_t n,
+                                     cl_mem dot_buffer, const size_t *dot_offsets,
+                                     const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                     const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                     const size_t batch_count,
+                                     cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::DotBatched<float>(n,
+                                 dot_buffer, dot_offsets,
+                                 x_buffer, x_offsets, x_inc,
+                                 y_buffer, y_offsets, y_inc,
+                                 batch_count,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDdotBatched(const size_t n,
+                                     cl_mem dot_buffer, const size_t *dot_offsets,
+                                     const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                     const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                     const size_t batch_count,
+                                     cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::DotBatched<double>(n,
+                                  dot_buffer, dot_offsets,
+                                  x_buffer, x_offsets, x_inc,
+                                  y_buffer, y_offsets, y_inc,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHdotBatched(const size_t n,
+                                     cl_mem dot_buffer, const size_t *dot_offsets,
+                                     const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                     const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc,
+                                     const size_t batch_count,
+                                     cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::DotBatched<half>(n,
+                                dot_buffer, dot_offsets,
+                                x_buffer, x_offsets, x_inc,
+                                y_buffer, y_offsets, y_inc,
+                                batch_count,
+                                queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// DOT
+CLBlastStatusCode CLBlastSdotStridedBatched(const size_t n,
+                                            cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::DotStridedBatched<float>(n,
+                                        dot_buffer, dot_offset, dot_stride,
+                                        x_buffer, x_offset, x_inc, x_stride,
+                                        y_buffer, y_offset, y_inc, y_stride,
+                                        batch_count,
+                                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDdotStridedBatched(const size_t n,
+                                            cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::DotStridedBatched<double>(n,
+                                         dot_buffer, dot_offset, dot_stride,
+                                         x_buffer, x_offset, x_inc, x_stride,
+                                         y_buffer, y_offset, y_inc, y_stride,
+                                         batch_count,
+                                         queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHdotStridedBatched(const size_t n,
+                                            cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                            const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::DotStridedBatched<half>(n,
+                                       dot_buffer, dot_offset, dot_stride,
+                                       x_buffer, x_offset, x_inc, x_stride,
+                                       y_buffer, y_offset, y_inc, y_stride,
+                                       batch_count,
+                                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// NRM2
+CLBlastStatusCode CLBlastSnrm2Batched(const size_t n,
+                                      cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2Batched<float>(n,
+                                  nrm2_buffer, nrm2_offsets,
+                                  x_buffer, x_offsets, x_inc,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDnrm2Batched(const size_t n,
+                                      cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2Batched<double>(n,
+                                   nrm2_buffer, nrm2_offsets,
+                                   x_buffer, x_offsets, x_inc,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastScnrm2Batched(const size_t n,
+                                      cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2Batched<float2>(n,
+                                   nrm2_buffer, nrm2_offsets,
+                                   x_buffer, x_offsets, x_inc,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDznrm2Batched(const size_t n,
+                                      cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2Batched<double2>(n,
+                                    nrm2_buffer, nrm2_offsets,
+                                    x_buffer, x_offsets, x_inc,
+                                    batch_count,
+                                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHnrm2Batched(const size_t n,
+                                      cl_mem nrm2_buffer, const size_t *nrm2_offsets,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2Batched<half>(n,
+                                 nrm2_buffer, nrm2_offsets,
+                                 x_buffer, x_offsets, x_inc,
+                                 batch_count,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// NRM2
+CLBlastStatusCode CLBlastSnrm2StridedBatched(const size_t n,
+                                             cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2StridedBatched<float>(n,
+                                         nrm2_buffer, nrm2_offset, nrm2_stride,
+                                         x_buffer, x_offset, x_inc, x_stride,
+                                         batch_count,
+                                         queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDnrm2StridedBatched(const size_t n,
+                                             cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2StridedBatched<double>(n,
+                                          nrm2_buffer, nrm2_offset, nrm2_stride,
+                                          x_buffer, x_offset, x_inc, x_stride,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastScnrm2StridedBatched(const size_t n,
+                                             cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2StridedBatched<float2>(n,
+                                          nrm2_buffer, nrm2_offset, nrm2_stride,
+                                          x_buffer, x_offset, x_inc, x_stride,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDznrm2StridedBatched(const size_t n,
+                                             cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2StridedBatched<double2>(n,
+                                           nrm2_buffer, nrm2_offset, nrm2_stride,
+                                           x_buffer, x_offset, x_inc, x_stride,
+                                           batch_count,
+                                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHnrm2StridedBatched(const size_t n,
+                                             cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Nrm2StridedBatched<half>(n,
+                                        nrm2_buffer, nrm2_offset, nrm2_stride,
+                                        x_buffer, x_offset, x_inc, x_stride,
+                                        batch_count,
+                                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// ASUM
+CLBlastStatusCode CLBlastSasumBatched(const size_t n,
+                                      cl_mem asum_buffer, const size_t *asum_offsets,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AsumBatched<float>(n,
+                                  asum_buffer, asum_offsets,
+                                  x_buffer, x_offsets, x_inc,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDasumBatched(const size_t n,
+                                      cl_mem asum_buffer, const size_t *asum_offsets,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AsumBatched<double>(n,
+                                   asum_buffer, asum_offsets,
+                                   x_buffer, x_offsets, x_inc,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastScasumBatched(const size_t n,
+                                      cl_mem asum_buffer, const size_t *asum_offsets,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AsumBatched<float2>(n,
+                                   asum_buffer, asum_offsets,
+                                   x_buffer, x_offsets, x_inc,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDzasumBatched(const size_t n,
+                                      cl_mem asum_buffer, const size_t *asum_offsets,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AsumBatched<double2>(n,
+                                    asum_buffer, asum_offsets,
+                                    x_buffer, x_offsets, x_inc,
+                                    batch_count,
+                                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHasumBatched(const size_t n,
+                                      cl_mem asum_buffer, const size_t *asum_offsets,
+                                      const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AsumBatched<half>(n,
+                                 asum_buffer, asum_offsets,
+                                 x_buffer, x_offsets, x_inc,
+                                 batch_count,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// ASUM
+CLBlastStatusCode CLBlastSasumStridedBatched(const size_t n,
+                                             cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AsumStridedBatched<float>(n,
+                                         asum_buffer, asum_offset, asum_stride,
+                                         x_buffer, x_offset, x_inc, x_stride,
+                                         batch_count,
+                                         queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDasumStridedBatched(const size_t n,
+                                             cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AsumStridedBatched<double>(n,
+                                          asum_buffer, asum_offset, asum_stride,
+                                          x_buffer, x_offset, x_inc, x_stride,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastScasumStridedBatched(const size_t n,
+                                             cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AsumStridedBatched<float2>(n,
+                                          asum_buffer, asum_offset, asum_stride,
+                                          x_buffer, x_offset, x_inc, x_stride,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDzasumStridedBatched(const size_t n,
+                                             cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AsumStridedBatched<double2>(n,
+                                           asum_buffer, asum_offset, asum_stride,
+                                           x_buffer, x_offset, x_inc, x_stride,
+                                           batch_count,
+                                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHasumStridedBatched(const size_t n,
+                                             cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                             const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                             const size_t batch_count,
+                                             cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AsumStridedBatched<half>(n,
+                                        asum_buffer, asum_offset, asum_stride,
+                                        x_buffer, x_offset, x_inc, x_stride,
+                                        batch_count,
+                                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// GEMM with temporary buffer (optional, for advanced users)
+CLBlastStatusCode CLBlastSgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const float beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_command_queue* queue, cl_event* event,
+                                             cl_mem temp_buffer) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gemm(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n, k,
+                    alpha,
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    beta,
+                    c_buffer, c_offset, c_ld,
+                    queue, event, temp_buffer)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const double beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_command_queue* queue, cl_event* event,
+                                             cl_mem temp_buffer) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gemm(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n, k,
+                    alpha,
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    beta,
+                    c_buffer, c_offset, c_ld,
+                    queue, event, temp_buffer)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const cl_float2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_command_queue* queue, cl_event* event,
+                                             cl_mem temp_buffer) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gemm(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n, k,
+                    float2{alpha.s[0], alpha.s[1]},
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    float2{beta.s[0], beta.s[1]},
+                    c_buffer, c_offset, c_ld,
+                    queue, event, temp_buffer)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                             const size_t m, const size_t n, const size_t k,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                             const cl_double2 beta,
+                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                             cl_command_queue* queue, cl_event* event,
+                                             cl_mem temp_buffer) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gemm(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n, k,
+                    double2{alpha.s[0], alpha.s[1]},
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    double2{beta.s[0], beta.s[1]},
+                    c_buffer, c_offset, c_ld,
+                    queue, event, temp_buffer)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
                                              const size_t m, const size_t n, const size_t k,
-                                             const cl_double2 alpha,
+                                             const cl_half alpha,
                                              const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                                              const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
-                                             const cl_double2 beta,
+                                             const cl_half beta,
                                              cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                                              cl_command_queue* queue, cl_event* event,
                                              cl_mem temp_buffer) {
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::Gemm(static_cast<clblast::Layout>(layout),
-                    static_cast<clblast::Transpose>(a_transpose),
-                    static_cast<clblast::Transpose>(b_transpose),
+      clblast::Gemm(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n, k,
+                    alpha,
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    beta,
+                    c_buffer, c_offset, c_ld,
+                    queue, event, temp_buffer)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// Grouped version of GEMM
+CLBlastStatusCode CLBlastSgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                      const size_t *ms, const size_t *ns, const size_t *ks,
+                                      const float *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                      const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                      const float *betas,
+                                      cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                      const size_t group_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float>();
+  auto betas_cpp = std::vector<float>();
+  for (auto group = size_t{0}; group < group_count; ++group) {
+    alphas_cpp.push_back(alphas[group]);
+    betas_cpp.push_back(betas[group]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmGrouped(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Transpose>(b_transpose),
+                           ms, ns, ks,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_lds,
+                           b_buffer, b_offsets, b_lds,
+                           betas_cpp.data(),
+                           c_buffer, c_offsets, c_lds,
+                           group_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                      const size_t *ms, const size_t *ns, const size_t *ks,
+                                      const double *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                      const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                      const double *betas,
+                                      cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                      const size_t group_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double>();
+  auto betas_cpp = std::vector<double>();
+  for (auto group = size_t{0}; group < group_count; ++group) {
+    alphas_cpp.push_back(alphas[group]);
+    betas_cpp.push_back(betas[group]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmGrouped(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Transpose>(b_transpose),
+                           ms, ns, ks,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_lds,
+                           b_buffer, b_offsets, b_lds,
+                           betas_cpp.data(),
+                           c_buffer, c_offsets, c_lds,
+                           group_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                      const size_t *ms, const size_t *ns, const size_t *ks,
+                                      const cl_float2 *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                      const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                      const cl_float2 *betas,
+                                      cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                      const size_t group_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<float2>();
+  auto betas_cpp = std::vector<float2>();
+  for (auto group = size_t{0}; group < group_count; ++group) {
+    alphas_cpp.push_back(float2{alphas[group].s[0], alphas[group].s[1]});
+    betas_cpp.push_back(float2{betas[group].s[0], betas[group].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmGrouped(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Transpose>(b_transpose),
+                           ms, ns, ks,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_lds,
+                           b_buffer, b_offsets, b_lds,
+                           betas_cpp.data(),
+                           c_buffer, c_offsets, c_lds,
+                           group_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                      const size_t *ms, const size_t *ns, const size_t *ks,
+                                      const cl_double2 *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                      const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                      const cl_double2 *betas,
+                                      cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                      const size_t group_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<double2>();
+  auto betas_cpp = std::vector<double2>();
+  for (auto group = size_t{0}; group < group_count; ++group) {
+    alphas_cpp.push_back(double2{alphas[group].s[0], alphas[group].s[1]});
+    betas_cpp.push_back(double2{betas[group].s[0], betas[group].s[1]});
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmGrouped(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Transpose>(b_transpose),
+                           ms, ns, ks,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_lds,
+                           b_buffer, b_offsets, b_lds,
+                           betas_cpp.data(),
+                           c_buffer, c_offsets, c_lds,
+                           group_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemmGrouped(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                      const size_t *ms, const size_t *ns, const size_t *ks,
+                                      const cl_half *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                                      const cl_mem b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                                      const cl_half *betas,
+                                      cl_mem c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                                      const size_t group_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<half>();
+  auto betas_cpp = std::vector<half>();
+  for (auto group = size_t{0}; group < group_count; ++group) {
+    alphas_cpp.push_back(alphas[group]);
+    betas_cpp.push_back(betas[group]);
+  }
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmGrouped(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Transpose>(b_transpose),
+                           ms, ns, ks,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_lds,
+                           b_buffer, b_offsets, b_lds,
+                           betas_cpp.data(),
+                           c_buffer, c_offsets, c_lds,
+                           group_count,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// Packs matrix A or B of a GEMM
+CLBlastStatusCode CLBlastSpackMatrix(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTranspose transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_mem buffer, const size_t offset, const size_t ld,
+                                     cl_command_queue* queue, CLBlastPackedMatrix* packed, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::PackMatrix<float>(static_cast<clblast::Layout>(layout),
+                                 static_cast<clblast::Side>(side),
+                                 static_cast<clblast::Transpose>(transpose),
+                                 m, n, k,
+                                 buffer, offset, ld,
+                                 queue, reinterpret_cast<clblast::PackedMatrix*>(packed), event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDpackMatrix(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTranspose transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_mem buffer, const size_t offset, const size_t ld,
+                                     cl_command_queue* queue, CLBlastPackedMatrix* packed, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::PackMatrix<double>(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Transpose>(transpose),
+                                  m, n, k,
+                                  buffer, offset, ld,
+                                  queue, reinterpret_cast<clblast::PackedMatrix*>(packed), event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCpackMatrix(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTranspose transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_mem buffer, const size_t offset, const size_t ld,
+                                     cl_command_queue* queue, CLBlastPackedMatrix* packed, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::PackMatrix<float2>(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  static_cast<clblast::Transpose>(transpose),
+                                  m, n, k,
+                                  buffer, offset, ld,
+                                  queue, reinterpret_cast<clblast::PackedMatrix*>(packed), event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZpackMatrix(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTranspose transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_mem buffer, const size_t offset, const size_t ld,
+                                     cl_command_queue* queue, CLBlastPackedMatrix* packed, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::PackMatrix<double2>(static_cast<clblast::Layout>(layout),
+                                   static_cast<clblast::Side>(side),
+                                   static_cast<clblast::Transpose>(transpose),
+                                   m, n, k,
+                                   buffer, offset, ld,
+                                   queue, reinterpret_cast<clblast::PackedMatrix*>(packed), event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHpackMatrix(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTranspose transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_mem buffer, const size_t offset, const size_t ld,
+                                     cl_command_queue* queue, CLBlastPackedMatrix* packed, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::PackMatrix<half>(static_cast<clblast::Layout>(layout),
+                                static_cast<clblast::Side>(side),
+                                static_cast<clblast::Transpose>(transpose),
+                                m, n, k,
+                                buffer, offset, ld,
+                                queue, reinterpret_cast<clblast::PackedMatrix*>(packed), event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Releases a packed matrix
+CLBlastStatusCode CLBlastReleasePackedMatrix(CLBlastPackedMatrix packed) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ReleasePackedMatrix(reinterpret_cast<clblast::PackedMatrix>(packed))
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// GEMM with pre-packed matrices
+CLBlastStatusCode CLBlastSgemmPacked(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const float alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const CLBlastPackedMatrix a_packed,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const CLBlastPackedMatrix b_packed,
+                                     const float beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPacked(static_cast<clblast::Layout>(layout),
+                          static_cast<clblast::Transpose>(a_transpose),
+                          static_cast<clblast::Transpose>(b_transpose),
+                          m, n, k,
+                          alpha,
+                          a_buffer, a_offset, a_ld, reinterpret_cast<clblast::PackedMatrix>(a_packed),
+                          b_buffer, b_offset, b_ld, reinterpret_cast<clblast::PackedMatrix>(b_packed),
+                          beta,
+                          c_buffer, c_offset, c_ld,
+                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmPacked(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const double alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const CLBlastPackedMatrix a_packed,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const CLBlastPackedMatrix b_packed,
+                                     const double beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPacked(static_cast<clblast::Layout>(layout),
+                          static_cast<clblast::Transpose>(a_transpose),
+                          static_cast<clblast::Transpose>(b_transpose),
+                          m, n, k,
+                          alpha,
+                          a_buffer, a_offset, a_ld, reinterpret_cast<clblast::PackedMatrix>(a_packed),
+                          b_buffer, b_offset, b_ld, reinterpret_cast<clblast::PackedMatrix>(b_packed),
+                          beta,
+                          c_buffer, c_offset, c_ld,
+                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemmPacked(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_float2 alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const CLBlastPackedMatrix a_packed,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const CLBlastPackedMatrix b_packed,
+                                     const cl_float2 beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPacked(static_cast<clblast::Layout>(layout),
+                          static_cast<clblast::Transpose>(a_transpose),
+                          static_cast<clblast::Transpose>(b_transpose),
+                          m, n, k,
+                          float2{alpha.s[0], alpha.s[1]},
+                          a_buffer, a_offset, a_ld, reinterpret_cast<clblast::PackedMatrix>(a_packed),
+                          b_buffer, b_offset, b_ld, reinterpret_cast<clblast::PackedMatrix>(b_packed),
+                          float2{beta.s[0], beta.s[1]},
+                          c_buffer, c_offset, c_ld,
+                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemmPacked(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_double2 alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const CLBlastPackedMatrix a_packed,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const CLBlastPackedMatrix b_packed,
+                                     const cl_double2 beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPacked(static_cast<clblast::Layout>(layout),
+                          static_cast<clblast::Transpose>(a_transpose),
+                          static_cast<clblast::Transpose>(b_transpose),
+                          m, n, k,
+                          double2{alpha.s[0], alpha.s[1]},
+                          a_buffer, a_offset, a_ld, reinterpret_cast<clblast::PackedMatrix>(a_packed),
+                          b_buffer, b_offset, b_ld, reinterpret_cast<clblast::PackedMatrix>(b_packed),
+                          double2{beta.s[0], beta.s[1]},
+                          c_buffer, c_offset, c_ld,
+                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemmPacked(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_half alpha,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const CLBlastPackedMatrix a_packed,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const CLBlastPackedMatrix b_packed,
+                                     const cl_half beta,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPacked(static_cast<clblast::Layout>(layout),
+                          static_cast<clblast::Transpose>(a_transpose),
+                          static_cast<clblast::Transpose>(b_transpose),
+                          m, n, k,
+                          alpha,
+                          a_buffer, a_offset, a_ld, reinterpret_cast<clblast::PackedMatrix>(a_packed),
+                          b_buffer, b_offset, b_ld, reinterpret_cast<clblast::PackedMatrix>(b_packed),
+                          beta,
+                          c_buffer, c_offset, c_ld,
+                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// Batched version of GEMM with device-resident arguments
+CLBlastStatusCode CLBlastSgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_mem alphas_buffer,
+                                            const cl_mem a_buffer, const cl_mem a_offsets_buffer, const size_t a_ld,
+                                            const cl_mem b_buffer, const cl_mem b_offsets_buffer, const size_t b_ld,
+                                            const cl_mem betas_buffer,
+                                            cl_mem c_buffer, const cl_mem c_offsets_buffer, const size_t c_ld,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBatchedDevice<float>(static_cast<clblast::Layout>(layout),
+                                        static_cast<clblast::Transpose>(a_transpose),
+                                        static_cast<clblast::Transpose>(b_transpose),
+                                        m, n, k,
+                                        alphas_buffer,
+                                        a_buffer, a_offsets_buffer, a_ld,
+                                        b_buffer, b_offsets_buffer, b_ld,
+                                        betas_buffer,
+                                        c_buffer, c_offsets_buffer, c_ld,
+                                        batch_count,
+                                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_mem alphas_buffer,
+                                            const cl_mem a_buffer, const cl_mem a_offsets_buffer, const size_t a_ld,
+                                            const cl_mem b_buffer, const cl_mem b_offsets_buffer, const size_t b_ld,
+                                            const cl_mem betas_buffer,
+                                            cl_mem c_buffer, const cl_mem c_offsets_buffer, const size_t c_ld,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBatchedDevice<double>(static_cast<clblast::Layout>(layout),
+                                         static_cast<clblast::Transpose>(a_transpose),
+                                         static_cast<clblast::Transpose>(b_transpose),
+                                         m, n, k,
+                                         alphas_buffer,
+                                         a_buffer, a_offsets_buffer, a_ld,
+                                         b_buffer, b_offsets_buffer, b_ld,
+                                         betas_buffer,
+                                         c_buffer, c_offsets_buffer, c_ld,
+                                         batch_count,
+                                         queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_mem alphas_buffer,
+                                            const cl_mem a_buffer, const cl_mem a_offsets_buffer, const size_t a_ld,
+                                            const cl_mem b_buffer, const cl_mem b_offsets_buffer, const size_t b_ld,
+                                            const cl_mem betas_buffer,
+                                            cl_mem c_buffer, const cl_mem c_offsets_buffer, const size_t c_ld,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBatchedDevice<float2>(static_cast<clblast::Layout>(layout),
+                                         static_cast<clblast::Transpose>(a_transpose),
+                                         static_cast<clblast::Transpose>(b_transpose),
+                                         m, n, k,
+                                         alphas_buffer,
+                                         a_buffer, a_offsets_buffer, a_ld,
+                                         b_buffer, b_offsets_buffer, b_ld,
+                                         betas_buffer,
+                                         c_buffer, c_offsets_buffer, c_ld,
+                                         batch_count,
+                                         queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_mem alphas_buffer,
+                                            const cl_mem a_buffer, const cl_mem a_offsets_buffer, const size_t a_ld,
+                                            const cl_mem b_buffer, const cl_mem b_offsets_buffer, const size_t b_ld,
+                                            const cl_mem betas_buffer,
+                                            cl_mem c_buffer, const cl_mem c_offsets_buffer, const size_t c_ld,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBatchedDevice<double2>(static_cast<clblast::Layout>(layout),
+                                          static_cast<clblast::Transpose>(a_transpose),
+                                          static_cast<clblast::Transpose>(b_transpose),
+                                          m, n, k,
+                                          alphas_buffer,
+                                          a_buffer, a_offsets_buffer, a_ld,
+                                          b_buffer, b_offsets_buffer, b_ld,
+                                          betas_buffer,
+                                          c_buffer, c_offsets_buffer, c_ld,
+                                          batch_count,
+                                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemmBatchedDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const cl_mem alphas_buffer,
+                                            const cl_mem a_buffer, const cl_mem a_offsets_buffer, const size_t a_ld,
+                                            const cl_mem b_buffer, const cl_mem b_offsets_buffer, const size_t b_ld,
+                                            const cl_mem betas_buffer,
+                                            cl_mem c_buffer, const cl_mem c_offsets_buffer, const size_t c_ld,
+                                            const size_t batch_count,
+                                            cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBatchedDevice<half>(static_cast<clblast::Layout>(layout),
+                                       static_cast<clblast::Transpose>(a_transpose),
+                                       static_cast<clblast::Transpose>(b_transpose),
+                                       m, n, k,
+                                       alphas_buffer,
+                                       a_buffer, a_offsets_buffer, a_ld,
+                                       b_buffer, b_offsets_buffer, b_ld,
+                                       betas_buffer,
+                                       c_buffer, c_offsets_buffer, c_ld,
+                                       batch_count,
+                                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// Strassen-Winograd version of GEMM
+CLBlastStatusCode CLBlastSgemmStrassen(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const float alpha,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                       const float beta,
+                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                       cl_command_queue* queue, cl_event* event,
+                                       cl_mem temp_buffer) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStrassen<float>(static_cast<clblast::Layout>(layout),
+                                   static_cast<clblast::Transpose>(a_transpose),
+                                   static_cast<clblast::Transpose>(b_transpose),
+                                   m, n, k,
+                                   alpha,
+                                   a_buffer, a_offset, a_ld,
+                                   b_buffer, b_offset, b_ld,
+                                   beta,
+                                   c_buffer, c_offset, c_ld,
+                                   queue, event, temp_buffer)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmStrassen(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const double alpha,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                       const double beta,
+                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                       cl_command_queue* queue, cl_event* event,
+                                       cl_mem temp_buffer) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStrassen<double>(static_cast<clblast::Layout>(layout),
+                                    static_cast<clblast::Transpose>(a_transpose),
+                                    static_cast<clblast::Transpose>(b_transpose),
+                                    m, n, k,
+                                    alpha,
+                                    a_buffer, a_offset, a_ld,
+                                    b_buffer, b_offset, b_ld,
+                                    beta,
+                                    c_buffer, c_offset, c_ld,
+                                    queue, event, temp_buffer)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemmStrassen(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const cl_float2 alpha,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                       const cl_float2 beta,
+                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                       cl_command_queue* queue, cl_event* event,
+                                       cl_mem temp_buffer) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStrassen<float2>(static_cast<clblast::Layout>(layout),
+                                    static_cast<clblast::Transpose>(a_transpose),
+                                    static_cast<clblast::Transpose>(b_transpose),
+                                    m, n, k,
+                                    float2{alpha.s[0], alpha.s[1]},
+                                    a_buffer, a_offset, a_ld,
+                                    b_buffer, b_offset, b_ld,
+                                    float2{beta.s[0], beta.s[1]},
+                                    c_buffer, c_offset, c_ld,
+                                    queue, event, temp_buffer)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemmStrassen(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const cl_double2 alpha,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                       const cl_double2 beta,
+                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                       cl_command_queue* queue, cl_event* event,
+                                       cl_mem temp_buffer) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStrassen<double2>(static_cast<clblast::Layout>(layout),
+                                     static_cast<clblast::Transpose>(a_transpose),
+                                     static_cast<clblast::Transpose>(b_transpose),
+                                     m, n, k,
+                                     double2{alpha.s[0], alpha.s[1]},
+                                     a_buffer, a_offset, a_ld,
+                                     b_buffer, b_offset, b_ld,
+                                     double2{beta.s[0], beta.s[1]},
+                                     c_buffer, c_offset, c_ld,
+                                     queue, event, temp_buffer)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemmStrassen(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const cl_half alpha,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                       const cl_half beta,
+                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                       cl_command_queue* queue, cl_event* event,
+                                       cl_mem temp_buffer) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStrassen<half>(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Transpose>(b_transpose),
+                                  m, n, k,
+                                  alpha,
+                                  a_buffer, a_offset, a_ld,
+                                  b_buffer, b_offset, b_ld,
+                                  beta,
+                                  c_buffer, c_offset, c_ld,
+                                  queue, event, temp_buffer)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Strassen-Winograd GEMM get temporary buffer size
+CLBlastStatusCode CLBlastSGemmStrassenTempBufferSize(const size_t m, const size_t n, const size_t k,
+                                                     cl_command_queue* queue,
+                                                     size_t* temp_buffer_size) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStrassenTempBufferSize<float>(m, n, k, queue, *temp_buffer_size)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDGemmStrassenTempBufferSize(const size_t m, const size_t n, const size_t k,
+                                                     cl_command_queue* queue,
+                                                     size_t* temp_buffer_size) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStrassenTempBufferSize<double>(m, n, k, queue, *temp_buffer_size)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCGemmStrassenTempBufferSize(const size_t m, const size_t n, const size_t k,
+                                                     cl_command_queue* queue,
+                                                     size_t* temp_buffer_size) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStrassenTempBufferSize<float2>(m, n, k, queue, *temp_buffer_size)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZGemmStrassenTempBufferSize(const size_t m, const size_t n, const size_t k,
+                                                     cl_command_queue* queue,
+                                                     size_t* temp_buffer_size) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStrassenTempBufferSize<double2>(m, n, k, queue, *temp_buffer_size)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHGemmStrassenTempBufferSize(const size_t m, const size_t n, const size_t k,
+                                                     cl_command_queue* queue,
+                                                     size_t* temp_buffer_size) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmStrassenTempBufferSize<half>(m, n, k, queue, *temp_buffer_size)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// Cholesky factorization
+CLBlastStatusCode CLBlastSpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Potrf<float>(static_cast<clblast::Layout>(layout),
+                            static_cast<clblast::Triangle>(triangle),
+                            n,
+                            a_buffer, a_offset, a_ld,
+                            info_buffer, info_offset,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Potrf<double>(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Triangle>(triangle),
+                             n,
+                             a_buffer, a_offset, a_ld,
+                             info_buffer, info_offset,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Potrf<float2>(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Triangle>(triangle),
+                             n,
+                             a_buffer, a_offset, a_ld,
+                             info_buffer, info_offset,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZpotrf(const CLBlastLayout layout, const CLBlastTriangle triangle,
+                                const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Potrf<double2>(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              n,
+                              a_buffer, a_offset, a_ld,
+                              info_buffer, info_offset,
+                              queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// LU factorization with partial pivoting
+CLBlastStatusCode CLBlastSgetrf(const CLBlastLayout layout,
+                                const size_t m, const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Getrf<float>(static_cast<clblast::Layout>(layout),
+                            m, n,
+                            a_buffer, a_offset, a_ld,
+                            ipiv_buffer, ipiv_offset,
+                            info_buffer, info_offset,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgetrf(const CLBlastLayout layout,
+                                const size_t m, const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Getrf<double>(static_cast<clblast::Layout>(layout),
+                             m, n,
+                             a_buffer, a_offset, a_ld,
+                             ipiv_buffer, ipiv_offset,
+                             info_buffer, info_offset,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgetrf(const CLBlastLayout layout,
+                                const size_t m, const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Getrf<float2>(static_cast<clblast::Layout>(layout),
+                             m, n,
+                             a_buffer, a_offset, a_ld,
+                             ipiv_buffer, ipiv_offset,
+                             info_buffer, info_offset,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgetrf(const CLBlastLayout layout,
+                                const size_t m, const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                cl_mem info_buffer, const size_t info_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Getrf<double2>(static_cast<clblast::Layout>(layout),
+                              m, n,
+                              a_buffer, a_offset, a_ld,
+                              ipiv_buffer, ipiv_offset,
+                              info_buffer, info_offset,
+                              queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// Mixed-precision linear solver with iterative refinement
+CLBlastStatusCode CLBlastDgesvMixed(const CLBlastLayout layout,
+                                    const size_t n, const size_t nrhs,
+                                    cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                    cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                    const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                    cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                                    cl_mem info_buffer, const size_t info_offset,
+                                    cl_mem iter_buffer, const size_t iter_offset,
+                                    cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GesvMixed<double>(static_cast<clblast::Layout>(layout),
+                                 n, nrhs,
+                                 a_buffer, a_offset, a_ld,
+                                 ipiv_buffer, ipiv_offset,
+                                 b_buffer, b_offset, b_ld,
+                                 x_buffer, x_offset, x_ld,
+                                 info_buffer, info_offset,
+                                 iter_buffer, iter_offset,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgesvMixed(const CLBlastLayout layout,
+                                    const size_t n, const size_t nrhs,
+                                    cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                    cl_mem ipiv_buffer, const size_t ipiv_offset,
+                                    const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                    cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                                    cl_mem info_buffer, const size_t info_offset,
+                                    cl_mem iter_buffer, const size_t iter_offset,
+                                    cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GesvMixed<double2>(static_cast<clblast::Layout>(layout),
+                                  n, nrhs,
+                                  a_buffer, a_offset, a_ld,
+                                  ipiv_buffer, ipiv_offset,
+                                  b_buffer, b_offset, b_ld,
+                                  x_buffer, x_offset, x_ld,
+                                  info_buffer, info_offset,
+                                  iter_buffer, iter_offset,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// Device-scalar versions of AXPY, SCAL, AXPBY, GEMV and GEMM
+CLBlastStatusCode CLBlastSaxpyDevice(const size_t n,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyDevice<float>(n,
+                                 alpha_buffer, alpha_offset,
+                                 x_buffer, x_offset, x_inc,
+                                 y_buffer, y_offset, y_inc,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDaxpyDevice(const size_t n,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyDevice<double>(n,
+                                  alpha_buffer, alpha_offset,
+                                  x_buffer, x_offset, x_inc,
+                                  y_buffer, y_offset, y_inc,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCaxpyDevice(const size_t n,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyDevice<float2>(n,
+                                  alpha_buffer, alpha_offset,
+                                  x_buffer, x_offset, x_inc,
+                                  y_buffer, y_offset, y_inc,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZaxpyDevice(const size_t n,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyDevice<double2>(n,
+                                   alpha_buffer, alpha_offset,
+                                   x_buffer, x_offset, x_inc,
+                                   y_buffer, y_offset, y_inc,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHaxpyDevice(const size_t n,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyDevice<half>(n,
+                                alpha_buffer, alpha_offset,
+                                x_buffer, x_offset, x_inc,
+                                y_buffer, y_offset, y_inc,
+                                queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastSscalDevice(const size_t n,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ScalDevice<float>(n,
+                                 alpha_buffer, alpha_offset,
+                                 x_buffer, x_offset, x_inc,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDscalDevice(const size_t n,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ScalDevice<double>(n,
+                                  alpha_buffer, alpha_offset,
+                                  x_buffer, x_offset, x_inc,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCscalDevice(const size_t n,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ScalDevice<float2>(n,
+                                  alpha_buffer, alpha_offset,
+                                  x_buffer, x_offset, x_inc,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZscalDevice(const size_t n,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ScalDevice<double2>(n,
+                                   alpha_buffer, alpha_offset,
+                                   x_buffer, x_offset, x_inc,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHscalDevice(const size_t n,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ScalDevice<half>(n,
+                                alpha_buffer, alpha_offset,
+                                x_buffer, x_offset, x_inc,
+                                queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastSaxpbyDevice(const size_t n,
+                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                      const cl_mem beta_buffer, const size_t beta_offset,
+                                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpbyDevice<float>(n,
+                                  alpha_buffer, alpha_offset,
+                                  x_buffer, x_offset, x_inc,
+                                  beta_buffer, beta_offset,
+                                  y_buffer, y_offset, y_inc,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDaxpbyDevice(const size_t n,
+                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                      const cl_mem beta_buffer, const size_t beta_offset,
+                                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpbyDevice<double>(n,
+                                   alpha_buffer, alpha_offset,
+                                   x_buffer, x_offset, x_inc,
+                                   beta_buffer, beta_offset,
+                                   y_buffer, y_offset, y_inc,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCaxpbyDevice(const size_t n,
+                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                      const cl_mem beta_buffer, const size_t beta_offset,
+                                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpbyDevice<float2>(n,
+                                   alpha_buffer, alpha_offset,
+                                   x_buffer, x_offset, x_inc,
+                                   beta_buffer, beta_offset,
+                                   y_buffer, y_offset, y_inc,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZaxpbyDevice(const size_t n,
+                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                      const cl_mem beta_buffer, const size_t beta_offset,
+                                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpbyDevice<double2>(n,
+                                    alpha_buffer, alpha_offset,
+                                    x_buffer, x_offset, x_inc,
+                                    beta_buffer, beta_offset,
+                                    y_buffer, y_offset, y_inc,
+                                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHaxpbyDevice(const size_t n,
+                                      const cl_mem alpha_buffer, const size_t alpha_offset,
+                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                      const cl_mem beta_buffer, const size_t beta_offset,
+                                      cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpbyDevice<half>(n,
+                                 alpha_buffer, alpha_offset,
+                                 x_buffer, x_offset, x_inc,
+                                 beta_buffer, beta_offset,
+                                 y_buffer, y_offset, y_inc,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastSgemvDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                     const size_t m, const size_t n,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     const cl_mem beta_buffer, const size_t beta_offset,
+                                     cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvDevice<float>(static_cast<clblast::Layout>(layout),
+                                 static_cast<clblast::Transpose>(a_transpose),
+                                 m, n,
+                                 alpha_buffer, alpha_offset,
+                                 a_buffer, a_offset, a_ld,
+                                 x_buffer, x_offset, x_inc,
+                                 beta_buffer, beta_offset,
+                                 y_buffer, y_offset, y_inc,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemvDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                     const size_t m, const size_t n,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     const cl_mem beta_buffer, const size_t beta_offset,
+                                     cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvDevice<double>(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  alpha_buffer, alpha_offset,
+                                  a_buffer, a_offset, a_ld,
+                                  x_buffer, x_offset, x_inc,
+                                  beta_buffer, beta_offset,
+                                  y_buffer, y_offset, y_inc,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemvDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                     const size_t m, const size_t n,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     const cl_mem beta_buffer, const size_t beta_offset,
+                                     cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvDevice<float2>(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  alpha_buffer, alpha_offset,
+                                  a_buffer, a_offset, a_ld,
+                                  x_buffer, x_offset, x_inc,
+                                  beta_buffer, beta_offset,
+                                  y_buffer, y_offset, y_inc,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemvDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                     const size_t m, const size_t n,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     const cl_mem beta_buffer, const size_t beta_offset,
+                                     cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvDevice<double2>(static_cast<clblast::Layout>(layout),
+                                   static_cast<clblast::Transpose>(a_transpose),
+                                   m, n,
+                                   alpha_buffer, alpha_offset,
+                                   a_buffer, a_offset, a_ld,
+                                   x_buffer, x_offset, x_inc,
+                                   beta_buffer, beta_offset,
+                                   y_buffer, y_offset, y_inc,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemvDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                     const size_t m, const size_t n,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                     const cl_mem beta_buffer, const size_t beta_offset,
+                                     cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvDevice<half>(static_cast<clblast::Layout>(layout),
+                                static_cast<clblast::Transpose>(a_transpose),
+                                m, n,
+                                alpha_buffer, alpha_offset,
+                                a_buffer, a_offset, a_ld,
+                                x_buffer, x_offset, x_inc,
+                                beta_buffer, beta_offset,
+                                y_buffer, y_offset, y_inc,
+                                queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastSgemmDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const cl_mem beta_buffer, const size_t beta_offset,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmDevice<float>(static_cast<clblast::Layout>(layout),
+                                 static_cast<clblast::Transpose>(a_transpose),
+                                 static_cast<clblast::Transpose>(b_transpose),
+                                 m, n, k,
+                                 alpha_buffer, alpha_offset,
+                                 a_buffer, a_offset, a_ld,
+                                 b_buffer, b_offset, b_ld,
+                                 beta_buffer, beta_offset,
+                                 c_buffer, c_offset, c_ld,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgemmDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const cl_mem beta_buffer, const size_t beta_offset,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmDevice<double>(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Transpose>(b_transpose),
+                                  m, n, k,
+                                  alpha_buffer, alpha_offset,
+                                  a_buffer, a_offset, a_ld,
+                                  b_buffer, b_offset, b_ld,
+                                  beta_buffer, beta_offset,
+                                  c_buffer, c_offset, c_ld,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgemmDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const cl_mem beta_buffer, const size_t beta_offset,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmDevice<float2>(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  static_cast<clblast::Transpose>(b_transpose),
+                                  m, n, k,
+                                  alpha_buffer, alpha_offset,
+                                  a_buffer, a_offset, a_ld,
+                                  b_buffer, b_offset, b_ld,
+                                  beta_buffer, beta_offset,
+                                  c_buffer, c_offset, c_ld,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemmDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const cl_mem beta_buffer, const size_t beta_offset,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmDevice<double2>(static_cast<clblast::Layout>(layout),
+                                   static_cast<clblast::Transpose>(a_transpose),
+                                   static_cast<clblast::Transpose>(b_transpose),
+                                   m, n, k,
+                                   alpha_buffer, alpha_offset,
+                                   a_buffer, a_offset, a_ld,
+                                   b_buffer, b_offset, b_ld,
+                                   beta_buffer, beta_offset,
+                                   c_buffer, c_offset, c_ld,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgemmDevice(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_mem alpha_buffer, const size_t alpha_offset,
+                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                     const cl_mem beta_buffer, const size_t beta_offset,
+                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmDevice<half>(static_cast<clblast::Layout>(layout),
+                                static_cast<clblast::Transpose>(a_transpose),
+                                static_cast<clblast::Transpose>(b_transpose),
+                                m, n, k,
+                                alpha_buffer, alpha_offset,
+                                a_buffer, a_offset, a_ld,
+                                b_buffer, b_offset, b_ld,
+                                beta_buffer, beta_offset,
+                                c_buffer, c_offset, c_ld,
+                                queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// GERK
+CLBlastStatusCode CLBlastSgerk(const CLBlastLayout layout,
+                               const size_t m, const size_t n, const size_t k,
+                               const float alpha,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                               const cl_mem y_buffer, const size_t y_offset, const size_t y_ld,
+                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gerk(static_cast<clblast::Layout>(layout),
                     m, n, k,
-                    double2{alpha.s[0], alpha.s[1]},
+                    alpha,
+                    x_buffer, x_offset, x_ld,
+                    y_buffer, y_offset, y_ld,
                     a_buffer, a_offset, a_ld,
-                    b_buffer, b_offset, b_ld,
-                    double2{beta.s[0], beta.s[1]},
-                    c_buffer, c_offset, c_ld,
-                    queue, event, temp_buffer)
+                    queue, event)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
-CLBlastStatusCode CLBlastHgemmWithTempBuffer(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
-                                             const size_t m, const size_t n, const size_t k,
-                                             const cl_half alpha,
-                                             const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
-                                             const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
-                                             const cl_half beta,
-                                             cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
-                                             cl_command_queue* queue, cl_event* event,
-                                             cl_mem temp_buffer) {
+CLBlastStatusCode CLBlastDgerk(const CLBlastLayout layout,
+                               const size_t m, const size_t n, const size_t k,
+                               const double alpha,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                               const cl_mem y_buffer, const size_t y_offset, const size_t y_ld,
+                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               cl_command_queue* queue, cl_event* event) {
   try {
     return static_cast<CLBlastStatusCode>(
-      clblast::Gemm(static_cast<clblast::Layout>(layout),
-                    static_cast<clblast::Transpose>(a_transpose),
-                    static_cast<clblast::Transpose>(b_transpose),
+      clblast::Gerk(static_cast<clblast::Layout>(layout),
                     m, n, k,
                     alpha,
+                    x_buffer, x_offset, x_ld,
+                    y_buffer, y_offset, y_ld,
                     a_buffer, a_offset, a_ld,
-                    b_buffer, b_offset, b_ld,
-                    beta,
-                    c_buffer, c_offset, c_ld,
-                    queue, event, temp_buffer)
+                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgerk(const CLBlastLayout layout,
+                               const size_t m, const size_t n, const size_t k,
+                               const cl_half alpha,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_ld,
+                               const cl_mem y_buffer, const size_t y_offset, const size_t y_ld,
+                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gerk(static_cast<clblast::Layout>(layout),
+                    m, n, k,
+                    alpha,
+                    x_buffer, x_offset, x_ld,
+                    y_buffer, y_offset, y_ld,
+                    a_buffer, a_offset, a_ld,
+                    queue, event)
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
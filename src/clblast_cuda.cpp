@@ -26,12 +26,22 @@ namespace clblast {
 
 // Generate givens plane rotation: SROTG/DROTG
 template <typename T>
-StatusCode Rotg(CUdeviceptr, const size_t,
-                CUdeviceptr, const size_t,
-                CUdeviceptr, const size_t,
-                CUdeviceptr, const size_t,
-                const CUcontext, const CUdevice) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotg(CUdeviceptr sa_buffer, const size_t sa_offset,
+                CUdeviceptr sb_buffer, const size_t sb_offset,
+                CUdeviceptr sc_buffer, const size_t sc_offset,
+                CUdeviceptr ss_buffer, const size_t ss_offset,
+                const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xrotg<T>(queue_cpp, nullptr);
+    routine.DoRotg(Buffer<T>(sa_buffer), sa_offset,
+                   Buffer<T>(sb_buffer), sb_offset,
+                   Buffer<T>(sc_buffer), sc_offset,
+                   Buffer<T>(ss_buffer), ss_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rotg<float>(CUdeviceptr, const size_t,
                                            CUdeviceptr, const size_t,
@@ -46,13 +56,24 @@ template StatusCode PUBLIC_API Rotg<double>(CUdeviceptr, const size_t,
 
 // Generate modified givens plane rotation: SROTMG/DROTMG
 template <typename T>
-StatusCode Rotmg(CUdeviceptr, const size_t,
-                 CUdeviceptr, const size_t,
-                 CUdeviceptr, const size_t,
-                 const CUdeviceptr, const size_t,
-                 CUdeviceptr, const size_t,
-                 const CUcontext, const CUdevice) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotmg(CUdeviceptr sd1_buffer, const size_t sd1_offset,
+                 CUdeviceptr sd2_buffer, const size_t sd2_offset,
+                 CUdeviceptr sx1_buffer, const size_t sx1_offset,
+                 const CUdeviceptr sy1_buffer, const size_t sy1_offset,
+                 CUdeviceptr sparam_buffer, const size_t sparam_offset,
+                 const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xrotmg<T>(queue_cpp, nullptr);
+    routine.DoRotmg(Buffer<T>(sd1_buffer), sd1_offset,
+                    Buffer<T>(sd2_buffer), sd2_offset,
+                    Buffer<T>(sx1_buffer), sx1_offset,
+                    Buffer<T>(sy1_buffer), sy1_offset,
+                    Buffer<T>(sparam_buffer), sparam_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rotmg<float>(CUdeviceptr, const size_t,
                                             CUdeviceptr, const size_t,
@@ -69,13 +90,24 @@ template StatusCode PUBLIC_API Rotmg<double>(CUdeviceptr, const size_t,
 
 // Apply givens plane rotation: SROT/DROT
 template <typename T>
-StatusCode Rot(const size_t,
-               CUdeviceptr, const size_t, const size_t,
-               CUdeviceptr, const size_t, const size_t,
-               const T,
-               const T,
-               const CUcontext, const CUdevice) {
-  return StatusCode::kNotImplemented;
+StatusCode Rot(const size_t n,
+               CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+               CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+               const T cos,
+               const T sin,
+               const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xrot<T>(queue_cpp, nullptr);
+    routine.DoRot(n,
+                  Buffer<T>(x_buffer), x_offset, x_inc,
+                  Buffer<T>(y_buffer), y_offset, y_inc,
+                  cos,
+                  sin);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rot<float>(const size_t,
                                           CUdeviceptr, const size_t, const size_t,
@@ -92,12 +124,22 @@ template StatusCode PUBLIC_API Rot<double>(const size_t,
 
 // Apply modified givens plane rotation: SROTM/DROTM
 template <typename T>
-StatusCode Rotm(const size_t,
-                CUdeviceptr, const size_t, const size_t,
-                CUdeviceptr, const size_t, const size_t,
-                CUdeviceptr, const size_t,
-                const CUcontext, const CUdevice) {
-  return StatusCode::kNotImplemented;
+StatusCode Rotm(const size_t n,
+                CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                CUdeviceptr sparam_buffer, const size_t sparam_offset,
+                const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xrotm<T>(queue_cpp, nullptr);
+    routine.DoRotm(n,
+                   Buffer<T>(x_buffer), x_offset, x_inc,
+                   Buffer<T>(y_buffer), y_offset, y_inc,
+                   Buffer<T>(sparam_buffer), sparam_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Rotm<float>(const size_t,
                                            CUdeviceptr, const size_t, const size_t,
@@ -1219,12 +1261,22 @@ template StatusCode PUBLIC_API Trsv<double2>(const Layout, const Triangle, const
 
 // Solves a banded triangular system of equations: STBSV/DTBSV/CTBSV/ZTBSV
 template <typename T>
-StatusCode Tbsv(const Layout, const Triangle, const Transpose, const Diagonal,
-                const size_t, const size_t,
-                const CUdeviceptr, const size_t, const size_t,
-                CUdeviceptr, const size_t, const size_t,
-                const CUcontext, const CUdevice) {
-  return StatusCode::kNotImplemented;
+StatusCode Tbsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n, const size_t k,
+                const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld,
+                CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xtbsv<T>(queue_cpp, nullptr);
+    routine.DoTbsv(layout, triangle, a_transpose, diagonal,
+                   n, k,
+                   Buffer<T>(a_buffer), a_offset, a_ld,
+                   Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Tbsv<float>(const Layout, const Triangle, const Transpose, const Diagonal,
                                            const size_t, const size_t,
@@ -1249,12 +1301,22 @@ template StatusCode PUBLIC_API Tbsv<double2>(const Layout, const Triangle, const
 
 // Solves a packed triangular system of equations: STPSV/DTPSV/CTPSV/ZTPSV
 template <typename T>
-StatusCode Tpsv(const Layout, const Triangle, const Transpose, const Diagonal,
-                const size_t,
-                const CUdeviceptr, const size_t,
-                CUdeviceptr, const size_t, const size_t,
-                const CUcontext, const CUdevice) {
-  return StatusCode::kNotImplemented;
+StatusCode Tpsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n,
+                const CUdeviceptr ap_buffer, const size_t ap_offset,
+                CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xtpsv<T>(queue_cpp, nullptr);
+    routine.DoTpsv(layout, triangle, a_transpose, diagonal,
+                   n,
+                   Buffer<T>(ap_buffer), ap_offset,
+                   Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Tpsv<float>(const Layout, const Triangle, const Transpose, const Diagonal,
                                            const size_t,
@@ -2260,6 +2322,259 @@ template StatusCode PUBLIC_API Had<half>(const size_t,
                                          CUdeviceptr, const size_t, const size_t,
                                          const CUcontext, const CUdevice);
 
+// Vector-times-constant plus scaled vector: SAXPBY/DAXPBY/CAXPBY/ZAXPBY/HAXPBY
+template <typename T>
+StatusCode Axpby(const size_t n,
+                 const T alpha,
+                 const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta,
+                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                 const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xaxpby<T>(queue_cpp, nullptr);
+    routine.DoAxpby(n,
+                    alpha,
+                    Buffer<T>(x_buffer), x_offset, x_inc,
+                    beta,
+                    Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Axpby<float>(const size_t,
+                                            const float,
+                                            const CUdeviceptr, const size_t, const size_t,
+                                            const float,
+                                            CUdeviceptr, const size_t, const size_t,
+                                            const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpby<double>(const size_t,
+                                             const double,
+                                             const CUdeviceptr, const size_t, const size_t,
+                                             const double,
+                                             CUdeviceptr, const size_t, const size_t,
+                                             const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpby<float2>(const size_t,
+                                             const float2,
+                                             const CUdeviceptr, const size_t, const size_t,
+                                             const float2,
+                                             CUdeviceptr, const size_t, const size_t,
+                                             const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpby<double2>(const size_t,
+                                              const double2,
+                                              const CUdeviceptr, const size_t, const size_t,
+                                              const double2,
+                                              CUdeviceptr, const size_t, const size_t,
+                                              const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpby<half>(const size_t,
+                                           const half,
+                                           const CUdeviceptr, const size_t, const size_t,
+                                           const half,
+                                           CUdeviceptr, const size_t, const size_t,
+                                           const CUcontext, const CUdevice);
+
+// Sets all elements of a vector to a constant: SSET/DSET/CSET/ZSET/HSET
+template <typename T>
+StatusCode Set(const size_t n,
+               const T alpha,
+               CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+               const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xset<T>(queue_cpp, nullptr);
+    routine.DoSet(n,
+                  alpha,
+                  Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Set<float>(const size_t,
+                                          const float,
+                                          CUdeviceptr, const size_t, const size_t,
+                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Set<double>(const size_t,
+                                           const double,
+                                           CUdeviceptr, const size_t, const size_t,
+                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Set<float2>(const size_t,
+                                           const float2,
+                                           CUdeviceptr, const size_t, const size_t,
+                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Set<double2>(const size_t,
+                                            const double2,
+                                            CUdeviceptr, const size_t, const size_t,
+                                            const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Set<half>(const size_t,
+                                         const half,
+                                         CUdeviceptr, const size_t, const size_t,
+                                         const CUcontext, const CUdevice);
+
+// Two fused vector-times-constant plus vector operations: SAXPY2/DAXPY2/CAXPY2/ZAXPY2/HAXPY2
+template <typename T>
+StatusCode Axpy2(const size_t n,
+                 const T alpha,
+                 const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                 CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                 const T beta,
+                 const CUdeviceptr z_buffer, const size_t z_offset, const size_t z_inc,
+                 CUdeviceptr w_buffer, const size_t w_offset, const size_t w_inc,
+                 const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xaxpy2<T>(queue_cpp, nullptr);
+    routine.DoAxpy2(n,
+                    alpha,
+                    Buffer<T>(x_buffer), x_offset, x_inc,
+                    Buffer<T>(y_buffer), y_offset, y_inc,
+                    beta,
+                    Buffer<T>(z_buffer), z_offset, z_inc,
+                    Buffer<T>(w_buffer), w_offset, w_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Axpy2<float>(const size_t,
+                                            const float,
+                                            const CUdeviceptr, const size_t, const size_t,
+                                            CUdeviceptr, const size_t, const size_t,
+                                            const float,
+                                            const CUdeviceptr, const size_t, const size_t,
+                                            CUdeviceptr, const size_t, const size_t,
+                                            const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpy2<double>(const size_t,
+                                             const double,
+                                             const CUdeviceptr, const size_t, const size_t,
+                                             CUdeviceptr, const size_t, const size_t,
+                                             const double,
+                                             const CUdeviceptr, const size_t, const size_t,
+                                             CUdeviceptr, const size_t, const size_t,
+                                             const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpy2<float2>(const size_t,
+                                             const float2,
+                                             const CUdeviceptr, const size_t, const size_t,
+                                             CUdeviceptr, const size_t, const size_t,
+                                             const float2,
+                                             const CUdeviceptr, const size_t, const size_t,
+                                             CUdeviceptr, const size_t, const size_t,
+                                             const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpy2<double2>(const size_t,
+                                              const double2,
+                                              const CUdeviceptr, const size_t, const size_t,
+                                              CUdeviceptr, const size_t, const size_t,
+                                              const double2,
+                                              const CUdeviceptr, const size_t, const size_t,
+                                              CUdeviceptr, const size_t, const size_t,
+                                              const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpy2<half>(const size_t,
+                                           const half,
+                                           const CUdeviceptr, const size_t, const size_t,
+                                           CUdeviceptr, const size_t, const size_t,
+                                           const half,
+                                           const CUdeviceptr, const size_t, const size_t,
+                                           CUdeviceptr, const size_t, const size_t,
+                                           const CUcontext, const CUdevice);
+
+// Fused vector update and dot product: SAXPYDOT/DAXPYDOT/HAXPYDOT
+template <typename T>
+StatusCode Axpydot(const size_t n,
+                   CUdeviceptr dot_buffer, const size_t dot_offset,
+                   const T alpha,
+                   const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                   CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                   const CUdeviceptr z_buffer, const size_t z_offset, const size_t z_inc,
+                   const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xaxpydot<T>(queue_cpp, nullptr);
+    routine.DoAxpydot(n,
+                      Buffer<T>(dot_buffer), dot_offset,
+                      alpha,
+                      Buffer<T>(x_buffer), x_offset, x_inc,
+                      Buffer<T>(y_buffer), y_offset, y_inc,
+                      Buffer<T>(z_buffer), z_offset, z_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Axpydot<float>(const size_t,
+                                              CUdeviceptr, const size_t,
+                                              const float,
+                                              const CUdeviceptr, const size_t, const size_t,
+                                              CUdeviceptr, const size_t, const size_t,
+                                              const CUdeviceptr, const size_t, const size_t,
+                                              const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpydot<double>(const size_t,
+                                               CUdeviceptr, const size_t,
+                                               const double,
+                                               const CUdeviceptr, const size_t, const size_t,
+                                               CUdeviceptr, const size_t, const size_t,
+                                               const CUdeviceptr, const size_t, const size_t,
+                                               const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpydot<half>(const size_t,
+                                             CUdeviceptr, const size_t,
+                                             const half,
+                                             const CUdeviceptr, const size_t, const size_t,
+                                             CUdeviceptr, const size_t, const size_t,
+                                             const CUdeviceptr, const size_t, const size_t,
+                                             const CUcontext, const CUdevice);
+
+// Fused vector update and Euclidian norm: SAXPYNRM2/DAXPYNRM2/CAXPYNRM2/ZAXPYNRM2/HAXPYNRM2
+template <typename T>
+StatusCode Axpynrm2(const size_t n,
+                    CUdeviceptr nrm2_buffer, const size_t nrm2_offset,
+                    const T alpha,
+                    const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc,
+                    CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc,
+                    const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xaxpynrm2<T>(queue_cpp, nullptr);
+    routine.DoAxpynrm2(n,
+                       Buffer<T>(nrm2_buffer), nrm2_offset,
+                       alpha,
+                       Buffer<T>(x_buffer), x_offset, x_inc,
+                       Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Axpynrm2<float>(const size_t,
+                                               CUdeviceptr, const size_t,
+                                               const float,
+                                               const CUdeviceptr, const size_t, const size_t,
+                                               CUdeviceptr, const size_t, const size_t,
+                                               const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpynrm2<double>(const size_t,
+                                                CUdeviceptr, const size_t,
+                                                const double,
+                                                const CUdeviceptr, const size_t, const size_t,
+                                                CUdeviceptr, const size_t, const size_t,
+                                                const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpynrm2<float2>(const size_t,
+                                                CUdeviceptr, const size_t,
+                                                const float2,
+                                                const CUdeviceptr, const size_t, const size_t,
+                                                CUdeviceptr, const size_t, const size_t,
+                                                const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpynrm2<double2>(const size_t,
+                                                 CUdeviceptr, const size_t,
+                                                 const double2,
+                                                 const CUdeviceptr, const size_t, const size_t,
+                                                 CUdeviceptr, const size_t, const size_t,
+                                                 const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Axpynrm2<half>(const size_t,
+                                              CUdeviceptr, const size_t,
+                                              const half,
+                                              const CUdeviceptr, const size_t, const size_t,
+                                              CUdeviceptr, const size_t, const size_t,
+                                              const CUcontext, const CUdevice);
+
 // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
 template <typename T>
 StatusCode Omatcopy(const Layout layout, const Transpose a_transpose,
@@ -2502,34 +2817,154 @@ template StatusCode PUBLIC_API AxpyBatched<half>(const size_t,
                                                  const size_t,
                                                  const CUcontext, const CUdevice);
 
-// Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
+// Batched version of AXPBY: SAXPBYBATCHED/DAXPBYBATCHED/CAXPBYBATCHED/ZAXPBYBATCHED/HAXPBYBATCHED
 template <typename T>
-StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
-                       const size_t m, const size_t n, const size_t k,
-                       const T *alphas,
-                       const CUdeviceptr a_buffer, const size_t *a_offsets, const size_t a_ld,
-                       const CUdeviceptr b_buffer, const size_t *b_offsets, const size_t b_ld,
-                       const T *betas,
-                       CUdeviceptr c_buffer, const size_t *c_offsets, const size_t c_ld,
-                       const size_t batch_count,
-                       const CUcontext context, const CUdevice device) {
+StatusCode AxpbyBatched(const size_t n,
+                        const T *alphas,
+                        const CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                        const T *betas,
+                        CUdeviceptr y_buffer, const size_t *y_offsets, const size_t y_inc,
+                        const size_t batch_count,
+                        const CUcontext context, const CUdevice device) {
   try {
     const auto context_cpp = Context(context);
     const auto device_cpp = Device(device);
     auto queue_cpp = Queue(context_cpp, device_cpp);
-    auto routine = XgemmBatched<T>(queue_cpp, nullptr);
+    auto routine = XaxpbyBatched<T>(queue_cpp, nullptr);
     auto alphas_cpp = std::vector<T>();
     auto betas_cpp = std::vector<T>();
-    auto a_offsets_cpp = std::vector<size_t>();
-    auto b_offsets_cpp = std::vector<size_t>();
-    auto c_offsets_cpp = std::vector<size_t>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
     for (auto batch = size_t{0}; batch < batch_count; ++batch) {
       alphas_cpp.push_back(alphas[batch]);
       betas_cpp.push_back(betas[batch]);
-      a_offsets_cpp.push_back(a_offsets[batch]);
-      b_offsets_cpp.push_back(b_offsets[batch]);
-      c_offsets_cpp.push_back(c_offsets[batch]);
-    }
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+    }
+    routine.DoAxpbyBatched(n,
+                           alphas_cpp,
+                           Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                           betas_cpp,
+                           Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
+                           batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AxpbyBatched<float>(const size_t,
+                                                   const float*,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   const float*,
+                                                   CUdeviceptr, const size_t*, const size_t,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpbyBatched<double>(const size_t,
+                                                    const double*,
+                                                    const CUdeviceptr, const size_t*, const size_t,
+                                                    const double*,
+                                                    CUdeviceptr, const size_t*, const size_t,
+                                                    const size_t,
+                                                    const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpbyBatched<float2>(const size_t,
+                                                    const float2*,
+                                                    const CUdeviceptr, const size_t*, const size_t,
+                                                    const float2*,
+                                                    CUdeviceptr, const size_t*, const size_t,
+                                                    const size_t,
+                                                    const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpbyBatched<double2>(const size_t,
+                                                     const double2*,
+                                                     const CUdeviceptr, const size_t*, const size_t,
+                                                     const double2*,
+                                                     CUdeviceptr, const size_t*, const size_t,
+                                                     const size_t,
+                                                     const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AxpbyBatched<half>(const size_t,
+                                                  const half*,
+                                                  const CUdeviceptr, const size_t*, const size_t,
+                                                  const half*,
+                                                  CUdeviceptr, const size_t*, const size_t,
+                                                  const size_t,
+                                                  const CUcontext, const CUdevice);
+
+// Batched version of SET: SSETBATCHED/DSETBATCHED/CSETBATCHED/ZSETBATCHED/HSETBATCHED
+template <typename T>
+StatusCode SetBatched(const size_t n,
+                      const T *alphas,
+                      CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                      const size_t batch_count,
+                      const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XsetBatched<T>(queue_cpp, nullptr);
+    auto alphas_cpp = std::vector<T>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+    }
+    routine.DoSetBatched(n,
+                         alphas_cpp,
+                         Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                         batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API SetBatched<float>(const size_t,
+                                                 const float*,
+                                                 CUdeviceptr, const size_t*, const size_t,
+                                                 const size_t,
+                                                 const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SetBatched<double>(const size_t,
+                                                  const double*,
+                                                  CUdeviceptr, const size_t*, const size_t,
+                                                  const size_t,
+                                                  const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SetBatched<float2>(const size_t,
+                                                  const float2*,
+                                                  CUdeviceptr, const size_t*, const size_t,
+                                                  const size_t,
+                                                  const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SetBatched<double2>(const size_t,
+                                                   const double2*,
+                                                   CUdeviceptr, const size_t*, const size_t,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API SetBatched<half>(const size_t,
+                                                const half*,
+                                                CUdeviceptr, const size_t*, const size_t,
+                                                const size_t,
+                                                const CUcontext, const CUdevice);
+
+// Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
+template <typename T>
+StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t m, const size_t n, const size_t k,
+                       const T *alphas,
+                       const CUdeviceptr a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       const CUdeviceptr b_buffer, const size_t *b_offsets, const size_t b_ld,
+                       const T *betas,
+                       CUdeviceptr c_buffer, const size_t *c_offsets, const size_t c_ld,
+                       const size_t batch_count,
+                       const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XgemmBatched<T>(queue_cpp, nullptr);
+    auto alphas_cpp = std::vector<T>();
+    auto betas_cpp = std::vector<T>();
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto b_offsets_cpp = std::vector<size_t>();
+    auto c_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      betas_cpp.push_back(betas[batch]);
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      b_offsets_cpp.push_back(b_offsets[batch]);
+      c_offsets_cpp.push_back(c_offsets[batch]);
+    }
     routine.DoGemmBatched(layout, a_transpose, b_transpose,
                           m, n, k,
                           alphas_cpp,
@@ -2660,6 +3095,524 @@ template StatusCode PUBLIC_API GemmStridedBatched<half>(const Layout, const Tran
                                                         const size_t,
                                                         const CUcontext, const CUdevice);
 
+// Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+template <typename T>
+StatusCode GemvBatched(const Layout layout, const Transpose a_transpose,
+                       const size_t m, const size_t n,
+                       const T *alphas,
+                       const CUdeviceptr a_buffer, const size_t *a_offsets, const size_t a_ld,
+                       const CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const T *betas,
+                       CUdeviceptr y_buffer, const size_t *y_offsets, const size_t y_inc,
+                       const size_t batch_count,
+                       const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XgemvBatched<T>(queue_cpp, nullptr);
+    auto alphas_cpp = std::vector<T>();
+    auto betas_cpp = std::vector<T>();
+    auto a_offsets_cpp = std::vector<size_t>();
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      alphas_cpp.push_back(alphas[batch]);
+      betas_cpp.push_back(betas[batch]);
+      a_offsets_cpp.push_back(a_offsets[batch]);
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+    }
+    routine.DoGemvBatched(layout, a_transpose,
+                          m, n,
+                          alphas_cpp,
+                          Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                          Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                          betas_cpp,
+                          Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvBatched<float>(const Layout, const Transpose,
+                                                  const size_t, const size_t,
+                                                  const float*,
+                                                  const CUdeviceptr, const size_t*, const size_t,
+                                                  const CUdeviceptr, const size_t*, const size_t,
+                                                  const float*,
+                                                  CUdeviceptr, const size_t*, const size_t,
+                                                  const size_t,
+                                                  const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvBatched<double>(const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const double*,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   const double*,
+                                                   CUdeviceptr, const size_t*, const size_t,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvBatched<float2>(const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const float2*,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   const float2*,
+                                                   CUdeviceptr, const size_t*, const size_t,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvBatched<double2>(const Layout, const Transpose,
+                                                    const size_t, const size_t,
+                                                    const double2*,
+                                                    const CUdeviceptr, const size_t*, const size_t,
+                                                    const CUdeviceptr, const size_t*, const size_t,
+                                                    const double2*,
+                                                    CUdeviceptr, const size_t*, const size_t,
+                                                    const size_t,
+                                                    const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvBatched<half>(const Layout, const Transpose,
+                                                 const size_t, const size_t,
+                                                 const half*,
+                                                 const CUdeviceptr, const size_t*, const size_t,
+                                                 const CUdeviceptr, const size_t*, const size_t,
+                                                 const half*,
+                                                 CUdeviceptr, const size_t*, const size_t,
+                                                 const size_t,
+                                                 const CUcontext, const CUdevice);
+
+// StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+template <typename T>
+StatusCode GemvStridedBatched(const Layout layout, const Transpose a_transpose,
+                              const size_t m, const size_t n,
+                              const T alpha,
+                              const CUdeviceptr a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                              const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const T beta,
+                              CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XgemvStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoGemvStridedBatched(layout, a_transpose,
+                                 m, n,
+                                 alpha,
+                                 Buffer<T>(a_buffer), a_offset, a_ld, a_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 beta,
+                                 Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvStridedBatched<float>(const Layout, const Transpose,
+                                                         const size_t, const size_t,
+                                                         const float,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const float,
+                                                         CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvStridedBatched<double>(const Layout, const Transpose,
+                                                          const size_t, const size_t,
+                                                          const double,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const double,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvStridedBatched<float2>(const Layout, const Transpose,
+                                                          const size_t, const size_t,
+                                                          const float2,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const float2,
+                                                          CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvStridedBatched<double2>(const Layout, const Transpose,
+                                                           const size_t, const size_t,
+                                                           const double2,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const double2,
+                                                           CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemvStridedBatched<half>(const Layout, const Transpose,
+                                                        const size_t, const size_t,
+                                                        const half,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const half,
+                                                        CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        const CUcontext, const CUdevice);
+
+// Batched version of DOT: SDOTBATCHED/DDOTBATCHED/HDOTBATCHED
+template <typename T>
+StatusCode DotBatched(const size_t n,
+                      CUdeviceptr dot_buffer, const size_t *dot_offsets,
+                      const CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                      const CUdeviceptr y_buffer, const size_t *y_offsets, const size_t y_inc,
+                      const size_t batch_count,
+                      const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XdotBatched<T>(queue_cpp, nullptr);
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto y_offsets_cpp = std::vector<size_t>();
+    auto dot_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      y_offsets_cpp.push_back(y_offsets[batch]);
+      dot_offsets_cpp.push_back(dot_offsets[batch]);
+    }
+    routine.DoDotBatched(n,
+                         Buffer<T>(dot_buffer), dot_offsets_cpp,
+                         Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                         Buffer<T>(y_buffer), y_offsets_cpp, y_inc,
+                         batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API DotBatched<float>(const size_t,
+                                                 CUdeviceptr, const size_t*,
+                                                 const CUdeviceptr, const size_t*, const size_t,
+                                                 const CUdeviceptr, const size_t*, const size_t,
+                                                 const size_t,
+                                                 const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API DotBatched<double>(const size_t,
+                                                  CUdeviceptr, const size_t*,
+                                                  const CUdeviceptr, const size_t*, const size_t,
+                                                  const CUdeviceptr, const size_t*, const size_t,
+                                                  const size_t,
+                                                  const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API DotBatched<half>(const size_t,
+                                                CUdeviceptr, const size_t*,
+                                                const CUdeviceptr, const size_t*, const size_t,
+                                                const CUdeviceptr, const size_t*, const size_t,
+                                                const size_t,
+                                                const CUcontext, const CUdevice);
+
+// StridedBatched version of DOT: SDOTSTRIDEDBATCHED/DDOTSTRIDEDBATCHED/HDOTSTRIDEDBATCHED
+template <typename T>
+StatusCode DotStridedBatched(const size_t n,
+                             CUdeviceptr dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                             const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                             const CUdeviceptr y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                             const size_t batch_count,
+                             const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XdotStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoDotStridedBatched(n,
+                                Buffer<T>(dot_buffer), dot_offset, dot_stride,
+                                Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                Buffer<T>(y_buffer), y_offset, y_inc, y_stride,
+                                batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API DotStridedBatched<float>(const size_t,
+                                                        CUdeviceptr, const size_t, const size_t,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API DotStridedBatched<double>(const size_t,
+                                                         CUdeviceptr, const size_t, const size_t,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API DotStridedBatched<half>(const size_t,
+                                                       CUdeviceptr, const size_t, const size_t,
+                                                       const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                       const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                       const size_t,
+                                                       const CUcontext, const CUdevice);
+
+// Batched version of NRM2: SNRM2BATCHED/DNRM2BATCHED/ScNRM2BATCHED/DzNRM2BATCHED/HNRM2BATCHED
+template <typename T>
+StatusCode Nrm2Batched(const size_t n,
+                       CUdeviceptr nrm2_buffer, const size_t *nrm2_offsets,
+                       const CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const size_t batch_count,
+                       const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xnrm2Batched<T>(queue_cpp, nullptr);
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto nrm2_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      nrm2_offsets_cpp.push_back(nrm2_offsets[batch]);
+    }
+    routine.DoNrm2Batched(n,
+                          Buffer<T>(nrm2_buffer), nrm2_offsets_cpp,
+                          Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Nrm2Batched<float>(const size_t,
+                                                  CUdeviceptr, const size_t*,
+                                                  const CUdeviceptr, const size_t*, const size_t,
+                                                  const size_t,
+                                                  const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Nrm2Batched<double>(const size_t,
+                                                   CUdeviceptr, const size_t*,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Nrm2Batched<float2>(const size_t,
+                                                   CUdeviceptr, const size_t*,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Nrm2Batched<double2>(const size_t,
+                                                    CUdeviceptr, const size_t*,
+                                                    const CUdeviceptr, const size_t*, const size_t,
+                                                    const size_t,
+                                                    const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Nrm2Batched<half>(const size_t,
+                                                 CUdeviceptr, const size_t*,
+                                                 const CUdeviceptr, const size_t*, const size_t,
+                                                 const size_t,
+                                                 const CUcontext, const CUdevice);
+
+// StridedBatched version of NRM2: SNRM2STRIDEDBATCHED/DNRM2STRIDEDBATCHED/ScNRM2STRIDEDBATCHED/DzNRM2STRIDEDBATCHED/HNRM2STRIDEDBATCHED
+template <typename T>
+StatusCode Nrm2StridedBatched(const size_t n,
+                              CUdeviceptr nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                              const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = Xnrm2StridedBatched<T>(queue_cpp, nullptr);
+    routine.DoNrm2StridedBatched(n,
+                                 Buffer<T>(nrm2_buffer), nrm2_offset, nrm2_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Nrm2StridedBatched<float>(const size_t,
+                                                         CUdeviceptr, const size_t, const size_t,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Nrm2StridedBatched<double>(const size_t,
+                                                          CUdeviceptr, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Nrm2StridedBatched<float2>(const size_t,
+                                                          CUdeviceptr, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Nrm2StridedBatched<double2>(const size_t,
+                                                           CUdeviceptr, const size_t, const size_t,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API Nrm2StridedBatched<half>(const size_t,
+                                                        CUdeviceptr, const size_t, const size_t,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        const CUcontext, const CUdevice);
+
+// Batched version of ASUM: SASUMBATCHED/DASUMBATCHED/ScASUMBATCHED/DzASUMBATCHED/HASUMBATCHED
+template <typename T>
+StatusCode AsumBatched(const size_t n,
+                       CUdeviceptr asum_buffer, const size_t *asum_offsets,
+                       const CUdeviceptr x_buffer, const size_t *x_offsets, const size_t x_inc,
+                       const size_t batch_count,
+                       const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XasumBatched<T>(queue_cpp, nullptr);
+    auto x_offsets_cpp = std::vector<size_t>();
+    auto asum_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      x_offsets_cpp.push_back(x_offsets[batch]);
+      asum_offsets_cpp.push_back(asum_offsets[batch]);
+    }
+    routine.DoAsumBatched(n,
+                          Buffer<T>(asum_buffer), asum_offsets_cpp,
+                          Buffer<T>(x_buffer), x_offsets_cpp, x_inc,
+                          batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AsumBatched<float>(const size_t,
+                                                  CUdeviceptr, const size_t*,
+                                                  const CUdeviceptr, const size_t*, const size_t,
+                                                  const size_t,
+                                                  const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AsumBatched<double>(const size_t,
+                                                   CUdeviceptr, const size_t*,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AsumBatched<float2>(const size_t,
+                                                   CUdeviceptr, const size_t*,
+                                                   const CUdeviceptr, const size_t*, const size_t,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AsumBatched<double2>(const size_t,
+                                                    CUdeviceptr, const size_t*,
+                                                    const CUdeviceptr, const size_t*, const size_t,
+                                                    const size_t,
+                                                    const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AsumBatched<half>(const size_t,
+                                                 CUdeviceptr, const size_t*,
+                                                 const CUdeviceptr, const size_t*, const size_t,
+                                                 const size_t,
+                                                 const CUcontext, const CUdevice);
+
+// StridedBatched version of ASUM: SASUMSTRIDEDBATCHED/DASUMSTRIDEDBATCHED/ScASUMSTRIDEDBATCHED/DzASUMSTRIDEDBATCHED/HASUMSTRIDEDBATCHED
+template <typename T>
+StatusCode AsumStridedBatched(const size_t n,
+                              CUdeviceptr asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                              const CUdeviceptr x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                              const size_t batch_count,
+                              const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XasumStridedBatched<T>(queue_cpp, nullptr);
+    routine.DoAsumStridedBatched(n,
+                                 Buffer<T>(asum_buffer), asum_offset, asum_stride,
+                                 Buffer<T>(x_buffer), x_offset, x_inc, x_stride,
+                                 batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AsumStridedBatched<float>(const size_t,
+                                                         CUdeviceptr, const size_t, const size_t,
+                                                         const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                         const size_t,
+                                                         const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AsumStridedBatched<double>(const size_t,
+                                                          CUdeviceptr, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AsumStridedBatched<float2>(const size_t,
+                                                          CUdeviceptr, const size_t, const size_t,
+                                                          const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                          const size_t,
+                                                          const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AsumStridedBatched<double2>(const size_t,
+                                                           CUdeviceptr, const size_t, const size_t,
+                                                           const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                           const size_t,
+                                                           const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API AsumStridedBatched<half>(const size_t,
+                                                        CUdeviceptr, const size_t, const size_t,
+                                                        const CUdeviceptr, const size_t, const size_t, const size_t,
+                                                        const size_t,
+                                                        const CUcontext, const CUdevice);
+
+// =================================================================================================
+
+// Grouped version of GEMM: SGEMMGROUPED/DGEMMGROUPED/CGEMMGROUPED/ZGEMMGROUPED/HGEMMGROUPED
+template <typename T>
+StatusCode GemmGrouped(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                       const size_t *ms, const size_t *ns, const size_t *ks,
+                       const T *alphas,
+                       const CUdeviceptr a_buffer, const size_t *a_offsets, const size_t *a_lds,
+                       const CUdeviceptr b_buffer, const size_t *b_offsets, const size_t *b_lds,
+                       const T *betas,
+                       CUdeviceptr c_buffer, const size_t *c_offsets, const size_t *c_lds,
+                       const size_t group_count,
+                       const CUcontext context, const CUdevice device) {
+  try {
+    const auto context_cpp = Context(context);
+    const auto device_cpp = Device(device);
+    auto queue_cpp = Queue(context_cpp, device_cpp);
+    auto routine = XgemmGrouped<T>(queue_cpp, nullptr);
+    routine.DoGemmGrouped(layout, a_transpose, b_transpose,
+                          std::vector<size_t>(ms, ms + group_count),
+                          std::vector<size_t>(ns, ns + group_count),
+                          std::vector<size_t>(ks, ks + group_count),
+                          std::vector<T>(alphas, alphas + group_count),
+                          Buffer<T>(a_buffer), std::vector<size_t>(a_offsets, a_offsets + group_count),
+                          std::vector<size_t>(a_lds, a_lds + group_count),
+                          Buffer<T>(b_buffer), std::vector<size_t>(b_offsets, b_offsets + group_count),
+                          std::vector<size_t>(b_lds, b_lds + group_count),
+                          std::vector<T>(betas, betas + group_count),
+                          Buffer<T>(c_buffer), std::vector<size_t>(c_offsets, c_offsets + group_count),
+                          std::vector<size_t>(c_lds, c_lds + group_count),
+                          group_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmGrouped<float>(const Layout, const Transpose, const Transpose,
+                                                  const size_t*, const size_t*, const size_t*,
+                                                  const float*,
+                                                  const CUdeviceptr, const size_t*, const size_t*,
+                                                  const CUdeviceptr, const size_t*, const size_t*,
+                                                  const float*,
+                                                  CUdeviceptr, const size_t*, const size_t*,
+                                                  const size_t,
+                                                  const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemmGrouped<double>(const Layout, const Transpose, const Transpose,
+                                                   const size_t*, const size_t*, const size_t*,
+                                                   const double*,
+                                                   const CUdeviceptr, const size_t*, const size_t*,
+                                                   const CUdeviceptr, const size_t*, const size_t*,
+                                                   const double*,
+                                                   CUdeviceptr, const size_t*, const size_t*,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemmGrouped<float2>(const Layout, const Transpose, const Transpose,
+                                                   const size_t*, const size_t*, const size_t*,
+                                                   const float2*,
+                                                   const CUdeviceptr, const size_t*, const size_t*,
+                                                   const CUdeviceptr, const size_t*, const size_t*,
+                                                   const float2*,
+                                                   CUdeviceptr, const size_t*, const size_t*,
+                                                   const size_t,
+                                                   const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemmGrouped<double2>(const Layout, const Transpose, const Transpose,
+                                                    const size_t*, const size_t*, const size_t*,
+                                                    const double2*,
+                                                    const CUdeviceptr, const size_t*, const size_t*,
+                                                    const CUdeviceptr, const size_t*, const size_t*,
+                                                    const double2*,
+                                                    CUdeviceptr, const size_t*, const size_t*,
+                                                    const size_t,
+                                                    const CUcontext, const CUdevice);
+template StatusCode PUBLIC_API GemmGrouped<half>(const Layout, const Transpose, const Transpose,
+                                                 const size_t*, const size_t*, const size_t*,
+                                                 const half*,
+                                                 const CUdeviceptr, const size_t*, const size_t*,
+                                                 const CUdeviceptr, const size_t*, const size_t*,
+                                                 const half*,
+                                                 CUdeviceptr, const size_t*, const size_t*,
+                                                 const size_t,
+                                                 const CUcontext, const CUdevice);
+
 // =================================================================================================
 
 // Retrieves the required size of the temporary buffer for the GEMM kernel (optional)
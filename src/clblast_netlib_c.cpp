@@ -4763,6 +4763,560 @@ void cblas_zhad(const int n,
   z_buffer.Read(queue, z_size, reinterpret_cast<double2*>(z));
 }
 
+// AXPBY
+void cblas_saxpby(const int n,
+                  const float alpha,
+                  const float* x, const int x_inc,
+                  const float beta,
+                  float* y, const int y_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  auto y_buffer = clblast::Buffer<float>(context, y_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          beta_cpp,
+                          y_buffer(), 0, y_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+}
+void cblas_daxpby(const int n,
+                  const double alpha,
+                  const double* x, const int x_inc,
+                  const double beta,
+                  double* y, const int y_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  auto y_buffer = clblast::Buffer<double>(context, y_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          beta_cpp,
+                          y_buffer(), 0, y_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+}
+void cblas_caxpby(const int n,
+                  const void* alpha,
+                  const void* x, const int x_inc,
+                  const void* beta,
+                  void* y, const int y_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  auto x_buffer = clblast::Buffer<float2>(context, x_size);
+  auto y_buffer = clblast::Buffer<float2>(context, y_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          beta_cpp,
+                          y_buffer(), 0, y_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<float2*>(y));
+}
+void cblas_zaxpby(const int n,
+                  const void* alpha,
+                  const void* x, const int x_inc,
+                  const void* beta,
+                  void* y, const int y_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  auto x_buffer = clblast::Buffer<double2>(context, x_size);
+  auto y_buffer = clblast::Buffer<double2>(context, y_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpby(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          beta_cpp,
+                          y_buffer(), 0, y_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<double2*>(y));
+}
+
+// SET
+void cblas_sset(const int n,
+                const float alpha,
+                float* x, const int x_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto x_size = n * x_inc;
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<float*>(x));
+  auto queue_cl = queue();
+  auto s = clblast::Set(n,
+                        alpha_cpp,
+                        x_buffer(), 0, x_inc,
+                        &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  x_buffer.Read(queue, x_size, reinterpret_cast<float*>(x));
+}
+void cblas_dset(const int n,
+                const double alpha,
+                double* x, const int x_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto x_size = n * x_inc;
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<double*>(x));
+  auto queue_cl = queue();
+  auto s = clblast::Set(n,
+                        alpha_cpp,
+                        x_buffer(), 0, x_inc,
+                        &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  x_buffer.Read(queue, x_size, reinterpret_cast<double*>(x));
+}
+void cblas_cset(const int n,
+                const void* alpha,
+                void* x, const int x_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto x_size = n * x_inc;
+  auto x_buffer = clblast::Buffer<float2>(context, x_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<float2*>(x));
+  auto queue_cl = queue();
+  auto s = clblast::Set(n,
+                        alpha_cpp,
+                        x_buffer(), 0, x_inc,
+                        &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  x_buffer.Read(queue, x_size, reinterpret_cast<float2*>(x));
+}
+void cblas_zset(const int n,
+                const void* alpha,
+                void* x, const int x_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto x_size = n * x_inc;
+  auto x_buffer = clblast::Buffer<double2>(context, x_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<double2*>(x));
+  auto queue_cl = queue();
+  auto s = clblast::Set(n,
+                        alpha_cpp,
+                        x_buffer(), 0, x_inc,
+                        &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  x_buffer.Read(queue, x_size, reinterpret_cast<double2*>(x));
+}
+
+// AXPY2
+void cblas_saxpy2(const int n,
+                  const float alpha,
+                  const float* x, const int x_inc,
+                  float* y, const int y_inc,
+                  const float beta,
+                  const float* z, const int z_inc,
+                  float* w, const int w_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto x_size = n * x_inc;
+  const auto z_size = n * z_inc;
+  const auto y_size = n * y_inc;
+  const auto w_size = n * w_inc;
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  auto z_buffer = clblast::Buffer<float>(context, z_size);
+  auto y_buffer = clblast::Buffer<float>(context, y_size);
+  auto w_buffer = clblast::Buffer<float>(context, w_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  z_buffer.Write(queue, z_size, reinterpret_cast<const float*>(z));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  w_buffer.Write(queue, w_size, reinterpret_cast<float*>(w));
+  auto queue_cl = queue();
+  auto s = clblast::Axpy2(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          y_buffer(), 0, y_inc,
+                          beta_cpp,
+                          z_buffer(), 0, z_inc,
+                          w_buffer(), 0, w_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+  w_buffer.Read(queue, w_size, reinterpret_cast<float*>(w));
+}
+void cblas_daxpy2(const int n,
+                  const double alpha,
+                  const double* x, const int x_inc,
+                  double* y, const int y_inc,
+                  const double beta,
+                  const double* z, const int z_inc,
+                  double* w, const int w_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto x_size = n * x_inc;
+  const auto z_size = n * z_inc;
+  const auto y_size = n * y_inc;
+  const auto w_size = n * w_inc;
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  auto z_buffer = clblast::Buffer<double>(context, z_size);
+  auto y_buffer = clblast::Buffer<double>(context, y_size);
+  auto w_buffer = clblast::Buffer<double>(context, w_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  z_buffer.Write(queue, z_size, reinterpret_cast<const double*>(z));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  w_buffer.Write(queue, w_size, reinterpret_cast<double*>(w));
+  auto queue_cl = queue();
+  auto s = clblast::Axpy2(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          y_buffer(), 0, y_inc,
+                          beta_cpp,
+                          z_buffer(), 0, z_inc,
+                          w_buffer(), 0, w_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+  w_buffer.Read(queue, w_size, reinterpret_cast<double*>(w));
+}
+void cblas_caxpy2(const int n,
+                  const void* alpha,
+                  const void* x, const int x_inc,
+                  void* y, const int y_inc,
+                  const void* beta,
+                  const void* z, const int z_inc,
+                  void* w, const int w_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  const auto x_size = n * x_inc;
+  const auto z_size = n * z_inc;
+  const auto y_size = n * y_inc;
+  const auto w_size = n * w_inc;
+  auto x_buffer = clblast::Buffer<float2>(context, x_size);
+  auto z_buffer = clblast::Buffer<float2>(context, z_size);
+  auto y_buffer = clblast::Buffer<float2>(context, y_size);
+  auto w_buffer = clblast::Buffer<float2>(context, w_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  z_buffer.Write(queue, z_size, reinterpret_cast<const float2*>(z));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  w_buffer.Write(queue, w_size, reinterpret_cast<float2*>(w));
+  auto queue_cl = queue();
+  auto s = clblast::Axpy2(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          y_buffer(), 0, y_inc,
+                          beta_cpp,
+                          z_buffer(), 0, z_inc,
+                          w_buffer(), 0, w_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<float2*>(y));
+  w_buffer.Read(queue, w_size, reinterpret_cast<float2*>(w));
+}
+void cblas_zaxpy2(const int n,
+                  const void* alpha,
+                  const void* x, const int x_inc,
+                  void* y, const int y_inc,
+                  const void* beta,
+                  const void* z, const int z_inc,
+                  void* w, const int w_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  const auto x_size = n * x_inc;
+  const auto z_size = n * z_inc;
+  const auto y_size = n * y_inc;
+  const auto w_size = n * w_inc;
+  auto x_buffer = clblast::Buffer<double2>(context, x_size);
+  auto z_buffer = clblast::Buffer<double2>(context, z_size);
+  auto y_buffer = clblast::Buffer<double2>(context, y_size);
+  auto w_buffer = clblast::Buffer<double2>(context, w_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  z_buffer.Write(queue, z_size, reinterpret_cast<const double2*>(z));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  w_buffer.Write(queue, w_size, reinterpret_cast<double2*>(w));
+  auto queue_cl = queue();
+  auto s = clblast::Axpy2(n,
+                          alpha_cpp,
+                          x_buffer(), 0, x_inc,
+                          y_buffer(), 0, y_inc,
+                          beta_cpp,
+                          z_buffer(), 0, z_inc,
+                          w_buffer(), 0, w_inc,
+                          &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  y_buffer.Read(queue, y_size, reinterpret_cast<double2*>(y));
+  w_buffer.Read(queue, w_size, reinterpret_cast<double2*>(w));
+}
+
+// AXPYDOT
+float cblas_saxpydot(const int n,
+                     const float alpha,
+                     const float* x, const int x_inc,
+                     float* y, const int y_inc,
+                     const float* z, const int z_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto x_size = n * x_inc;
+  const auto z_size = n * z_inc;
+  const auto y_size = n * y_inc;
+  const auto dot_size = 1;
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  auto z_buffer = clblast::Buffer<float>(context, z_size);
+  auto y_buffer = clblast::Buffer<float>(context, y_size);
+  auto dot_buffer = clblast::Buffer<float>(context, dot_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  z_buffer.Write(queue, z_size, reinterpret_cast<const float*>(z));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpydot(n,
+                            dot_buffer(), 0,
+                            alpha_cpp,
+                            x_buffer(), 0, x_inc,
+                            y_buffer(), 0, y_inc,
+                            z_buffer(), 0, z_inc,
+                            &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  float dot[dot_size];
+  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+  dot_buffer.Read(queue, dot_size, reinterpret_cast<float*>(dot));
+  return dot[0];
+}
+double cblas_daxpydot(const int n,
+                      const double alpha,
+                      const double* x, const int x_inc,
+                      double* y, const int y_inc,
+                      const double* z, const int z_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto x_size = n * x_inc;
+  const auto z_size = n * z_inc;
+  const auto y_size = n * y_inc;
+  const auto dot_size = 1;
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  auto z_buffer = clblast::Buffer<double>(context, z_size);
+  auto y_buffer = clblast::Buffer<double>(context, y_size);
+  auto dot_buffer = clblast::Buffer<double>(context, dot_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  z_buffer.Write(queue, z_size, reinterpret_cast<const double*>(z));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpydot(n,
+                            dot_buffer(), 0,
+                            alpha_cpp,
+                            x_buffer(), 0, x_inc,
+                            y_buffer(), 0, y_inc,
+                            z_buffer(), 0, z_inc,
+                            &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  double dot[dot_size];
+  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+  dot_buffer.Read(queue, dot_size, reinterpret_cast<double*>(dot));
+  return dot[0];
+}
+
+// AXPYNRM2
+float cblas_saxpynrm2(const int n,
+                      const float alpha,
+                      const float* x, const int x_inc,
+                      float* y, const int y_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto nrm2_size = 1;
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  auto y_buffer = clblast::Buffer<float>(context, y_size);
+  auto nrm2_buffer = clblast::Buffer<float>(context, nrm2_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpynrm2(n,
+                             nrm2_buffer(), 0,
+                             alpha_cpp,
+                             x_buffer(), 0, x_inc,
+                             y_buffer(), 0, y_inc,
+                             &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  float nrm2[nrm2_size];
+  y_buffer.Read(queue, y_size, reinterpret_cast<float*>(y));
+  nrm2_buffer.Read(queue, nrm2_size, reinterpret_cast<float*>(nrm2));
+  return nrm2[0];
+}
+double cblas_daxpynrm2(const int n,
+                       const double alpha,
+                       const double* x, const int x_inc,
+                       double* y, const int y_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto nrm2_size = 1;
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  auto y_buffer = clblast::Buffer<double>(context, y_size);
+  auto nrm2_buffer = clblast::Buffer<double>(context, nrm2_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpynrm2(n,
+                             nrm2_buffer(), 0,
+                             alpha_cpp,
+                             x_buffer(), 0, x_inc,
+                             y_buffer(), 0, y_inc,
+                             &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  double nrm2[nrm2_size];
+  y_buffer.Read(queue, y_size, reinterpret_cast<double*>(y));
+  nrm2_buffer.Read(queue, nrm2_size, reinterpret_cast<double*>(nrm2));
+  return nrm2[0];
+}
+float cblas_caxpynrm2(const int n,
+                      const void* alpha,
+                      const void* x, const int x_inc,
+                      void* y, const int y_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto nrm2_size = 1;
+  auto x_buffer = clblast::Buffer<float2>(context, x_size);
+  auto y_buffer = clblast::Buffer<float2>(context, y_size);
+  auto nrm2_buffer = clblast::Buffer<float2>(context, nrm2_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<float2*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpynrm2(n,
+                             nrm2_buffer(), 0,
+                             alpha_cpp,
+                             x_buffer(), 0, x_inc,
+                             y_buffer(), 0, y_inc,
+                             &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  float2 nrm2[nrm2_size];
+  y_buffer.Read(queue, y_size, reinterpret_cast<float2*>(y));
+  nrm2_buffer.Read(queue, nrm2_size, reinterpret_cast<float2*>(nrm2));
+  return nrm2[0].real();
+}
+double cblas_zaxpynrm2(const int n,
+                       const void* alpha,
+                       const void* x, const int x_inc,
+                       void* y, const int y_inc) {
+  OPTIONAL_STATIC auto device = get_device();
+  OPTIONAL_STATIC auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto x_size = n * x_inc;
+  const auto y_size = n * y_inc;
+  const auto nrm2_size = 1;
+  auto x_buffer = clblast::Buffer<double2>(context, x_size);
+  auto y_buffer = clblast::Buffer<double2>(context, y_size);
+  auto nrm2_buffer = clblast::Buffer<double2>(context, nrm2_size);
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  y_buffer.Write(queue, y_size, reinterpret_cast<double2*>(y));
+  auto queue_cl = queue();
+  auto s = clblast::Axpynrm2(n,
+                             nrm2_buffer(), 0,
+                             alpha_cpp,
+                             x_buffer(), 0, x_inc,
+                             y_buffer(), 0, y_inc,
+                             &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  double2 nrm2[nrm2_size];
+  y_buffer.Read(queue, y_size, reinterpret_cast<double2*>(y));
+  nrm2_buffer.Read(queue, nrm2_size, reinterpret_cast<double2*>(nrm2));
+  return nrm2[0].real();
+}
+
 // OMATCOPY
 void cblas_somatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
                      const int m, const int n,
@@ -597,6 +597,14 @@ class Queue {
     return Device(result);
   }
 
+  // Whether the commands in the queue may execute out-of-order
+  bool IsOutOfOrder() const {
+    cl_command_queue_properties result;
+    CheckError(clGetCommandQueueInfo(*queue_, CL_QUEUE_PROPERTIES, sizeof(result), &result,
+                                     nullptr));
+    return (result & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) != 0;
+  }
+
   // Accessor to the private data-member
   const RawCommandQueue& operator()() const { return *queue_; }
  private:
@@ -759,6 +767,17 @@ class Buffer {
     CheckError(clEnqueueCopyBuffer(queue(), *buffer_, destination(), 0, 0, size*sizeof(T), 0,
                                    nullptr, event));
   }
+  void CopyToAsync(const Queue &queue, const size_t size, const Buffer<T> &destination,
+                   EventPointer event, const std::vector<Event> &waitForEvents) const {
+    auto waitForEventsPlain = std::vector<cl_event>();
+    for (auto &waitEvent : waitForEvents) {
+      if (waitEvent()) { waitForEventsPlain.push_back(waitEvent()); }
+    }
+    CheckError(clEnqueueCopyBuffer(queue(), *buffer_, destination(), 0, 0, size*sizeof(T),
+                                   static_cast<cl_uint>(waitForEventsPlain.size()),
+                                   !waitForEventsPlain.empty() ? waitForEventsPlain.data() : nullptr,
+                                   event));
+  }
   void CopyTo(const Queue &queue, const size_t size, const Buffer<T> &destination) const {
     CopyToAsync(queue, size, destination);
     queue.Finish();
@@ -494,6 +494,9 @@ public:
   Context GetContext() const { return context_; }
   Device GetDevice() const { return device_; }
 
+  // Whether the commands in the queue may execute out-of-order: a CUDA stream is always in-order
+  bool IsOutOfOrder() const { return false; }
+
   // Accessor to the private data-member
   const RawCommandQueue& operator()() const { return *queue_; }
 private:
@@ -650,6 +653,13 @@ public:
   void CopyToAsync(const Queue &queue, const size_t size, const Buffer<T> &destination) const {
     CheckError(cuMemcpyDtoDAsync(destination(), *buffer_, size*sizeof(T), queue()));
   }
+  void CopyToAsync(const Queue &queue, const size_t size, const Buffer<T> &destination,
+                   EventPointer, const std::vector<Event> &waitForEvents) const {
+    for (auto &waitEvent : waitForEvents) {
+      waitEvent.WaitForCompletion(); // note: doesn't do anything, all calls are on the same stream
+    }
+    CopyToAsync(queue, size, destination);
+  }
   void CopyTo(const Queue &queue, const size_t size, const Buffer<T> &destination) const {
     CopyToAsync(queue, size, destination);
     queue.Finish();
@@ -37,6 +37,18 @@ const DatabaseEntry XgemvFastApple = {
 const DatabaseEntry XgemvFastRotApple = {
   "XgemvFastRot", Precision::kAny, {"VW3", "WGS3", "WPT3"}, { {  kDeviceTypeAll, "default", { { "default", { { kDeviceNameDefault, Params{ 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } } } } } } }
 };
+const DatabaseEntry XgemvBatchedApple = {
+  "XgemvBatched", Precision::kAny, {"WGS4", "WPT4", "UNROLL4"}, { {  kDeviceTypeAll, "default", { { "default", { { kDeviceNameDefault, Params{ 1, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } } } } } } }
+};
+const DatabaseEntry XgbmvApple = {
+  "Xgbmv", Precision::kAny, {"WGS5", "WPT5"}, { {  kDeviceTypeAll, "default", { { "default", { { kDeviceNameDefault, Params{ 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } } } } } } }
+};
+const DatabaseEntry XtrmvApple = {
+  "Xtrmv", Precision::kAny, {"WGS6", "WPT6"}, { {  kDeviceTypeAll, "default", { { "default", { { kDeviceNameDefault, Params{ 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } } } } } } }
+};
+const DatabaseEntry XsymvApple = {
+  "Xsymv", Precision::kAny, {"WGS7", "WPT7"}, { {  kDeviceTypeAll, "default", { { "default", { { kDeviceNameDefault, Params{ 1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } } } } } } }
+};
 const DatabaseEntry XgerApple = {
   "Xger", Precision::kAny, {"WGS1", "WGS2", "WPT"}, { {  kDeviceTypeAll, "default", { { "default", { { kDeviceNameDefault, Params{ 64, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } } } } } } }
 };
@@ -70,6 +82,15 @@ const DatabaseEntry InvertApple = {
 const DatabaseEntry TrsvRoutineApple = {
   "TrsvRoutine", Precision::kAny, {"TRSV_BLOCK_SIZE"}, { {  kDeviceTypeAll, "default", { { "default", { { kDeviceNameDefault, Params{ 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } } } } } } }
 };
+const DatabaseEntry TrsvSingleLaunchApple = {
+  "TrsvSingleLaunch", Precision::kAny, {"TRSV_SINGLE_LAUNCH"}, { {  kDeviceTypeAll, "default", { { "default", { { kDeviceNameDefault, Params{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } } } } } } }
+};
+const DatabaseEntry TrmvInPlaceApple = {
+  "TrmvInPlace", Precision::kAny, {"TRMV_IN_PLACE"}, { {  kDeviceTypeAll, "default", { { "default", { { kDeviceNameDefault, Params{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } } } } } } }
+};
+const DatabaseEntry ReductionSingleLaunchApple = {
+  "ReductionSingleLaunch", Precision::kAny, {"REDUCTION_SINGLE_LAUNCH"}, { {  kDeviceTypeAll, "default", { { "default", { { kDeviceNameDefault, Params{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } } } } } } }
+};
 
 // =================================================================================================
 } // namespace database
@@ -22,6 +22,10 @@
 #include "database/kernels/xgemv/xgemv.hpp"
 #include "database/kernels/xgemv_fast/xgemv_fast.hpp"
 #include "database/kernels/xgemv_fast_rot/xgemv_fast_rot.hpp"
+#include "database/kernels/xgemv_batched/xgemv_batched.hpp"
+#include "database/kernels/xgbmv/xgbmv.hpp"
+#include "database/kernels/xtrmv/xtrmv.hpp"
+#include "database/kernels/xsymv/xsymv.hpp"
 #include "database/kernels/xger/xger.hpp"
 #include "database/kernels/xgemm/xgemm.hpp"
 #include "database/kernels/xgemm_direct/xgemm_direct.hpp"
@@ -34,6 +38,14 @@
 
 #include "database/kernels/gemm_routine/gemm_routine.hpp"
 #include "database/kernels/trsv_routine/trsv_routine.hpp"
+#include "database/kernels/gemm_strassen/gemm_strassen.hpp"
+#include "database/kernels/gemm_3m/gemm_3m.hpp"
+#include "database/kernels/trsv_single_launch/trsv_single_launch.hpp"
+#include "database/kernels/trmv_in_place/trmv_in_place.hpp"
+#include "database/kernels/potrf/potrf.hpp"
+#include "database/kernels/getrf/getrf.hpp"
+#include "database/kernels/gesv_mixed/gesv_mixed.hpp"
+#include "database/kernels/reduction_single_launch/reduction_single_launch.hpp"
 
 #include "database/apple_cpu_fallback.hpp"
 
@@ -43,11 +55,11 @@ namespace clblast {
 std::vector<database::DatabaseEntry> Database::database = std::vector<database::DatabaseEntry>{};
 const std::vector<database::DatabaseEntry> Database::apple_cpu_fallback = std::vector<database::DatabaseEntry>{
   database::XaxpyApple, database::XdotApple,
-  database::XgemvApple, database::XgemvFastApple, database::XgemvFastRotApple, database::XgerApple, database::XtrsvApple,
+  database::XgemvApple, database::XgemvFastApple, database::XgemvFastRotApple, database::XgemvBatchedApple, database::XgbmvApple, database::XtrmvApple, database::XsymvApple, database::XgerApple, database::XtrsvApple,
   database::XgemmApple, database::XgemmDirectApple, database::XconvgemmApple,
   database::CopyApple, database::PadApple, database::TransposeApple, database::PadtransposeApple,
   database::InvertApple,
-  database::TrsvRoutineApple
+  database::TrsvRoutineApple, database::TrsvSingleLaunchApple, database::TrmvInPlaceApple, database::ReductionSingleLaunchApple
 };
 
 // The default values
@@ -69,6 +81,10 @@ Database::Database(const Device &device, const std::string &kernel_name,
         database::XgemvHalf, database::XgemvSingle, database::XgemvDouble, database::XgemvComplexSingle, database::XgemvComplexDouble,
         database::XgemvFastHalf, database::XgemvFastSingle, database::XgemvFastDouble, database::XgemvFastComplexSingle, database::XgemvFastComplexDouble,
         database::XgemvFastRotHalf, database::XgemvFastRotSingle, database::XgemvFastRotDouble, database::XgemvFastRotComplexSingle, database::XgemvFastRotComplexDouble,
+        database::XgemvBatchedHalf, database::XgemvBatchedSingle, database::XgemvBatchedDouble, database::XgemvBatchedComplexSingle, database::XgemvBatchedComplexDouble,
+        database::XgbmvHalf, database::XgbmvSingle, database::XgbmvDouble, database::XgbmvComplexSingle, database::XgbmvComplexDouble,
+        database::XtrmvHalf, database::XtrmvSingle, database::XtrmvDouble, database::XtrmvComplexSingle, database::XtrmvComplexDouble,
+        database::XsymvHalf, database::XsymvSingle, database::XsymvDouble, database::XsymvComplexSingle, database::XsymvComplexDouble,
         database::XgerHalf, database::XgerSingle, database::XgerDouble, database::XgerComplexSingle, database::XgerComplexDouble,
         database::XgemmHalf, database::XgemmSingle, database::XgemmDouble, database::XgemmComplexSingle, database::XgemmComplexDouble,
         database::XgemmDirectHalf, database::XgemmDirectSingle, database::XgemmDirectDouble, database::XgemmDirectComplexSingle, database::XgemmDirectComplexDouble,
@@ -79,7 +95,15 @@ Database::Database(const Device &device, const std::string &kernel_name,
         database::PadtransposeHalf, database::PadtransposeSingle, database::PadtransposeDouble, database::PadtransposeComplexSingle, database::PadtransposeComplexDouble,
         database::InvertHalf, database::InvertSingle, database::InvertDouble, database::InvertComplexSingle, database::InvertComplexDouble,
         database::GemmRoutineHalf, database::GemmRoutineSingle, database::GemmRoutineDouble, database::GemmRoutineComplexSingle, database::GemmRoutineComplexDouble,
-        database::TrsvRoutineHalf, database::TrsvRoutineSingle, database::TrsvRoutineDouble, database::TrsvRoutineComplexSingle, database::TrsvRoutineComplexDouble
+        database::TrsvRoutineHalf, database::TrsvRoutineSingle, database::TrsvRoutineDouble, database::TrsvRoutineComplexSingle, database::TrsvRoutineComplexDouble,
+        database::GemmStrassenHalf, database::GemmStrassenSingle, database::GemmStrassenDouble, database::GemmStrassenComplexSingle, database::GemmStrassenComplexDouble,
+        database::Gemm3mHalf, database::Gemm3mSingle, database::Gemm3mDouble, database::Gemm3mComplexSingle, database::Gemm3mComplexDouble,
+        database::TrsvSingleLaunchHalf, database::TrsvSingleLaunchSingle, database::TrsvSingleLaunchDouble, database::TrsvSingleLaunchComplexSingle, database::TrsvSingleLaunchComplexDouble,
+        database::TrmvInPlaceHalf, database::TrmvInPlaceSingle, database::TrmvInPlaceDouble, database::TrmvInPlaceComplexSingle, database::TrmvInPlaceComplexDouble,
+        database::PotrfHalf, database::PotrfSingle, database::PotrfDouble, database::PotrfComplexSingle, database::PotrfComplexDouble,
+        database::GetrfHalf, database::GetrfSingle, database::GetrfDouble, database::GetrfComplexSingle, database::GetrfComplexDouble,
+        database::GesvMixedHalf, database::GesvMixedSingle, database::GesvMixedDouble, database::GesvMixedComplexSingle, database::GesvMixedComplexDouble,
+        database::ReductionSingleLaunchHalf, database::ReductionSingleLaunchSingle, database::ReductionSingleLaunchDouble, database::ReductionSingleLaunchComplexSingle, database::ReductionSingleLaunchComplexDouble
     };
   }
 
@@ -0,0 +1,15 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Gemm_3m' kernels.
+//
+// =================================================================================================
+
+#include "database/kernels/gemm_3m/gemm_3m.hpp"
+#include "database/kernels/gemm_3m/gemm_3m_16.hpp"
+#include "database/kernels/gemm_3m/gemm_3m_32.hpp"
+#include "database/kernels/gemm_3m/gemm_3m_3232.hpp"
+#include "database/kernels/gemm_3m/gemm_3m_64.hpp"
+#include "database/kernels/gemm_3m/gemm_3m_6464.hpp"
@@ -0,0 +1,22 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Gemm_3m' kernels.
+//
+// =================================================================================================
+
+#include "database/database_structure.hpp"
+
+namespace clblast {
+namespace database {
+
+extern const DatabaseEntry Gemm3mHalf;
+extern const DatabaseEntry Gemm3mSingle;
+extern const DatabaseEntry Gemm3mComplexSingle;
+extern const DatabaseEntry Gemm3mDouble;
+extern const DatabaseEntry Gemm3mComplexDouble;
+
+} // namespace database
+} // namespace clblast
@@ -0,0 +1,15 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Gemm_Strassen' kernels.
+//
+// =================================================================================================
+
+#include "database/kernels/gemm_strassen/gemm_strassen.hpp"
+#include "database/kernels/gemm_strassen/gemm_strassen_16.hpp"
+#include "database/kernels/gemm_strassen/gemm_strassen_32.hpp"
+#include "database/kernels/gemm_strassen/gemm_strassen_3232.hpp"
+#include "database/kernels/gemm_strassen/gemm_strassen_64.hpp"
+#include "database/kernels/gemm_strassen/gemm_strassen_6464.hpp"
@@ -0,0 +1,15 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Gesv_Mixed' kernels.
+//
+// =================================================================================================
+
+#include "database/kernels/gesv_mixed/gesv_mixed.hpp"
+#include "database/kernels/gesv_mixed/gesv_mixed_16.hpp"
+#include "database/kernels/gesv_mixed/gesv_mixed_32.hpp"
+#include "database/kernels/gesv_mixed/gesv_mixed_3232.hpp"
+#include "database/kernels/gesv_mixed/gesv_mixed_64.hpp"
+#include "database/kernels/gesv_mixed/gesv_mixed_6464.hpp"
@@ -0,0 +1,15 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Getrf' kernels.
+//
+// =================================================================================================
+
+#include "database/kernels/getrf/getrf.hpp"
+#include "database/kernels/getrf/getrf_16.hpp"
+#include "database/kernels/getrf/getrf_32.hpp"
+#include "database/kernels/getrf/getrf_3232.hpp"
+#include "database/kernels/getrf/getrf_64.hpp"
+#include "database/kernels/getrf/getrf_6464.hpp"
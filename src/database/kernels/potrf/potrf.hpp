@@ -0,0 +1,22 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Potrf' kernels.
+//
+// =================================================================================================
+
+#include "database/database_structure.hpp"
+
+namespace clblast {
+namespace database {
+
+extern const DatabaseEntry PotrfHalf;
+extern const DatabaseEntry PotrfSingle;
+extern const DatabaseEntry PotrfComplexSingle;
+extern const DatabaseEntry PotrfDouble;
+extern const DatabaseEntry PotrfComplexDouble;
+
+} // namespace database
+} // namespace clblast
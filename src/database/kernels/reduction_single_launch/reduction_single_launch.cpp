@@ -0,0 +1,15 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Reduction_Single_Launch' kernels.
+//
+// =================================================================================================
+
+#include "database/kernels/reduction_single_launch/reduction_single_launch.hpp"
+#include "database/kernels/reduction_single_launch/reduction_single_launch_16.hpp"
+#include "database/kernels/reduction_single_launch/reduction_single_launch_32.hpp"
+#include "database/kernels/reduction_single_launch/reduction_single_launch_3232.hpp"
+#include "database/kernels/reduction_single_launch/reduction_single_launch_64.hpp"
+#include "database/kernels/reduction_single_launch/reduction_single_launch_6464.hpp"
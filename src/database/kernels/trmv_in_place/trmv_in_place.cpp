@@ -0,0 +1,15 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Trmv_In_Place' kernels.
+//
+// =================================================================================================
+
+#include "database/kernels/trmv_in_place/trmv_in_place.hpp"
+#include "database/kernels/trmv_in_place/trmv_in_place_16.hpp"
+#include "database/kernels/trmv_in_place/trmv_in_place_32.hpp"
+#include "database/kernels/trmv_in_place/trmv_in_place_3232.hpp"
+#include "database/kernels/trmv_in_place/trmv_in_place_64.hpp"
+#include "database/kernels/trmv_in_place/trmv_in_place_6464.hpp"
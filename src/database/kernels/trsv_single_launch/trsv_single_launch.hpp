@@ -0,0 +1,22 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Trsv_Single_Launch' kernels.
+//
+// =================================================================================================
+
+#include "database/database_structure.hpp"
+
+namespace clblast {
+namespace database {
+
+extern const DatabaseEntry TrsvSingleLaunchHalf;
+extern const DatabaseEntry TrsvSingleLaunchSingle;
+extern const DatabaseEntry TrsvSingleLaunchComplexSingle;
+extern const DatabaseEntry TrsvSingleLaunchDouble;
+extern const DatabaseEntry TrsvSingleLaunchComplexDouble;
+
+} // namespace database
+} // namespace clblast
@@ -0,0 +1,22 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Xgbmv' kernels.
+//
+// =================================================================================================
+
+#include "database/database_structure.hpp"
+
+namespace clblast {
+namespace database {
+
+extern const DatabaseEntry XgbmvHalf;
+extern const DatabaseEntry XgbmvSingle;
+extern const DatabaseEntry XgbmvComplexSingle;
+extern const DatabaseEntry XgbmvDouble;
+extern const DatabaseEntry XgbmvComplexDouble;
+
+} // namespace database
+} // namespace clblast
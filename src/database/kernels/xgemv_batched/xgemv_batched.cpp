@@ -0,0 +1,15 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'XgemvBatched' kernels.
+//
+// =================================================================================================
+
+#include "database/kernels/xgemv_batched/xgemv_batched.hpp"
+#include "database/kernels/xgemv_batched/xgemv_batched_16.hpp"
+#include "database/kernels/xgemv_batched/xgemv_batched_32.hpp"
+#include "database/kernels/xgemv_batched/xgemv_batched_3232.hpp"
+#include "database/kernels/xgemv_batched/xgemv_batched_64.hpp"
+#include "database/kernels/xgemv_batched/xgemv_batched_6464.hpp"
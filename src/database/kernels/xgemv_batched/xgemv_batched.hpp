@@ -0,0 +1,22 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'XgemvBatched' kernels.
+//
+// =================================================================================================
+
+#include "database/database_structure.hpp"
+
+namespace clblast {
+namespace database {
+
+extern const DatabaseEntry XgemvBatchedHalf;
+extern const DatabaseEntry XgemvBatchedSingle;
+extern const DatabaseEntry XgemvBatchedComplexSingle;
+extern const DatabaseEntry XgemvBatchedDouble;
+extern const DatabaseEntry XgemvBatchedComplexDouble;
+
+} // namespace database
+} // namespace clblast
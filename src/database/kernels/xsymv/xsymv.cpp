@@ -0,0 +1,15 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Xsymv' kernels.
+//
+// =================================================================================================
+
+#include "database/kernels/xsymv/xsymv.hpp"
+#include "database/kernels/xsymv/xsymv_16.hpp"
+#include "database/kernels/xsymv/xsymv_32.hpp"
+#include "database/kernels/xsymv/xsymv_3232.hpp"
+#include "database/kernels/xsymv/xsymv_64.hpp"
+#include "database/kernels/xsymv/xsymv_6464.hpp"
@@ -0,0 +1,15 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. It
+// is auto-generated by the 'scripts/database/database.py' Python script.
+//
+// This file populates the database with best-found tuning parameters for the 'Xtrmv' kernels.
+//
+// =================================================================================================
+
+#include "database/kernels/xtrmv/xtrmv.hpp"
+#include "database/kernels/xtrmv/xtrmv_16.hpp"
+#include "database/kernels/xtrmv/xtrmv_32.hpp"
+#include "database/kernels/xtrmv/xtrmv_3232.hpp"
+#include "database/kernels/xtrmv/xtrmv_64.hpp"
+#include "database/kernels/xtrmv/xtrmv_6464.hpp"
@@ -80,6 +80,12 @@ typedef struct { double s0; double s1; double s2; double s3;
 
 // Replaces OpenCL synchronisation with CUDA synchronisation
 #define barrier(x) __syncthreads()
+#define mem_fence(x) __threadfence()
+
+// Replaces OpenCL atomic functions with their CUDA equivalents
+#define atomic_inc(p) atomicAdd(p, 1)
+#define atomic_add(p, v) atomicAdd(p, v)
+#define atomic_xchg(p, v) atomicExch(p, v)
 
 // =================================================================================================
 
@@ -325,6 +325,158 @@ def float32_to_float16(float32):
         f16 = sign
     return f16
 
+####################################################################################################
+# Generate givens plane rotation: SROTG/DROTG
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastSrotg(cl_mem sa_buffer, const size_t sa_offset, cl_mem sb_buffer, const size_t sb_offset, cl_mem sc_buffer, const size_t sc_offset, cl_mem ss_buffer, const size_t ss_offset,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDrotg(cl_mem sa_buffer, const size_t sa_offset, cl_mem sb_buffer, const size_t sb_offset, cl_mem sc_buffer, const size_t sc_offset, cl_mem ss_buffer, const size_t ss_offset,cl_command_queue* queue, cl_event* event)
+
+def rotg(queue, sa, sb, sc, ss, sa_offset = 0, sb_offset = 0, sc_offset = 0, ss_offset = 0):
+    """
+    xROTG: Generate givens plane rotation
+    """
+
+    dtype = check_dtype([sa, sb, sc, ss], ["float32", "float64"])
+    check_matrix(sa, "sa")
+    check_matrix(sb, "sb")
+    check_matrix(sc, "sc")
+    check_matrix(ss, "ss")
+
+    cdef cl_mem sa_buffer = <cl_mem><size_t>sa.base_data.int_ptr
+    cdef cl_mem sb_buffer = <cl_mem><size_t>sb.base_data.int_ptr
+    cdef cl_mem sc_buffer = <cl_mem><size_t>sc.base_data.int_ptr
+    cdef cl_mem ss_buffer = <cl_mem><size_t>ss.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastSrotg(sa_buffer, sa_offset, sb_buffer, sb_offset, sc_buffer, sc_offset, ss_buffer, ss_offset, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDrotg(sa_buffer, sa_offset, sb_buffer, sb_offset, sc_buffer, sc_offset, ss_buffer, ss_offset, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXrotg' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Generate modified givens plane rotation: SROTMG/DROTMG
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastSrotmg(cl_mem sd1_buffer, const size_t sd1_offset, cl_mem sd2_buffer, const size_t sd2_offset, cl_mem sx1_buffer, const size_t sx1_offset, const cl_mem sy1_buffer, const size_t sy1_offset, cl_mem sparam_buffer, const size_t sparam_offset,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDrotmg(cl_mem sd1_buffer, const size_t sd1_offset, cl_mem sd2_buffer, const size_t sd2_offset, cl_mem sx1_buffer, const size_t sx1_offset, const cl_mem sy1_buffer, const size_t sy1_offset, cl_mem sparam_buffer, const size_t sparam_offset,cl_command_queue* queue, cl_event* event)
+
+def rotmg(queue, sy1, sd1, sd2, sx1, sparam, sy1_offset = 0, sd1_offset = 0, sd2_offset = 0, sx1_offset = 0, sparam_offset = 0):
+    """
+    xROTMG: Generate modified givens plane rotation
+    """
+
+    dtype = check_dtype([sy1, sd1, sd2, sx1, sparam], ["float32", "float64"])
+    check_matrix(sy1, "sy1")
+    check_matrix(sd1, "sd1")
+    check_matrix(sd2, "sd2")
+    check_matrix(sx1, "sx1")
+    check_matrix(sparam, "sparam")
+
+    cdef cl_mem sy1_buffer = <cl_mem><size_t>sy1.base_data.int_ptr
+    cdef cl_mem sd1_buffer = <cl_mem><size_t>sd1.base_data.int_ptr
+    cdef cl_mem sd2_buffer = <cl_mem><size_t>sd2.base_data.int_ptr
+    cdef cl_mem sx1_buffer = <cl_mem><size_t>sx1.base_data.int_ptr
+    cdef cl_mem sparam_buffer = <cl_mem><size_t>sparam.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastSrotmg(sd1_buffer, sd1_offset, sd2_buffer, sd2_offset, sx1_buffer, sx1_offset, sy1_buffer, sy1_offset, sparam_buffer, sparam_offset, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDrotmg(sd1_buffer, sd1_offset, sd2_buffer, sd2_offset, sx1_buffer, sx1_offset, sy1_buffer, sy1_offset, sparam_buffer, sparam_offset, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXrotmg' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Apply givens plane rotation: SROT/DROT
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastSrot(const size_t n, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const float cos, const float sin,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDrot(const size_t n, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const double cos, const double sin,cl_command_queue* queue, cl_event* event)
+
+def rot(queue, n, x, y, x_inc = 1, y_inc = 1, cos = 0.0, sin = 0.0, x_offset = 0, y_offset = 0):
+    """
+    xROT: Apply givens plane rotation
+    """
+
+    dtype = check_dtype([x, y], ["float32", "float64"])
+    check_vector(x, "x")
+    check_vector(y, "y")
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastSrot(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, cos, sin, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDrot(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, cos, sin, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXrot' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Apply modified givens plane rotation: SROTM/DROTM
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastSrotm(const size_t n, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem sparam_buffer, const size_t sparam_offset,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDrotm(const size_t n, cl_mem x_buffer, const size_t x_offset, const size_t x_inc, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, cl_mem sparam_buffer, const size_t sparam_offset,cl_command_queue* queue, cl_event* event)
+
+def rotm(queue, n, x, y, sparam, x_inc = 1, y_inc = 1, x_offset = 0, y_offset = 0, sparam_offset = 0):
+    """
+    xROTM: Apply modified givens plane rotation
+    """
+
+    dtype = check_dtype([x, y, sparam], ["float32", "float64"])
+    check_vector(x, "x")
+    check_vector(y, "y")
+    check_matrix(sparam, "sparam")
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef cl_mem sparam_buffer = <cl_mem><size_t>sparam.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastSrotm(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, sparam_buffer, sparam_offset, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDrotm(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, sparam_buffer, sparam_offset, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXrotm' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
 ####################################################################################################
 # Swap two vectors: SSWAP/DSWAP/CSWAP/ZSWAP/HSWAP
 ####################################################################################################
@@ -1437,6 +1589,94 @@ def trsv(queue, n, a, x, a_ld, x_inc = 1, lower_triangle = False, a_transp = Fal
         raise RuntimeError("PyCLBlast: 'CLBlastXtrsv' failed: %s" % get_status_message(err))
     return cl.Event.from_int_ptr(<size_t>event)
 
+####################################################################################################
+# Solves a banded triangular system of equations: STBSV/DTBSV/CTBSV/ZTBSV
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastStbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const size_t k, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDtbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const size_t k, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCtbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const size_t k, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZtbsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const size_t k, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+
+def tbsv(queue, n, k, a, x, a_ld, x_inc = 1, lower_triangle = False, a_transp = False, unit_diagonal = False, a_offset = 0, x_offset = 0):
+    """
+    xTBSV: Solves a banded triangular system of equations
+    """
+
+    dtype = check_dtype([a, x], ["float32", "float64", "complex64", "complex128"])
+    check_matrix(a, "a")
+    check_vector(x, "x")
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastStbsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDtbsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        err = CLBlastCtbsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        err = CLBlastZtbsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXtbsv' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Solves a packed triangular system of equations: STPSV/DTPSV/CTPSV/ZTPSV
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastStpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem ap_buffer, const size_t ap_offset, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDtpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem ap_buffer, const size_t ap_offset, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCtpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem ap_buffer, const size_t ap_offset, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZtpsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem ap_buffer, const size_t ap_offset, cl_mem x_buffer, const size_t x_offset, const size_t x_inc,cl_command_queue* queue, cl_event* event)
+
+def tpsv(queue, n, ap, x, ap_ld, x_inc = 1, lower_triangle = False, a_transp = False, unit_diagonal = False, ap_offset = 0, x_offset = 0):
+    """
+    xTPSV: Solves a packed triangular system of equations
+    """
+
+    dtype = check_dtype([ap, x], ["float32", "float64", "complex64", "complex128"])
+    check_matrix(ap, "ap")
+    check_vector(x, "x")
+
+    cdef cl_mem ap_buffer = <cl_mem><size_t>ap.base_data.int_ptr
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    triangle = CLBlastTriangleLower if lower_triangle else CLBlastTriangleUpper
+    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    diagonal = CLBlastDiagonalUnit if unit_diagonal else CLBlastDiagonalNonUnit
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastStpsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDtpsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        err = CLBlastCtpsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        err = CLBlastZtpsv(CLBlastLayoutRowMajor, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXtpsv' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
 ####################################################################################################
 # General rank-1 matrix update: SGER/DGER/HGER
 ####################################################################################################
@@ -2329,39 +2569,35 @@ def axpyBatched(queue, n, x, y, alphas, x_offsets, y_offsets, x_inc = 1, y_inc =
     return cl.Event.from_int_ptr(<size_t>event)
 
 ####################################################################################################
-# Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
+# Batched version of AXPBY: SAXPBYBATCHED/DAXPBYBATCHED/CAXPBYBATCHED/ZAXPBYBATCHED/HAXPBYBATCHED
 ####################################################################################################
 
 cdef extern from "clblast_c.h":
-    CLBlastStatusCode CLBlastSgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const float *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const float *betas, cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
-    CLBlastStatusCode CLBlastDgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const double *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const double *betas, cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
-    CLBlastStatusCode CLBlastCgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_float2 *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const cl_float2 *betas, cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
-    CLBlastStatusCode CLBlastZgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_double2 *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const cl_double2 *betas, cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
-    CLBlastStatusCode CLBlastHgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_half *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const cl_half *betas, cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastSaxpbyBatched(const size_t n, const float *alphas, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const float *betas, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDaxpbyBatched(const size_t n, const double *alphas, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const double *betas, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCaxpbyBatched(const size_t n, const cl_float2 *alphas, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const cl_float2 *betas, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZaxpbyBatched(const size_t n, const cl_double2 *alphas, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const cl_double2 *betas, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastHaxpbyBatched(const size_t n, const cl_half *alphas, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const cl_half *betas, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
 
-def gemmBatched(queue, m, n, k, a, b, c, alphas, betas, a_ld, b_ld, c_ld, a_offsets, b_offsets, c_offsets, a_transp = False, b_transp = False):
+def axpbyBatched(queue, n, x, y, alphas, betas, x_offsets, y_offsets, x_inc = 1, y_inc = 1):
     """
-    xGEMMBATCHED: Batched version of GEMM
+    xAXPBYBATCHED: Batched version of AXPBY
     """
 
-    dtype = check_dtype([a, b, c], ["float32", "float64", "complex64", "complex128", "float16"])
-    check_matrix(a, "a")
-    check_matrix(b, "b")
-    check_matrix(c, "c")
+    dtype = check_dtype([x, y], ["float32", "float64", "complex64", "complex128", "float16"])
+    check_vector(x, "x")
+    check_vector(y, "y")
 
-    if len(a_offsets) != len(b_offsets) != len(c_offsets) != len(alphas) != len(betas):
-        raise RuntimeError("PyCLBlast: 'CLBlastXgemmBatched' failed: length of batch-sized arguments a_offsets, b_offsets, c_offsets, alphas, betas should be equal")
-    batch_count = len(a_offsets)
+    if len(x_offsets) != len(y_offsets) != len(alphas) != len(betas):
+        raise RuntimeError("PyCLBlast: 'CLBlastXaxpbyBatched' failed: length of batch-sized arguments x_offsets, y_offsets, alphas, betas should be equal")
+    batch_count = len(x_offsets)
 
-    cdef size_t *a_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
-    for i in range(batch_count):
-        a_offsets_c[i] = a_offsets[i]
-    cdef size_t *b_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+    cdef size_t *x_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
     for i in range(batch_count):
-        b_offsets_c[i] = b_offsets[i]
-    cdef size_t *c_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+        x_offsets_c[i] = x_offsets[i]
+    cdef size_t *y_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
     for i in range(batch_count):
-        c_offsets_c[i] = c_offsets[i]
+        y_offsets_c[i] = y_offsets[i]
     cdef void *alphas_c = <void *> PyMem_Malloc(batch_count * sizeof(dtype_size[dtype]))
     for i in range(batch_count):
         if dtype == np.dtype("float32"):
@@ -2387,85 +2623,678 @@ def gemmBatched(queue, m, n, k, a, b, c, alphas, betas, a_ld, b_ld, c_ld, a_offs
         elif dtype == np.dtype("float16"):
             (<cl_half*>betas_c)[i] = <cl_half>betas[i]
 
-    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
-    cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
-    cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
-    b_transpose = CLBlastTransposeYes if b_transp else CLBlastTransposeNo
 
     cdef CLBlastStatusCode err
     if dtype == np.dtype("float32"):
-        err = CLBlastSgemmBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_float*>alphas_c, a_buffer, a_offsets_c, a_ld, b_buffer, b_offsets_c, b_ld, <cl_float*>betas_c, c_buffer, c_offsets_c, c_ld, batch_count, &command_queue, &event)
+        err = CLBlastSaxpbyBatched(n, <cl_float*>alphas_c, x_buffer, x_offsets_c, x_inc, <cl_float*>betas_c, y_buffer, y_offsets_c, y_inc, batch_count, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDgemmBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_double*>alphas_c, a_buffer, a_offsets_c, a_ld, b_buffer, b_offsets_c, b_ld, <cl_double*>betas_c, c_buffer, c_offsets_c, c_ld, batch_count, &command_queue, &event)
+        err = CLBlastDaxpbyBatched(n, <cl_double*>alphas_c, x_buffer, x_offsets_c, x_inc, <cl_double*>betas_c, y_buffer, y_offsets_c, y_inc, batch_count, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCgemmBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_float2*>alphas_c, a_buffer, a_offsets_c, a_ld, b_buffer, b_offsets_c, b_ld, <cl_float2*>betas_c, c_buffer, c_offsets_c, c_ld, batch_count, &command_queue, &event)
+        err = CLBlastCaxpbyBatched(n, <cl_float2*>alphas_c, x_buffer, x_offsets_c, x_inc, <cl_float2*>betas_c, y_buffer, y_offsets_c, y_inc, batch_count, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZgemmBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_double2*>alphas_c, a_buffer, a_offsets_c, a_ld, b_buffer, b_offsets_c, b_ld, <cl_double2*>betas_c, c_buffer, c_offsets_c, c_ld, batch_count, &command_queue, &event)
+        err = CLBlastZaxpbyBatched(n, <cl_double2*>alphas_c, x_buffer, x_offsets_c, x_inc, <cl_double2*>betas_c, y_buffer, y_offsets_c, y_inc, batch_count, &command_queue, &event)
     elif dtype == np.dtype("float16"):
-        err = CLBlastHgemmBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_half*>alphas_c, a_buffer, a_offsets_c, a_ld, b_buffer, b_offsets_c, b_ld, <cl_half*>betas_c, c_buffer, c_offsets_c, c_ld, batch_count, &command_queue, &event)
+        err = CLBlastHaxpbyBatched(n, <cl_half*>alphas_c, x_buffer, x_offsets_c, x_inc, <cl_half*>betas_c, y_buffer, y_offsets_c, y_inc, batch_count, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
 
-    PyMem_Free(a_offsets_c)
-    PyMem_Free(b_offsets_c)
-    PyMem_Free(c_offsets_c)
+    PyMem_Free(x_offsets_c)
+    PyMem_Free(y_offsets_c)
     PyMem_Free(alphas_c)
     PyMem_Free(betas_c)
 
     if err != CLBlastSuccess:
-        raise RuntimeError("PyCLBlast: 'CLBlastXgemmBatched' failed: %s" % get_status_message(err))
+        raise RuntimeError("PyCLBlast: 'CLBlastXaxpbyBatched' failed: %s" % get_status_message(err))
     return cl.Event.from_int_ptr(<size_t>event)
 
 ####################################################################################################
-# StridedBatched version of GEMM: SGEMMSTRIDEDBATCHED/DGEMMSTRIDEDBATCHED/CGEMMSTRIDEDBATCHED/ZGEMMSTRIDEDBATCHED/HGEMMSTRIDEDBATCHED
+# Batched version of SET: SSETBATCHED/DSETBATCHED/CSETBATCHED/ZSETBATCHED/HSETBATCHED
 ####################################################################################################
 
 cdef extern from "clblast_c.h":
-    CLBlastStatusCode CLBlastSgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const float beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
-    CLBlastStatusCode CLBlastDgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const double beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
-    CLBlastStatusCode CLBlastCgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const cl_float2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
-    CLBlastStatusCode CLBlastZgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const cl_double2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
-    CLBlastStatusCode CLBlastHgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_half alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const cl_half beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastSsetBatched(const size_t n, const float *alphas, cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDsetBatched(const size_t n, const double *alphas, cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCsetBatched(const size_t n, const cl_float2 *alphas, cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZsetBatched(const size_t n, const cl_double2 *alphas, cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastHsetBatched(const size_t n, const cl_half *alphas, cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
 
-def gemmStridedBatched(queue, m, n, k, batch_count, a, b, c, a_ld, b_ld, c_ld, a_stride, b_stride, c_stride, alpha = 1.0, beta = 0.0, a_transp = False, b_transp = False, a_offset = 0, b_offset = 0, c_offset = 0):
+def setBatched(queue, n, x, alphas, x_offsets, x_inc = 1):
     """
-    xGEMMSTRIDEDBATCHED: StridedBatched version of GEMM
+    xSETBATCHED: Batched version of SET
     """
 
-    dtype = check_dtype([a, b, c], ["float32", "float64", "complex64", "complex128", "float16"])
-    check_matrix(a, "a")
-    check_matrix(b, "b")
-    check_matrix(c, "c")
+    dtype = check_dtype([x], ["float32", "float64", "complex64", "complex128", "float16"])
+    check_vector(x, "x")
 
-    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
-    cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
-    cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+    if len(x_offsets) != len(alphas):
+        raise RuntimeError("PyCLBlast: 'CLBlastXsetBatched' failed: length of batch-sized arguments x_offsets, alphas should be equal")
+    batch_count = len(x_offsets)
+
+    cdef size_t *x_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+    for i in range(batch_count):
+        x_offsets_c[i] = x_offsets[i]
+    cdef void *alphas_c = <void *> PyMem_Malloc(batch_count * sizeof(dtype_size[dtype]))
+    for i in range(batch_count):
+        if dtype == np.dtype("float32"):
+            (<cl_float*>alphas_c)[i] = <cl_float>alphas[i]
+        elif dtype == np.dtype("float64"):
+            (<cl_double*>alphas_c)[i] = <cl_double>alphas[i]
+        elif dtype == np.dtype("complex64"):
+            (<cl_float2*>alphas_c)[i] = <cl_float2>cl_float2(x=alphas[i].real,y=alphas[i].imag)
+        elif dtype == np.dtype("complex128"):
+            (<cl_double2*>alphas_c)[i] = <cl_double2>cl_double2(x=alphas[i].real,y=alphas[i].imag)
+        elif dtype == np.dtype("float16"):
+            (<cl_half*>alphas_c)[i] = <cl_half>alphas[i]
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
 
     cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
     cdef cl_event event = NULL
-    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
-    b_transpose = CLBlastTransposeYes if b_transp else CLBlastTransposeNo
 
     cdef CLBlastStatusCode err
     if dtype == np.dtype("float32"):
-        err = CLBlastSgemmStridedBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_float>alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, <cl_float>beta, c_buffer, c_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+        err = CLBlastSsetBatched(n, <cl_float*>alphas_c, x_buffer, x_offsets_c, x_inc, batch_count, &command_queue, &event)
     elif dtype == np.dtype("float64"):
-        err = CLBlastDgemmStridedBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_double>alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, <cl_double>beta, c_buffer, c_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+        err = CLBlastDsetBatched(n, <cl_double*>alphas_c, x_buffer, x_offsets_c, x_inc, batch_count, &command_queue, &event)
     elif dtype == np.dtype("complex64"):
-        err = CLBlastCgemmStridedBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, <cl_float2>cl_float2(x=beta.real,y=beta.imag), c_buffer, c_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+        err = CLBlastCsetBatched(n, <cl_float2*>alphas_c, x_buffer, x_offsets_c, x_inc, batch_count, &command_queue, &event)
     elif dtype == np.dtype("complex128"):
-        err = CLBlastZgemmStridedBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, <cl_double2>cl_double2(x=beta.real,y=beta.imag), c_buffer, c_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+        err = CLBlastZsetBatched(n, <cl_double2*>alphas_c, x_buffer, x_offsets_c, x_inc, batch_count, &command_queue, &event)
     elif dtype == np.dtype("float16"):
-        err = CLBlastHgemmStridedBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_half>alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, <cl_half>beta, c_buffer, c_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+        err = CLBlastHsetBatched(n, <cl_half*>alphas_c, x_buffer, x_offsets_c, x_inc, batch_count, &command_queue, &event)
     else:
         raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
 
+    PyMem_Free(x_offsets_c)
+    PyMem_Free(alphas_c)
+
     if err != CLBlastSuccess:
-        raise RuntimeError("PyCLBlast: 'CLBlastXgemmStridedBatched' failed: %s" % get_status_message(err))
+        raise RuntimeError("PyCLBlast: 'CLBlastXsetBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastSgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const float *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const float *betas, cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const double *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const double *betas, cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_float2 *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const cl_float2 *betas, cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_double2 *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const cl_double2 *betas, cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastHgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_half *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld, const cl_half *betas, cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def gemmBatched(queue, m, n, k, a, b, c, alphas, betas, a_ld, b_ld, c_ld, a_offsets, b_offsets, c_offsets, a_transp = False, b_transp = False):
+    """
+    xGEMMBATCHED: Batched version of GEMM
+    """
+
+    dtype = check_dtype([a, b, c], ["float32", "float64", "complex64", "complex128", "float16"])
+    check_matrix(a, "a")
+    check_matrix(b, "b")
+    check_matrix(c, "c")
+
+    if len(a_offsets) != len(b_offsets) != len(c_offsets) != len(alphas) != len(betas):
+        raise RuntimeError("PyCLBlast: 'CLBlastXgemmBatched' failed: length of batch-sized arguments a_offsets, b_offsets, c_offsets, alphas, betas should be equal")
+    batch_count = len(a_offsets)
+
+    cdef size_t *a_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+    for i in range(batch_count):
+        a_offsets_c[i] = a_offsets[i]
+    cdef size_t *b_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+    for i in range(batch_count):
+        b_offsets_c[i] = b_offsets[i]
+    cdef size_t *c_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+    for i in range(batch_count):
+        c_offsets_c[i] = c_offsets[i]
+    cdef void *alphas_c = <void *> PyMem_Malloc(batch_count * sizeof(dtype_size[dtype]))
+    for i in range(batch_count):
+        if dtype == np.dtype("float32"):
+            (<cl_float*>alphas_c)[i] = <cl_float>alphas[i]
+        elif dtype == np.dtype("float64"):
+            (<cl_double*>alphas_c)[i] = <cl_double>alphas[i]
+        elif dtype == np.dtype("complex64"):
+            (<cl_float2*>alphas_c)[i] = <cl_float2>cl_float2(x=alphas[i].real,y=alphas[i].imag)
+        elif dtype == np.dtype("complex128"):
+            (<cl_double2*>alphas_c)[i] = <cl_double2>cl_double2(x=alphas[i].real,y=alphas[i].imag)
+        elif dtype == np.dtype("float16"):
+            (<cl_half*>alphas_c)[i] = <cl_half>alphas[i]
+    cdef void *betas_c = <void *> PyMem_Malloc(batch_count * sizeof(dtype_size[dtype]))
+    for i in range(batch_count):
+        if dtype == np.dtype("float32"):
+            (<cl_float*>betas_c)[i] = <cl_float>betas[i]
+        elif dtype == np.dtype("float64"):
+            (<cl_double*>betas_c)[i] = <cl_double>betas[i]
+        elif dtype == np.dtype("complex64"):
+            (<cl_float2*>betas_c)[i] = <cl_float2>cl_float2(x=betas[i].real,y=betas[i].imag)
+        elif dtype == np.dtype("complex128"):
+            (<cl_double2*>betas_c)[i] = <cl_double2>cl_double2(x=betas[i].real,y=betas[i].imag)
+        elif dtype == np.dtype("float16"):
+            (<cl_half*>betas_c)[i] = <cl_half>betas[i]
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
+    cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    b_transpose = CLBlastTransposeYes if b_transp else CLBlastTransposeNo
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastSgemmBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_float*>alphas_c, a_buffer, a_offsets_c, a_ld, b_buffer, b_offsets_c, b_ld, <cl_float*>betas_c, c_buffer, c_offsets_c, c_ld, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDgemmBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_double*>alphas_c, a_buffer, a_offsets_c, a_ld, b_buffer, b_offsets_c, b_ld, <cl_double*>betas_c, c_buffer, c_offsets_c, c_ld, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        err = CLBlastCgemmBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_float2*>alphas_c, a_buffer, a_offsets_c, a_ld, b_buffer, b_offsets_c, b_ld, <cl_float2*>betas_c, c_buffer, c_offsets_c, c_ld, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        err = CLBlastZgemmBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_double2*>alphas_c, a_buffer, a_offsets_c, a_ld, b_buffer, b_offsets_c, b_ld, <cl_double2*>betas_c, c_buffer, c_offsets_c, c_ld, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float16"):
+        err = CLBlastHgemmBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_half*>alphas_c, a_buffer, a_offsets_c, a_ld, b_buffer, b_offsets_c, b_ld, <cl_half*>betas_c, c_buffer, c_offsets_c, c_ld, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    PyMem_Free(a_offsets_c)
+    PyMem_Free(b_offsets_c)
+    PyMem_Free(c_offsets_c)
+    PyMem_Free(alphas_c)
+    PyMem_Free(betas_c)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXgemmBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of GEMM: SGEMMSTRIDEDBATCHED/DGEMMSTRIDEDBATCHED/CGEMMSTRIDEDBATCHED/ZGEMMSTRIDEDBATCHED/HGEMMSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastSgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const float beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const double beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const cl_float2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const cl_double2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastHgemmStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_half alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const size_t b_stride, const cl_half beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, const size_t c_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def gemmStridedBatched(queue, m, n, k, batch_count, a, b, c, a_ld, b_ld, c_ld, a_stride, b_stride, c_stride, alpha = 1.0, beta = 0.0, a_transp = False, b_transp = False, a_offset = 0, b_offset = 0, c_offset = 0):
+    """
+    xGEMMSTRIDEDBATCHED: StridedBatched version of GEMM
+    """
+
+    dtype = check_dtype([a, b, c], ["float32", "float64", "complex64", "complex128", "float16"])
+    check_matrix(a, "a")
+    check_matrix(b, "b")
+    check_matrix(c, "c")
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem b_buffer = <cl_mem><size_t>b.base_data.int_ptr
+    cdef cl_mem c_buffer = <cl_mem><size_t>c.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+    b_transpose = CLBlastTransposeYes if b_transp else CLBlastTransposeNo
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastSgemmStridedBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_float>alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, <cl_float>beta, c_buffer, c_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDgemmStridedBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_double>alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, <cl_double>beta, c_buffer, c_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        err = CLBlastCgemmStridedBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, <cl_float2>cl_float2(x=beta.real,y=beta.imag), c_buffer, c_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        err = CLBlastZgemmStridedBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, <cl_double2>cl_double2(x=beta.real,y=beta.imag), c_buffer, c_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float16"):
+        err = CLBlastHgemmStridedBatched(CLBlastLayoutRowMajor, a_transpose, b_transpose, m, n, k, <cl_half>alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, <cl_half>beta, c_buffer, c_offset, c_ld, c_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXgemmStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED/HGEMVBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastSgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const float *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const float *betas, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const double *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const double *betas, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_float2 *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const cl_float2 *betas, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_double2 *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const cl_double2 *betas, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastHgemvBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_half *alphas, const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const cl_half *betas, cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def gemvBatched(queue, m, n, a, x, y, alphas, betas, a_ld, a_offsets, x_offsets, y_offsets, x_inc = 1, y_inc = 1, a_transp = False):
+    """
+    xGEMVBATCHED: Batched version of GEMV
+    """
+
+    dtype = check_dtype([a, x, y], ["float32", "float64", "complex64", "complex128", "float16"])
+    check_matrix(a, "a")
+    check_vector(x, "x")
+    check_vector(y, "y")
+
+    if len(a_offsets) != len(x_offsets) != len(y_offsets) != len(alphas) != len(betas):
+        raise RuntimeError("PyCLBlast: 'CLBlastXgemvBatched' failed: length of batch-sized arguments a_offsets, x_offsets, y_offsets, alphas, betas should be equal")
+    batch_count = len(a_offsets)
+
+    cdef size_t *a_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+    for i in range(batch_count):
+        a_offsets_c[i] = a_offsets[i]
+    cdef size_t *x_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+    for i in range(batch_count):
+        x_offsets_c[i] = x_offsets[i]
+    cdef size_t *y_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+    for i in range(batch_count):
+        y_offsets_c[i] = y_offsets[i]
+    cdef void *alphas_c = <void *> PyMem_Malloc(batch_count * sizeof(dtype_size[dtype]))
+    for i in range(batch_count):
+        if dtype == np.dtype("float32"):
+            (<cl_float*>alphas_c)[i] = <cl_float>alphas[i]
+        elif dtype == np.dtype("float64"):
+            (<cl_double*>alphas_c)[i] = <cl_double>alphas[i]
+        elif dtype == np.dtype("complex64"):
+            (<cl_float2*>alphas_c)[i] = <cl_float2>cl_float2(x=alphas[i].real,y=alphas[i].imag)
+        elif dtype == np.dtype("complex128"):
+            (<cl_double2*>alphas_c)[i] = <cl_double2>cl_double2(x=alphas[i].real,y=alphas[i].imag)
+        elif dtype == np.dtype("float16"):
+            (<cl_half*>alphas_c)[i] = <cl_half>alphas[i]
+    cdef void *betas_c = <void *> PyMem_Malloc(batch_count * sizeof(dtype_size[dtype]))
+    for i in range(batch_count):
+        if dtype == np.dtype("float32"):
+            (<cl_float*>betas_c)[i] = <cl_float>betas[i]
+        elif dtype == np.dtype("float64"):
+            (<cl_double*>betas_c)[i] = <cl_double>betas[i]
+        elif dtype == np.dtype("complex64"):
+            (<cl_float2*>betas_c)[i] = <cl_float2>cl_float2(x=betas[i].real,y=betas[i].imag)
+        elif dtype == np.dtype("complex128"):
+            (<cl_double2*>betas_c)[i] = <cl_double2>cl_double2(x=betas[i].real,y=betas[i].imag)
+        elif dtype == np.dtype("float16"):
+            (<cl_half*>betas_c)[i] = <cl_half>betas[i]
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastSgemvBatched(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_float*>alphas_c, a_buffer, a_offsets_c, a_ld, x_buffer, x_offsets_c, x_inc, <cl_float*>betas_c, y_buffer, y_offsets_c, y_inc, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDgemvBatched(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_double*>alphas_c, a_buffer, a_offsets_c, a_ld, x_buffer, x_offsets_c, x_inc, <cl_double*>betas_c, y_buffer, y_offsets_c, y_inc, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        err = CLBlastCgemvBatched(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_float2*>alphas_c, a_buffer, a_offsets_c, a_ld, x_buffer, x_offsets_c, x_inc, <cl_float2*>betas_c, y_buffer, y_offsets_c, y_inc, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        err = CLBlastZgemvBatched(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_double2*>alphas_c, a_buffer, a_offsets_c, a_ld, x_buffer, x_offsets_c, x_inc, <cl_double2*>betas_c, y_buffer, y_offsets_c, y_inc, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float16"):
+        err = CLBlastHgemvBatched(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_half*>alphas_c, a_buffer, a_offsets_c, a_ld, x_buffer, x_offsets_c, x_inc, <cl_half*>betas_c, y_buffer, y_offsets_c, y_inc, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    PyMem_Free(a_offsets_c)
+    PyMem_Free(x_offsets_c)
+    PyMem_Free(y_offsets_c)
+    PyMem_Free(alphas_c)
+    PyMem_Free(betas_c)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXgemvBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED/HGEMVSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastSgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const float beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const double beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastCgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_float2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastZgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_double2 beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastHgemvStridedBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_half alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_half beta, cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def gemvStridedBatched(queue, m, n, batch_count, a, x, y, a_ld, a_stride, x_stride, y_stride, x_inc = 1, y_inc = 1, alpha = 1.0, beta = 0.0, a_transp = False, a_offset = 0, x_offset = 0, y_offset = 0):
+    """
+    xGEMVSTRIDEDBATCHED: StridedBatched version of GEMV
+    """
+
+    dtype = check_dtype([a, x, y], ["float32", "float64", "complex64", "complex128", "float16"])
+    check_matrix(a, "a")
+    check_vector(x, "x")
+    check_vector(y, "y")
+
+    cdef cl_mem a_buffer = <cl_mem><size_t>a.base_data.int_ptr
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+    a_transpose = CLBlastTransposeYes if a_transp else CLBlastTransposeNo
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastSgemvStridedBatched(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_float>alpha, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, <cl_float>beta, y_buffer, y_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDgemvStridedBatched(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_double>alpha, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, <cl_double>beta, y_buffer, y_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        err = CLBlastCgemvStridedBatched(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_float2>cl_float2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, <cl_float2>cl_float2(x=beta.real,y=beta.imag), y_buffer, y_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        err = CLBlastZgemvStridedBatched(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_double2>cl_double2(x=alpha.real,y=alpha.imag), a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, <cl_double2>cl_double2(x=beta.real,y=beta.imag), y_buffer, y_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float16"):
+        err = CLBlastHgemvStridedBatched(CLBlastLayoutRowMajor, a_transpose, m, n, <cl_half>alpha, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, <cl_half>beta, y_buffer, y_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXgemvStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Batched version of DOT: SDOTBATCHED/DDOTBATCHED/HDOTBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastSdotBatched(const size_t n, cl_mem dot_buffer, const size_t *dot_offsets, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDdotBatched(const size_t n, cl_mem dot_buffer, const size_t *dot_offsets, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastHdotBatched(const size_t n, cl_mem dot_buffer, const size_t *dot_offsets, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t *y_offsets, const size_t y_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def dotBatched(queue, n, x, y, dot, x_offsets, y_offsets, dot_offsets, x_inc = 1, y_inc = 1):
+    """
+    xDOTBATCHED: Batched version of DOT
+    """
+
+    dtype = check_dtype([x, y, dot], ["float32", "float64", "float16"])
+    check_vector(x, "x")
+    check_vector(y, "y")
+    check_matrix(dot, "dot")
+
+    if len(x_offsets) != len(y_offsets) != len(dot_offsets):
+        raise RuntimeError("PyCLBlast: 'CLBlastXdotBatched' failed: length of batch-sized arguments x_offsets, y_offsets, dot_offsets should be equal")
+    batch_count = len(x_offsets)
+
+    cdef size_t *x_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+    for i in range(batch_count):
+        x_offsets_c[i] = x_offsets[i]
+    cdef size_t *y_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+    for i in range(batch_count):
+        y_offsets_c[i] = y_offsets[i]
+    cdef size_t *dot_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+    for i in range(batch_count):
+        dot_offsets_c[i] = dot_offsets[i]
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef cl_mem dot_buffer = <cl_mem><size_t>dot.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastSdotBatched(n, dot_buffer, dot_offsets_c, x_buffer, x_offsets_c, x_inc, y_buffer, y_offsets_c, y_inc, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDdotBatched(n, dot_buffer, dot_offsets_c, x_buffer, x_offsets_c, x_inc, y_buffer, y_offsets_c, y_inc, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float16"):
+        err = CLBlastHdotBatched(n, dot_buffer, dot_offsets_c, x_buffer, x_offsets_c, x_inc, y_buffer, y_offsets_c, y_inc, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    PyMem_Free(x_offsets_c)
+    PyMem_Free(y_offsets_c)
+    PyMem_Free(dot_offsets_c)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXdotBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of DOT: SDOTSTRIDEDBATCHED/DDOTSTRIDEDBATCHED/HDOTSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastSdotStridedBatched(const size_t n, cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDdotStridedBatched(const size_t n, cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastHdotStridedBatched(const size_t n, cl_mem dot_buffer, const size_t dot_offset, const size_t dot_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def dotStridedBatched(queue, n, batch_count, x, y, dot, x_stride, y_stride, dot_stride, x_inc = 1, y_inc = 1, x_offset = 0, y_offset = 0, dot_offset = 0):
+    """
+    xDOTSTRIDEDBATCHED: StridedBatched version of DOT
+    """
+
+    dtype = check_dtype([x, y, dot], ["float32", "float64", "float16"])
+    check_vector(x, "x")
+    check_vector(y, "y")
+    check_matrix(dot, "dot")
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem y_buffer = <cl_mem><size_t>y.base_data.int_ptr
+    cdef cl_mem dot_buffer = <cl_mem><size_t>dot.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastSdotStridedBatched(n, dot_buffer, dot_offset, dot_stride, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDdotStridedBatched(n, dot_buffer, dot_offset, dot_stride, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float16"):
+        err = CLBlastHdotStridedBatched(n, dot_buffer, dot_offset, dot_stride, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXdotStridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Batched version of NRM2: SNRM2BATCHED/DNRM2BATCHED/ScNRM2BATCHED/DzNRM2BATCHED/HNRM2BATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastSnrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t *nrm2_offsets, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDnrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t *nrm2_offsets, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastScnrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t *nrm2_offsets, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDznrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t *nrm2_offsets, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastHnrm2Batched(const size_t n, cl_mem nrm2_buffer, const size_t *nrm2_offsets, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def nrm2Batched(queue, n, x, nrm2, x_offsets, nrm2_offsets, x_inc = 1):
+    """
+    xNRM2BATCHED: Batched version of NRM2
+    """
+
+    dtype = check_dtype([x, nrm2], ["float32", "float64", "complex64", "complex128", "float16"])
+    check_vector(x, "x")
+    check_matrix(nrm2, "nrm2")
+
+    if len(x_offsets) != len(nrm2_offsets):
+        raise RuntimeError("PyCLBlast: 'CLBlastXnrm2Batched' failed: length of batch-sized arguments x_offsets, nrm2_offsets should be equal")
+    batch_count = len(x_offsets)
+
+    cdef size_t *x_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+    for i in range(batch_count):
+        x_offsets_c[i] = x_offsets[i]
+    cdef size_t *nrm2_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+    for i in range(batch_count):
+        nrm2_offsets_c[i] = nrm2_offsets[i]
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem nrm2_buffer = <cl_mem><size_t>nrm2.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastSnrm2Batched(n, nrm2_buffer, nrm2_offsets_c, x_buffer, x_offsets_c, x_inc, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDnrm2Batched(n, nrm2_buffer, nrm2_offsets_c, x_buffer, x_offsets_c, x_inc, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        err = CLBlastScnrm2Batched(n, nrm2_buffer, nrm2_offsets_c, x_buffer, x_offsets_c, x_inc, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        err = CLBlastDznrm2Batched(n, nrm2_buffer, nrm2_offsets_c, x_buffer, x_offsets_c, x_inc, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float16"):
+        err = CLBlastHnrm2Batched(n, nrm2_buffer, nrm2_offsets_c, x_buffer, x_offsets_c, x_inc, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    PyMem_Free(x_offsets_c)
+    PyMem_Free(nrm2_offsets_c)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXnrm2Batched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of NRM2: SNRM2STRIDEDBATCHED/DNRM2STRIDEDBATCHED/ScNRM2STRIDEDBATCHED/DzNRM2STRIDEDBATCHED/HNRM2STRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastSnrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDnrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastScnrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDznrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastHnrm2StridedBatched(const size_t n, cl_mem nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def nrm2StridedBatched(queue, n, batch_count, x, nrm2, x_stride, nrm2_stride, x_inc = 1, x_offset = 0, nrm2_offset = 0):
+    """
+    xNRM2STRIDEDBATCHED: StridedBatched version of NRM2
+    """
+
+    dtype = check_dtype([x, nrm2], ["float32", "float64", "complex64", "complex128", "float16"])
+    check_vector(x, "x")
+    check_matrix(nrm2, "nrm2")
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem nrm2_buffer = <cl_mem><size_t>nrm2.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastSnrm2StridedBatched(n, nrm2_buffer, nrm2_offset, nrm2_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDnrm2StridedBatched(n, nrm2_buffer, nrm2_offset, nrm2_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        err = CLBlastScnrm2StridedBatched(n, nrm2_buffer, nrm2_offset, nrm2_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        err = CLBlastDznrm2StridedBatched(n, nrm2_buffer, nrm2_offset, nrm2_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float16"):
+        err = CLBlastHnrm2StridedBatched(n, nrm2_buffer, nrm2_offset, nrm2_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXnrm2StridedBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# Batched version of ASUM: SASUMBATCHED/DASUMBATCHED/ScASUMBATCHED/DzASUMBATCHED/HASUMBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastSasumBatched(const size_t n, cl_mem asum_buffer, const size_t *asum_offsets, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDasumBatched(const size_t n, cl_mem asum_buffer, const size_t *asum_offsets, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastScasumBatched(const size_t n, cl_mem asum_buffer, const size_t *asum_offsets, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDzasumBatched(const size_t n, cl_mem asum_buffer, const size_t *asum_offsets, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastHasumBatched(const size_t n, cl_mem asum_buffer, const size_t *asum_offsets, const cl_mem x_buffer, const size_t *x_offsets, const size_t x_inc, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def asumBatched(queue, n, x, asum, x_offsets, asum_offsets, x_inc = 1):
+    """
+    xASUMBATCHED: Batched version of ASUM
+    """
+
+    dtype = check_dtype([x, asum], ["float32", "float64", "complex64", "complex128", "float16"])
+    check_vector(x, "x")
+    check_matrix(asum, "asum")
+
+    if len(x_offsets) != len(asum_offsets):
+        raise RuntimeError("PyCLBlast: 'CLBlastXasumBatched' failed: length of batch-sized arguments x_offsets, asum_offsets should be equal")
+    batch_count = len(x_offsets)
+
+    cdef size_t *x_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+    for i in range(batch_count):
+        x_offsets_c[i] = x_offsets[i]
+    cdef size_t *asum_offsets_c = <size_t *> PyMem_Malloc(batch_count * sizeof(size_t))
+    for i in range(batch_count):
+        asum_offsets_c[i] = asum_offsets[i]
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem asum_buffer = <cl_mem><size_t>asum.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastSasumBatched(n, asum_buffer, asum_offsets_c, x_buffer, x_offsets_c, x_inc, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDasumBatched(n, asum_buffer, asum_offsets_c, x_buffer, x_offsets_c, x_inc, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        err = CLBlastScasumBatched(n, asum_buffer, asum_offsets_c, x_buffer, x_offsets_c, x_inc, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        err = CLBlastDzasumBatched(n, asum_buffer, asum_offsets_c, x_buffer, x_offsets_c, x_inc, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float16"):
+        err = CLBlastHasumBatched(n, asum_buffer, asum_offsets_c, x_buffer, x_offsets_c, x_inc, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    PyMem_Free(x_offsets_c)
+    PyMem_Free(asum_offsets_c)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXasumBatched' failed: %s" % get_status_message(err))
+    return cl.Event.from_int_ptr(<size_t>event)
+
+####################################################################################################
+# StridedBatched version of ASUM: SASUMSTRIDEDBATCHED/DASUMSTRIDEDBATCHED/ScASUMSTRIDEDBATCHED/DzASUMSTRIDEDBATCHED/HASUMSTRIDEDBATCHED
+####################################################################################################
+
+cdef extern from "clblast_c.h":
+    CLBlastStatusCode CLBlastSasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastScasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastDzasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+    CLBlastStatusCode CLBlastHasumStridedBatched(const size_t n, cl_mem asum_buffer, const size_t asum_offset, const size_t asum_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count,cl_command_queue* queue, cl_event* event)
+
+def asumStridedBatched(queue, n, batch_count, x, asum, x_stride, asum_stride, x_inc = 1, x_offset = 0, asum_offset = 0):
+    """
+    xASUMSTRIDEDBATCHED: StridedBatched version of ASUM
+    """
+
+    dtype = check_dtype([x, asum], ["float32", "float64", "complex64", "complex128", "float16"])
+    check_vector(x, "x")
+    check_matrix(asum, "asum")
+
+    cdef cl_mem x_buffer = <cl_mem><size_t>x.base_data.int_ptr
+    cdef cl_mem asum_buffer = <cl_mem><size_t>asum.base_data.int_ptr
+
+    cdef cl_command_queue command_queue = <cl_command_queue><size_t>queue.int_ptr
+    cdef cl_event event = NULL
+
+    cdef CLBlastStatusCode err
+    if dtype == np.dtype("float32"):
+        err = CLBlastSasumStridedBatched(n, asum_buffer, asum_offset, asum_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float64"):
+        err = CLBlastDasumStridedBatched(n, asum_buffer, asum_offset, asum_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex64"):
+        err = CLBlastScasumStridedBatched(n, asum_buffer, asum_offset, asum_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("complex128"):
+        err = CLBlastDzasumStridedBatched(n, asum_buffer, asum_offset, asum_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    elif dtype == np.dtype("float16"):
+        err = CLBlastHasumStridedBatched(n, asum_buffer, asum_offset, asum_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, &command_queue, &event)
+    else:
+        raise ValueError("PyCLBlast: Unrecognized data-type '%s'" % dtype)
+
+    if err != CLBlastSuccess:
+        raise RuntimeError("PyCLBlast: 'CLBlastXasumStridedBatched' failed: %s" % get_status_message(err))
     return cl.Event.from_int_ptr(<size_t>event)
 
 ####################################################################################################
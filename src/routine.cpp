@@ -26,6 +26,10 @@ const std::vector<std::string> Routine::routines_axpy = {"AXPY", "COPY", "SCAL",
 const std::vector<std::string> Routine::routines_dot = {"AMAX", "ASUM", "DOT", "DOTC", "DOTU", "MAX", "MIN", "NRM2", "SUM"};
 const std::vector<std::string> Routine::routines_ger = {"GER", "GERC", "GERU", "HER", "HER2", "HPR", "HPR2", "SPR", "SPR2", "SYR", "SYR2"};
 const std::vector<std::string> Routine::routines_gemv = {"GBMV", "GEMV", "HBMV", "HEMV", "HPMV", "SBMV", "SPMV", "SYMV", "TMBV", "TPMV", "TRMV", "TRSV"};
+const std::vector<std::string> Routine::routines_gbmv = {"GBMV", "HBMV", "SBMV"};
+const std::vector<std::string> Routine::routines_trmv = {"HPMV", "SPMV", "TBMV", "TPMV", "TRMV"};
+const std::vector<std::string> Routine::routines_symv = {"HEMV", "SYMV"};
+const std::vector<std::string> Routine::routines_gemv_batched = {"GEMVBATCHED", "GEMVSTRIDEDBATCHED"};
 const std::vector<std::string> Routine::routines_gemm = {"GEMM", "HEMM", "SYMM", "TRMM"};
 const std::vector<std::string> Routine::routines_gemm_syrk = {"GEMM", "HEMM", "HER2K", "HERK", "SYMM", "SYR2K", "SYRK", "TRMM", "TRSM"};
 const std::vector<std::string> Routine::routines_trsm = {"TRSM"};
@@ -35,6 +39,10 @@ const std::unordered_map<std::string, const std::vector<std::string>> Routine::r
   {"Xgemv", routines_gemv},
   {"XgemvFast", routines_gemv},
   {"XgemvFastRot", routines_gemv},
+  {"XgemvBatched", routines_gemv_batched},
+  {"Xgbmv", routines_gbmv},
+  {"Xtrmv", routines_trmv},
+  {"Xsymv", routines_symv},
   {"Xtrsv", routines_gemv},
   {"Xger", routines_ger},
   {"Copy", routines_gemm_syrk},
@@ -44,6 +52,7 @@ const std::unordered_map<std::string, const std::vector<std::string>> Routine::r
   {"Xgemm", routines_gemm_syrk},
   {"XgemmDirect", routines_gemm},
   {"GemmRoutine", routines_gemm},
+  {"Gemm3m", routines_gemm},
   {"Invert", routines_trsm},
 };
 // =================================================================================================
@@ -52,7 +61,8 @@ const std::unordered_map<std::string, const std::vector<std::string>> Routine::r
 Routine::Routine(Queue &queue, EventPointer event, const std::string &name,
                  const std::vector<std::string> &kernel_names, const Precision precision,
                  const std::vector<database::DatabaseEntry> &userDatabase,
-                 std::initializer_list<const char *> source):
+                 std::initializer_list<const char *> source,
+                 const bool device_scalars):
     precision_(precision),
     routine_name_(name),
     kernel_names_(kernel_names),
@@ -60,6 +70,7 @@ Routine::Routine(Queue &queue, EventPointer event, const std::string &name,
     event_(event),
     context_(queue_.GetContext()),
     device_(queue_.GetDevice()),
+    device_scalars_(device_scalars),
     db_(kernel_names) {
 
   InitDatabase(device_, kernel_names, precision, userDatabase, db_);
@@ -67,19 +78,26 @@ Routine::Routine(Queue &queue, EventPointer event, const std::string &name,
 }
 
 void Routine::InitProgram(std::initializer_list<const char *> source) {
+  program_ = GetProgram("", source);
+}
+
+std::shared_ptr<Program> Routine::GetProgram(const std::string &program_name,
+                                             std::initializer_list<const char *> source) {
 
   // Determines the identifier for this particular routine call
   auto routine_info = routine_name_;
+  if (!program_name.empty()) { routine_info += "_" + program_name; }
   for (const auto &kernel_name : kernel_names_) {
     routine_info += "_" + kernel_name + db_(kernel_name).GetValuesString();
   }
+  if (device_scalars_) { routine_info += "_DEVICE_SCALARS"; }
   log_debug(routine_info);
 
   // Queries the cache to see whether or not the program (context-specific) is already there
   bool has_program;
-  program_ = ProgramCache::Instance().Get(ProgramKeyRef{ context_(), device_(), precision_, routine_info },
-                                          &has_program);
-  if (has_program) { return; }
+  auto program = ProgramCache::Instance().Get(ProgramKeyRef{ context_(), device_(), precision_, routine_info },
+                                              &has_program);
+  if (has_program) { return program; }
 
   // Sets the build options from an environmental variable (if set)
   auto options = std::vector<std::string>();
@@ -96,12 +114,12 @@ void Routine::InitProgram(std::initializer_list<const char *> source) {
   auto binary = BinaryCache::Instance().Get(BinaryKeyRef{platform_id,  precision_, routine_info, device_name },
                                             &has_binary);
   if (has_binary) {
-    program_ = std::make_shared<Program>(device_, context_, binary);
+    program = std::make_shared<Program>(device_, context_, binary);
     SetOpenCLKernelStandard(device_, options);
-    program_->Build(device_, options);
+    program->Build(device_, options);
     ProgramCache::Instance().Store(ProgramKey{ context_(), device_(), precision_, routine_info },
-                                    std::shared_ptr<Program>{program_});
-    return;
+                                    std::shared_ptr<Program>{program});
+    return program;
   }
 
   // Otherwise, the kernel will be compiled and program will be built. Both the binary and the
@@ -130,16 +148,17 @@ void Routine::InitProgram(std::initializer_list<const char *> source) {
   }
 
   // Completes the source and compiles the kernel
-  program_ = CompileFromSource(source_string, precision_, routine_name_,
-                               device_, context_, options, 0);
+  program = CompileFromSource(source_string, precision_, routine_name_,
+                              device_, context_, options, 0, false, device_scalars_);
 
 
   // Store the compiled binary and program in the cache
   BinaryCache::Instance().Store(BinaryKey{platform_id, precision_, routine_info, device_name},
-                                program_->GetIR());
+                                program->GetIR());
 
   ProgramCache::Instance().Store(ProgramKey{context_(), device_(), precision_, routine_info},
-                                 std::shared_ptr<Program>{program_});
+                                 std::shared_ptr<Program>{program});
+  return program;
 }
 
 // =================================================================================================
@@ -59,16 +59,23 @@ class Routine {
   // All heavy preparation work is done inside this constructor.
   // NOTE: the caller must provide the same userDatabase for each combination of device, precision
   // and routine list, otherwise the caching logic will break.
+  // In device-scalar mode the kernels are compiled to read their scalar arguments (e.g. alpha and
+  // beta) from device memory, see 'SetScalarArgument' below.
   explicit Routine(Queue &queue, EventPointer event, const std::string &name,
                    const std::vector<std::string> &routines, const Precision precision,
                    const std::vector<database::DatabaseEntry> &userDatabase,
-                   std::initializer_list<const char *> source);
+                   std::initializer_list<const char *> source,
+                   const bool device_scalars = false);
 
   // List of kernel-routine look-ups
   static const std::vector<std::string> routines_axpy;
   static const std::vector<std::string> routines_dot;
   static const std::vector<std::string> routines_ger;
   static const std::vector<std::string> routines_gemv;
+  static const std::vector<std::string> routines_gbmv;
+  static const std::vector<std::string> routines_trmv;
+  static const std::vector<std::string> routines_symv;
+  static const std::vector<std::string> routines_gemv_batched;
   static const std::vector<std::string> routines_gemm;
   static const std::vector<std::string> routines_gemm_syrk;
   static const std::vector<std::string> routines_trsm;
@@ -81,6 +88,30 @@ class Routine {
 
  protected:
 
+  // As above, but for kernels which only some of the calls to this routine need, such that they are
+  // not compiled into the main program. The program is identified by 'program_name' and is
+  // compiled with the same parameters as the main program.
+  std::shared_ptr<Program> GetProgram(const std::string &program_name,
+                                      std::initializer_list<const char *> source);
+
+  // Sets a scalar argument of a kernel and its offset, which is the next argument. A scalar in
+  // device memory is passed as a buffer and an offset, such that no host synchronisation or copy is
+  // needed. For a scalar on the host the offset is unused and set to zero.
+  template <typename T>
+  void SetScalarArgument(Kernel &kernel, const size_t index, const Scalar<T> &scalar) {
+    if (scalar.OnDevice() != device_scalars_) {
+      throw LogicError("Routine: scalar argument does not match the device-scalar mode");
+    }
+    if (!scalar.OnDevice()) {
+      kernel.SetArgument(index, GetRealArg(scalar.Value()));
+      kernel.SetArgument(index + 1, 0);
+      return;
+    }
+    TestVectorScalar(1, scalar.GetBuffer(), scalar.Offset());
+    kernel.SetArgument(index, scalar.GetBuffer()());
+    kernel.SetArgument(index + 1, static_cast<int>(scalar.Offset()));
+  }
+
   // Non-static variable for the precision
   const Precision precision_;
 
@@ -94,6 +125,9 @@ class Routine {
   const Context context_;
   const Device device_;
 
+  // Whether the kernels read their scalar arguments from device memory
+  const bool device_scalars_;
+
   // Compiled program (either retrieved from cache or compiled in slow path)
   std::shared_ptr<Program> program_;
 
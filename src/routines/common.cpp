@@ -16,6 +16,7 @@
 #include <iostream>
 
 #include "routines/common.hpp"
+#include "cache.hpp"
 
 namespace clblast {
 // =================================================================================================
@@ -82,6 +83,24 @@ void RunKernel(Kernel &kernel, Queue &queue, const Device &device,
   #endif
 }
 
+// Retrieves a zero-initialised synchronisation buffer, creating and storing it in the cache first
+// in case it is not there yet. This write is blocking, but happens only once.
+Buffer<int> GetSyncBuffer(Queue &queue, const Context &context, const std::string &name,
+                          const size_t size) {
+  if (queue.IsOutOfOrder()) {
+    throw LogicError("GetSyncBuffer: the shared synchronisation buffer requires an in-order queue");
+  }
+  bool in_cache;
+  const auto sync_buffer = SyncBufferCache::Instance().Get(SyncBufferKeyRef{context(), queue(), name},
+                                                           &in_cache);
+  if (in_cache) { return *sync_buffer; }
+  auto buffer = Buffer<int>(context, size);
+  buffer.Write(queue, size, std::vector<int>(size, 0));
+  SyncBufferCache::Instance().Store(SyncBufferKey{context(), queue(), name},
+                                    std::make_shared<Buffer<int>>(buffer));
+  return buffer;
+}
+
 // =================================================================================================
 
 // Sets all elements of a matrix to a constant value
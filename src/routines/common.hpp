@@ -31,6 +31,49 @@ void RunKernel(Kernel &kernel, Queue &queue, const Device &device,
                std::vector<size_t> global, const std::vector<size_t> &local,
                EventPointer event, const std::vector<Event> &waitForEvents = {});
 
+// Retrieves a zero-initialised buffer of 'size' integers with which the work-groups of a kernel
+// synchronise. It is created once per context, queue and name and then re-used from the cache, so
+// the kernels using it have to leave it zeroed when they finish. This relies on consecutive kernels
+// not overlapping, so it may only be used with in-order queues: callers have to fall back to a
+// different code-path when 'queue.IsOutOfOrder()' is true.
+Buffer<int> GetSyncBuffer(Queue &queue, const Context &context, const std::string &name,
+                          const size_t size);
+
+// =================================================================================================
+
+// A scalar argument of a routine, such as alpha or beta. This is either a value passed from the host
+// or, for routines constructed in device-scalar mode, an element of a device buffer. In the latter
+// case the value is read by the kernel itself, such that a scalar computed on the device (e.g. by a
+// DOT) can be used without reading it back to the host first.
+template <typename T>
+class Scalar {
+ public:
+
+  // A value passed from the host. This constructor is deliberately not explicit, such that a value
+  // of type 'T' can be passed wherever a scalar argument is expected.
+  Scalar(const T value):
+      value_(value), buffer_(Buffer<T>(0)), offset_(0), on_device_(false) { }
+
+  // A value stored in device memory at the given offset
+  explicit Scalar(const Buffer<T> &buffer, const size_t offset):
+      value_(), buffer_(buffer), offset_(offset), on_device_(true) { }
+
+  // Accessors to the value (host only) and to the buffer and offset (device only)
+  bool OnDevice() const { return on_device_; }
+  T Value() const {
+    if (on_device_) { throw LogicError("Scalar: the value is stored in device memory"); }
+    return value_;
+  }
+  const Buffer<T>& GetBuffer() const { return buffer_; }
+  size_t Offset() const { return offset_; }
+
+ private:
+  T value_;
+  Buffer<T> buffer_;
+  size_t offset_;
+  bool on_device_;
+};
+
 // =================================================================================================
 
 // Sets all elements of a matrix to a constant value
@@ -22,7 +22,8 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xamax<T>::Xamax(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {}, {
+    Routine(queue, event, name, {"Xdot", "ReductionSingleLaunch"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/reduction.opencl"
     #include "../../kernels/level1/xamax.opencl"
     }) {
 }
@@ -42,15 +43,38 @@ void Xamax<T>::DoAmax(const size_t n,
   TestVectorX(n, x_buffer, x_offset, x_inc);
   TestVectorIndex(1, imax_buffer, imax_offset);
 
-  // Retrieves the Xamax kernels from the compiled binary
-  auto kernel1 = Kernel(program_, "Xamax");
-  auto kernel2 = Kernel(program_, "XamaxEpilogue");
-
   // Creates the buffer for intermediate values
   auto temp_size = 2*db_["WGS2"];
   auto temp_buffer1 = Buffer<T>(context_, temp_size);
   auto temp_buffer2 = Buffer<unsigned int>(context_, temp_size);
 
+  // In single-launch mode the last work-group to finish performs the final reduction, such that the
+  // epilogue kernel is not needed. This requires a work-group counter, kept zeroed by the kernel,
+  // which can only be shared between calls on an in-order queue.
+  if (db_["REDUCTION_SINGLE_LAUNCH"] == 1 && !queue_.IsOutOfOrder()) {
+    auto counter_buffer = GetSyncBuffer(queue_, context_, "ReductionCounter", 1);
+    auto kernel = Kernel(program_, "XamaxSingleLaunch");
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, x_buffer());
+    kernel.SetArgument(2, static_cast<int>(x_offset));
+    kernel.SetArgument(3, static_cast<int>(x_inc));
+    kernel.SetArgument(4, temp_buffer1());
+    kernel.SetArgument(5, temp_buffer2());
+    kernel.SetArgument(6, counter_buffer());
+    kernel.SetArgument(7, imax_buffer());
+    kernel.SetArgument(8, static_cast<int>(imax_offset));
+
+    // Launches the kernel
+    auto global = std::vector<size_t>{db_["WGS1"]*temp_size};
+    auto local = std::vector<size_t>{db_["WGS1"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+    return;
+  }
+
+  // Retrieves the Xamax kernels from the compiled binary
+  auto kernel1 = Kernel(program_, "Xamax");
+  auto kernel2 = Kernel(program_, "XamaxEpilogue");
+
   // Sets the kernel arguments
   kernel1.SetArgument(0, static_cast<int>(n));
   kernel1.SetArgument(1, x_buffer());
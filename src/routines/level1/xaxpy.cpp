@@ -21,18 +21,19 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xaxpy<T>::Xaxpy(Queue &queue, EventPointer event, const std::string &name):
+Xaxpy<T>::Xaxpy(Queue &queue, EventPointer event, const std::string &name,
+                const bool device_scalars):
     Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {}, {
     #include "../../kernels/level1/level1.opencl"
     #include "../../kernels/level1/xaxpy.opencl"
-    }) {
+    }, device_scalars) {
 }
 
 // =================================================================================================
 
 // The main routine
 template <typename T>
-void Xaxpy<T>::DoAxpy(const size_t n, const T alpha,
+void Xaxpy<T>::DoAxpy(const size_t n, const Scalar<T> &alpha,
                       const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
                       const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc) {
 
@@ -60,19 +61,19 @@ void Xaxpy<T>::DoAxpy(const size_t n, const T alpha,
   // Sets the kernel arguments
   if (use_faster_kernel || use_fastest_kernel) {
     kernel.SetArgument(0, static_cast<int>(n));
-    kernel.SetArgument(1, GetRealArg(alpha));
-    kernel.SetArgument(2, x_buffer());
-    kernel.SetArgument(3, y_buffer());
+    SetScalarArgument(kernel, 1, alpha);
+    kernel.SetArgument(3, x_buffer());
+    kernel.SetArgument(4, y_buffer());
   }
   else {
     kernel.SetArgument(0, static_cast<int>(n));
-    kernel.SetArgument(1, GetRealArg(alpha));
-    kernel.SetArgument(2, x_buffer());
-    kernel.SetArgument(3, static_cast<int>(x_offset));
-    kernel.SetArgument(4, static_cast<int>(x_inc));
-    kernel.SetArgument(5, y_buffer());
-    kernel.SetArgument(6, static_cast<int>(y_offset));
-    kernel.SetArgument(7, static_cast<int>(y_inc));
+    SetScalarArgument(kernel, 1, alpha);
+    kernel.SetArgument(3, x_buffer());
+    kernel.SetArgument(4, static_cast<int>(x_offset));
+    kernel.SetArgument(5, static_cast<int>(x_inc));
+    kernel.SetArgument(6, y_buffer());
+    kernel.SetArgument(7, static_cast<int>(y_offset));
+    kernel.SetArgument(8, static_cast<int>(y_inc));
   }
 
   // Launches the kernel
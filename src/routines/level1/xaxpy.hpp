@@ -25,10 +25,11 @@ class Xaxpy: public Routine {
  public:
 
   // Constructor
-  Xaxpy(Queue &queue, EventPointer event, const std::string &name = "AXPY");
+  Xaxpy(Queue &queue, EventPointer event, const std::string &name = "AXPY",
+        const bool device_scalars = false);
 
   // Templated-precision implementation of the routine
-  void DoAxpy(const size_t n, const T alpha,
+  void DoAxpy(const size_t n, const Scalar<T> &alpha,
               const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
               const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc);
 };
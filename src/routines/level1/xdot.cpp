@@ -22,7 +22,8 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xdot<T>::Xdot(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {}, {
+    Routine(queue, event, name, {"Xdot", "ReductionSingleLaunch"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/reduction.opencl"
     #include "../../kernels/level1/xdot.opencl"
     }) {
 }
@@ -45,14 +46,40 @@ void Xdot<T>::DoDot(const size_t n,
   TestVectorY(n, y_buffer, y_offset, y_inc);
   TestVectorScalar(1, dot_buffer, dot_offset);
 
-  // Retrieves the Xdot kernels from the compiled binary
-  auto kernel1 = Kernel(program_, "Xdot");
-  auto kernel2 = Kernel(program_, "XdotEpilogue");
-
   // Creates the buffer for intermediate values
   auto temp_size = 2*db_["WGS2"];
   auto temp_buffer = Buffer<T>(context_, temp_size);
 
+  // In single-launch mode the last work-group to finish performs the final reduction, such that the
+  // epilogue kernel is not needed. This requires a work-group counter, kept zeroed by the kernel,
+  // which can only be shared between calls on an in-order queue.
+  if (db_["REDUCTION_SINGLE_LAUNCH"] == 1 && !queue_.IsOutOfOrder()) {
+    auto counter_buffer = GetSyncBuffer(queue_, context_, "ReductionCounter", 1);
+    auto kernel = Kernel(program_, "XdotSingleLaunch");
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, x_buffer());
+    kernel.SetArgument(2, static_cast<int>(x_offset));
+    kernel.SetArgument(3, static_cast<int>(x_inc));
+    kernel.SetArgument(4, y_buffer());
+    kernel.SetArgument(5, static_cast<int>(y_offset));
+    kernel.SetArgument(6, static_cast<int>(y_inc));
+    kernel.SetArgument(7, temp_buffer());
+    kernel.SetArgument(8, static_cast<int>(do_conjugate));
+    kernel.SetArgument(9, counter_buffer());
+    kernel.SetArgument(10, dot_buffer());
+    kernel.SetArgument(11, static_cast<int>(dot_offset));
+
+    // Launches the kernel
+    auto global = std::vector<size_t>{db_["WGS1"]*temp_size};
+    auto local = std::vector<size_t>{db_["WGS1"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+    return;
+  }
+
+  // Retrieves the Xdot kernels from the compiled binary
+  auto kernel1 = Kernel(program_, "Xdot");
+  auto kernel2 = Kernel(program_, "XdotEpilogue");
+
   // Sets the kernel arguments
   kernel1.SetArgument(0, static_cast<int>(n));
   kernel1.SetArgument(1, x_buffer());
@@ -22,7 +22,8 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xnrm2<T>::Xnrm2(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {}, {
+    Routine(queue, event, name, {"Xdot", "ReductionSingleLaunch"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/reduction.opencl"
     #include "../../kernels/level1/xnrm2.opencl"
     }) {
 }
@@ -42,14 +43,36 @@ void Xnrm2<T>::DoNrm2(const size_t n,
   TestVectorX(n, x_buffer, x_offset, x_inc);
   TestVectorScalar(1, nrm2_buffer, nrm2_offset);
 
-  // Retrieves the Xnrm2 kernels from the compiled binary
-  auto kernel1 = Kernel(program_, "Xnrm2");
-  auto kernel2 = Kernel(program_, "Xnrm2Epilogue");
-
   // Creates the buffer for intermediate values
   auto temp_size = 2*db_["WGS2"];
   auto temp_buffer = Buffer<T>(context_, temp_size);
 
+  // In single-launch mode the last work-group to finish performs the final reduction, such that the
+  // epilogue kernel is not needed. This requires a work-group counter, kept zeroed by the kernel,
+  // which can only be shared between calls on an in-order queue.
+  if (db_["REDUCTION_SINGLE_LAUNCH"] == 1 && !queue_.IsOutOfOrder()) {
+    auto counter_buffer = GetSyncBuffer(queue_, context_, "ReductionCounter", 1);
+    auto kernel = Kernel(program_, "Xnrm2SingleLaunch");
+    kernel.SetArgument(0, static_cast<int>(n));
+    kernel.SetArgument(1, x_buffer());
+    kernel.SetArgument(2, static_cast<int>(x_offset));
+    kernel.SetArgument(3, static_cast<int>(x_inc));
+    kernel.SetArgument(4, temp_buffer());
+    kernel.SetArgument(5, counter_buffer());
+    kernel.SetArgument(6, nrm2_buffer());
+    kernel.SetArgument(7, static_cast<int>(nrm2_offset));
+
+    // Launches the kernel
+    auto global = std::vector<size_t>{db_["WGS1"]*temp_size};
+    auto local = std::vector<size_t>{db_["WGS1"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+    return;
+  }
+
+  // Retrieves the Xnrm2 kernels from the compiled binary
+  auto kernel1 = Kernel(program_, "Xnrm2");
+  auto kernel2 = Kernel(program_, "Xnrm2Epilogue");
+
   // Sets the kernel arguments
   kernel1.SetArgument(0, static_cast<int>(n));
   kernel1.SetArgument(1, x_buffer());
@@ -0,0 +1,71 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xrotg class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/level1/xrotg.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xrotg<T>::Xrotg(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/xrotg.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xrotg<T>::DoRotg(const Buffer<T> &sa_buffer, const size_t sa_offset,
+                      const Buffer<T> &sb_buffer, const size_t sb_offset,
+                      const Buffer<T> &sc_buffer, const size_t sc_offset,
+                      const Buffer<T> &ss_buffer, const size_t ss_offset) {
+
+  // Tests the scalars for validity
+  TestVectorScalar(1, sa_buffer, sa_offset);
+  TestVectorScalar(1, sb_buffer, sb_offset);
+  TestVectorScalar(1, sc_buffer, sc_offset);
+  TestVectorScalar(1, ss_buffer, ss_offset);
+
+  // Retrieves the Xrotg kernel from the compiled binary
+  auto kernel = Kernel(program_, "Xrotg");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, sa_buffer());
+  kernel.SetArgument(1, static_cast<int>(sa_offset));
+  kernel.SetArgument(2, sb_buffer());
+  kernel.SetArgument(3, static_cast<int>(sb_offset));
+  kernel.SetArgument(4, sc_buffer());
+  kernel.SetArgument(5, static_cast<int>(sc_offset));
+  kernel.SetArgument(6, ss_buffer());
+  kernel.SetArgument(7, static_cast<int>(ss_offset));
+
+  // Launches the kernel as a single work-item
+  auto global = std::vector<size_t>{1};
+  auto local = std::vector<size_t>{1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xrotg<float>;
+template class Xrotg<double>;
+
+// =================================================================================================
+} // namespace clblast
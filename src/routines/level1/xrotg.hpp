@@ -0,0 +1,42 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xrotg routine. The precision is implemented using a template argument.
+// The scalars are processed by a single work-item, such that they never leave the device.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XROTG_H_
+#define CLBLAST_ROUTINES_XROTG_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xrotg: public Routine {
+ public:
+
+  // Constructor
+  Xrotg(Queue &queue, EventPointer event, const std::string &name = "ROTG");
+
+  // Templated-precision implementation of the routine
+  void DoRotg(const Buffer<T> &sa_buffer, const size_t sa_offset,
+              const Buffer<T> &sb_buffer, const size_t sb_offset,
+              const Buffer<T> &sc_buffer, const size_t sc_offset,
+              const Buffer<T> &ss_buffer, const size_t ss_offset);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XROTG_H_
+#endif
@@ -0,0 +1,75 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xrotmg class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/level1/xrotmg.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xrotmg<T>::Xrotmg(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/xrotg.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xrotmg<T>::DoRotmg(const Buffer<T> &sd1_buffer, const size_t sd1_offset,
+                        const Buffer<T> &sd2_buffer, const size_t sd2_offset,
+                        const Buffer<T> &sx1_buffer, const size_t sx1_offset,
+                        const Buffer<T> &sy1_buffer, const size_t sy1_offset,
+                        const Buffer<T> &sparam_buffer, const size_t sparam_offset) {
+
+  // Tests the scalars for validity
+  TestVectorScalar(1, sd1_buffer, sd1_offset);
+  TestVectorScalar(1, sd2_buffer, sd2_offset);
+  TestVectorScalar(1, sx1_buffer, sx1_offset);
+  TestVectorScalar(1, sy1_buffer, sy1_offset);
+  TestVectorScalar(5, sparam_buffer, sparam_offset);
+
+  // Retrieves the Xrotmg kernel from the compiled binary
+  auto kernel = Kernel(program_, "Xrotmg");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, sd1_buffer());
+  kernel.SetArgument(1, static_cast<int>(sd1_offset));
+  kernel.SetArgument(2, sd2_buffer());
+  kernel.SetArgument(3, static_cast<int>(sd2_offset));
+  kernel.SetArgument(4, sx1_buffer());
+  kernel.SetArgument(5, static_cast<int>(sx1_offset));
+  kernel.SetArgument(6, sy1_buffer());
+  kernel.SetArgument(7, static_cast<int>(sy1_offset));
+  kernel.SetArgument(8, sparam_buffer());
+  kernel.SetArgument(9, static_cast<int>(sparam_offset));
+
+  // Launches the kernel as a single work-item
+  auto global = std::vector<size_t>{1};
+  auto local = std::vector<size_t>{1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xrotmg<float>;
+template class Xrotmg<double>;
+
+// =================================================================================================
+} // namespace clblast
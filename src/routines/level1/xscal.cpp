@@ -21,18 +21,19 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xscal<T>::Xscal(Queue &queue, EventPointer event, const std::string &name):
+Xscal<T>::Xscal(Queue &queue, EventPointer event, const std::string &name,
+                const bool device_scalars):
     Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {}, {
     #include "../../kernels/level1/level1.opencl"
     #include "../../kernels/level1/xscal.opencl"
-    }) {
+    }, device_scalars) {
 }
 
 // =================================================================================================
 
 // The main routine
 template <typename T>
-void Xscal<T>::DoScal(const size_t n, const T alpha,
+void Xscal<T>::DoScal(const size_t n, const Scalar<T> &alpha,
                       const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
 
   // Makes sure all dimensions are larger than zero
@@ -54,15 +55,15 @@ void Xscal<T>::DoScal(const size_t n, const T alpha,
   // Sets the kernel arguments
   if (use_fast_kernel) {
     kernel.SetArgument(0, static_cast<int>(n));
-    kernel.SetArgument(1, GetRealArg(alpha));
-    kernel.SetArgument(2, x_buffer());
+    SetScalarArgument(kernel, 1, alpha);
+    kernel.SetArgument(3, x_buffer());
   }
   else {
     kernel.SetArgument(0, static_cast<int>(n));
-    kernel.SetArgument(1, GetRealArg(alpha));
-    kernel.SetArgument(2, x_buffer());
-    kernel.SetArgument(3, static_cast<int>(x_offset));
-    kernel.SetArgument(4, static_cast<int>(x_inc));
+    SetScalarArgument(kernel, 1, alpha);
+    kernel.SetArgument(3, x_buffer());
+    kernel.SetArgument(4, static_cast<int>(x_offset));
+    kernel.SetArgument(5, static_cast<int>(x_inc));
   }
 
   // Launches the kernel
@@ -25,10 +25,11 @@ class Xscal: public Routine {
  public:
 
   // Constructor
-  Xscal(Queue &queue, EventPointer event, const std::string &name = "SCAL");
+  Xscal(Queue &queue, EventPointer event, const std::string &name = "SCAL",
+        const bool device_scalars = false);
 
   // Templated-precision implementation of the routine
-  void DoScal(const size_t n, const T alpha,
+  void DoScal(const size_t n, const Scalar<T> &alpha,
               const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc);
 };
 
@@ -42,17 +42,15 @@ void Xgbmv<T>::DoGbmv(const Layout layout, const Transpose a_transpose,
   auto kl_real = (rotated) ? ku : kl;
   auto ku_real = (rotated) ? kl : ku;
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific hermitian matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_GBMV define.
-  bool fast_kernels = false;
-  MatVec(layout, a_transpose,
-         m, n, alpha,
-         a_buffer, a_offset, a_ld,
-         x_buffer, x_offset, x_inc, beta,
-         y_buffer, y_offset, y_inc,
-         fast_kernels, fast_kernels,
-         0, false, kl_real, ku_real);
+  // Runs the banded matrix-vector multiplication, iterating only over the 'kl' diagonals below and
+  // the 'ku' diagonals above the main diagonal. The specific banded matrix-accesses are implemented
+  // in the kernel guarded by the ROUTINE_GBMV define.
+  BandMatVec(layout, a_transpose,
+             m, n, alpha,
+             a_buffer, a_offset, a_ld,
+             x_buffer, x_offset, x_inc, beta,
+             y_buffer, y_offset, y_inc,
+             0, kl_real, ku_real, kl_real, ku_real);
 }
 
 // =================================================================================================
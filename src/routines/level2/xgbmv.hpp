@@ -27,7 +27,7 @@ class Xgbmv: public Xgemv<T> {
  public:
 
   // Uses the generic matrix-vector routine
-  using Xgemv<T>::MatVec;
+  using Xgemv<T>::BandMatVec;
 
   // Constructor
   Xgbmv(Queue &queue, EventPointer event, const std::string &name = "GBMV");
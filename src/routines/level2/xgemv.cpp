@@ -13,6 +13,7 @@
 
 #include "routines/level2/xgemv.hpp"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -21,12 +22,16 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xgemv<T>::Xgemv(Queue &queue, EventPointer event, const std::string &name):
-    Routine(queue, event, name, {"Xgemv", "XgemvFast", "XgemvFastRot", "TrsvRoutine"}, PrecisionValue<T>(), {}, {
+Xgemv<T>::Xgemv(Queue &queue, EventPointer event, const std::string &name,
+                const bool device_scalars):
+    Routine(queue, event, name, {"Xgemv", "XgemvFast", "XgemvFastRot", "Xgbmv", "Xtrmv", "Xsymv", "TrmvInPlace", "TrsvRoutine", "TrsvSingleLaunch"}, PrecisionValue<T>(), {}, {
     #include "../../kernels/level2/xgemv.opencl"
     #include "../../kernels/level2/xgemv_fast.opencl"
+    #include "../../kernels/level2/xgbmv.opencl"
+    #include "../../kernels/level2/xtrmv.opencl"
+    #include "../../kernels/level2/xsymv.opencl"
     #include "../../kernels/level2/xtrsv.opencl"
-    }) {
+    }, device_scalars) {
 }
 
 // =================================================================================================
@@ -35,10 +40,10 @@ Xgemv<T>::Xgemv(Queue &queue, EventPointer event, const std::string &name):
 template <typename T>
 void Xgemv<T>::DoGemv(const Layout layout, const Transpose a_transpose,
                       const size_t m, const size_t n,
-                      const T alpha,
+                      const Scalar<T> &alpha,
                       const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                       const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
-                      const T beta,
+                      const Scalar<T> &beta,
                       const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc) {
 
   // Performs the matrix-vector multiplication
@@ -57,10 +62,10 @@ void Xgemv<T>::DoGemv(const Layout layout, const Transpose a_transpose,
 template <typename T>
 void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
                       const size_t m, const size_t n,
-                      const T alpha,
+                      const Scalar<T> &alpha,
                       const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                       const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
-                      const T beta,
+                      const Scalar<T> &beta,
                       const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
                       bool fast_kernel, bool fast_kernel_rot,
                       const size_t parameter, const bool packed,
@@ -128,22 +133,22 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(m_real));
   kernel.SetArgument(1, static_cast<int>(n_real));
-  kernel.SetArgument(2, GetRealArg(alpha));
-  kernel.SetArgument(3, GetRealArg(beta));
-  kernel.SetArgument(4, static_cast<int>(a_rotated));
-  kernel.SetArgument(5, a_buffer());
-  kernel.SetArgument(6, static_cast<int>(a_offset));
-  kernel.SetArgument(7, static_cast<int>(a_ld));
-  kernel.SetArgument(8, x_buffer());
-  kernel.SetArgument(9, static_cast<int>(x_offset));
-  kernel.SetArgument(10, static_cast<int>(x_inc));
-  kernel.SetArgument(11, y_buffer());
-  kernel.SetArgument(12, static_cast<int>(y_offset));
-  kernel.SetArgument(13, static_cast<int>(y_inc));
-  kernel.SetArgument(14, static_cast<int>(a_conjugate));
-  kernel.SetArgument(15, static_cast<int>(parameter)); // extra parameter used for symm/herm
-  kernel.SetArgument(16, static_cast<int>(kl)); // only used for banded matrices
-  kernel.SetArgument(17, static_cast<int>(ku)); // only used for banded matrices
+  SetScalarArgument(kernel, 2, alpha);
+  SetScalarArgument(kernel, 4, beta);
+  kernel.SetArgument(6, static_cast<int>(a_rotated));
+  kernel.SetArgument(7, a_buffer());
+  kernel.SetArgument(8, static_cast<int>(a_offset));
+  kernel.SetArgument(9, static_cast<int>(a_ld));
+  kernel.SetArgument(10, x_buffer());
+  kernel.SetArgument(11, static_cast<int>(x_offset));
+  kernel.SetArgument(12, static_cast<int>(x_inc));
+  kernel.SetArgument(13, y_buffer());
+  kernel.SetArgument(14, static_cast<int>(y_offset));
+  kernel.SetArgument(15, static_cast<int>(y_inc));
+  kernel.SetArgument(16, static_cast<int>(a_conjugate));
+  kernel.SetArgument(17, static_cast<int>(parameter)); // extra parameter used for symm/herm
+  kernel.SetArgument(18, static_cast<int>(kl)); // only used for banded matrices
+  kernel.SetArgument(19, static_cast<int>(ku)); // only used for banded matrices
 
   // Launches the kernel
   auto global = std::vector<size_t>{global_size};
@@ -153,6 +158,241 @@ void Xgemv<T>::MatVec(const Layout layout, const Transpose a_transpose,
 
 // =================================================================================================
 
+// The implementation for banded matrices (general, symmetric, hermitian and triangular)
+template <typename T>
+void Xgemv<T>::BandMatVec(const Layout layout, const Transpose a_transpose,
+                          const size_t m, const size_t n,
+                          const Scalar<T> &alpha,
+                          const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                          const Scalar<T> &beta,
+                          const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                          const size_t parameter, const size_t kl, const size_t ku,
+                          const size_t band_lower, const size_t band_upper) {
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Computes whether or not the matrix has an alternative layout (row or column-major). The band
+  // storage has 'kl+ku+1' rows.
+  const auto a_altlayout = (layout == Layout::kRowMajor);
+  const auto a_one = kl + ku + 1;
+  const auto a_two = (a_altlayout) ? m : n;
+
+  // Swap m and n if the matrix is transposed
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto m_real = (a_transposed) ? n : m;
+  const auto n_real = (a_transposed) ? m : n;
+
+  // Determines whether the kernel needs to perform rotated access ('^' is the XOR operator)
+  const auto a_rotated = a_transposed ^ a_altlayout;
+
+  // In case of complex data-types, the transpose can also become a conjugate transpose
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+
+  // The band of the matrix as seen by the kernel: lower and upper swap in case of rotated access
+  const auto band_lower_real = (a_rotated) ? band_upper : band_lower;
+  const auto band_upper_real = (a_rotated) ? band_lower : band_upper;
+
+  // Tests the matrix and the vectors for validity
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestVectorX(n_real, x_buffer, x_offset, x_inc);
+  TestVectorY(m_real, y_buffer, y_offset, y_inc);
+
+  // Retrieves the Xgbmv kernel from the compiled binary
+  auto kernel = Kernel(program_, "Xgbmv");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(m_real));
+  kernel.SetArgument(1, static_cast<int>(n_real));
+  SetScalarArgument(kernel, 2, alpha);
+  SetScalarArgument(kernel, 4, beta);
+  kernel.SetArgument(6, static_cast<int>(a_rotated));
+  kernel.SetArgument(7, a_buffer());
+  kernel.SetArgument(8, static_cast<int>(a_offset));
+  kernel.SetArgument(9, static_cast<int>(a_ld));
+  kernel.SetArgument(10, x_buffer());
+  kernel.SetArgument(11, static_cast<int>(x_offset));
+  kernel.SetArgument(12, static_cast<int>(x_inc));
+  kernel.SetArgument(13, y_buffer());
+  kernel.SetArgument(14, static_cast<int>(y_offset));
+  kernel.SetArgument(15, static_cast<int>(y_inc));
+  kernel.SetArgument(16, static_cast<int>(a_conjugate));
+  kernel.SetArgument(17, static_cast<int>(parameter)); // extra parameter used for symm/herm/trmv
+  kernel.SetArgument(18, static_cast<int>(kl));
+  kernel.SetArgument(19, static_cast<int>(ku));
+  kernel.SetArgument(20, static_cast<int>(band_lower_real));
+  kernel.SetArgument(21, static_cast<int>(band_upper_real));
+
+  // Launches the kernel
+  const auto m_ceiled = Ceil(m_real, db_["WGS5"]*db_["WPT5"]);
+  auto global = std::vector<size_t>{m_ceiled / db_["WPT5"]};
+  auto local = std::vector<size_t>{db_["WGS5"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// The implementation for matrices stored as a triangle (TRMV, TBMV, TPMV, SPMV and HPMV)
+template <typename T>
+void Xgemv<T>::TriangleMatVec(const Layout layout, const Transpose a_transpose,
+                              const size_t n,
+                              const Scalar<T> &alpha,
+                              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                              const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                              const Scalar<T> &beta,
+                              const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                              const size_t parameter, const bool packed, const bool banded,
+                              const size_t k, const bool in_place) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Determines whether the kernel needs to perform rotated access ('^' is the XOR operator)
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto a_rotated = a_transposed ^ (layout == Layout::kRowMajor);
+
+  // In case of complex data-types, the transpose can also become a conjugate transpose
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+
+  // Tests the matrix and the vectors for validity
+  if (packed) { TestMatrixAP(n, a_buffer, a_offset); }
+  else { TestMatrixA((banded) ? k + 1 : n, n, a_buffer, a_offset, a_ld); }
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  if (!in_place) { TestVectorY(n, y_buffer, y_offset, y_inc); }
+
+  // The part of the rows within the triangle or band as seen by the kernel: a triangular matrix
+  // is upper-triangular in case of an odd parameter. Lower and upper swap for rotated access.
+  const auto extent = (banded) ? k : n;
+  const auto is_upper = (parameter % 2 == 1);
+  const auto band_lower = (in_place && is_upper) ? size_t{0} : extent;
+  const auto band_upper = (in_place && !is_upper) ? size_t{0} : extent;
+  const auto band_lower_real = (a_rotated) ? band_upper : band_lower;
+  const auto band_upper_real = (a_rotated) ? band_lower : band_upper;
+
+  // Retrieves the Xtrmv kernel from the compiled binary
+  auto kernel = Kernel(program_, "Xtrmv");
+
+  // Sets the kernel arguments. In case of in-place computation, the output vector is X as well.
+  kernel.SetArgument(0, static_cast<int>(n));
+  SetScalarArgument(kernel, 1, alpha);
+  SetScalarArgument(kernel, 3, beta);
+  kernel.SetArgument(5, static_cast<int>(a_rotated));
+  kernel.SetArgument(6, a_buffer());
+  kernel.SetArgument(7, static_cast<int>(a_offset));
+  kernel.SetArgument(8, static_cast<int>(a_ld));
+  kernel.SetArgument(9, x_buffer());
+  kernel.SetArgument(10, static_cast<int>(x_offset));
+  kernel.SetArgument(11, static_cast<int>(x_inc));
+  kernel.SetArgument(12, (in_place) ? x_buffer() : y_buffer());
+  kernel.SetArgument(13, static_cast<int>((in_place) ? x_offset : y_offset));
+  kernel.SetArgument(14, static_cast<int>((in_place) ? x_inc : y_inc));
+  kernel.SetArgument(15, static_cast<int>(a_conjugate));
+  kernel.SetArgument(16, static_cast<int>(parameter)); // extra parameter used for symm/herm/trmv
+  kernel.SetArgument(17, static_cast<int>((banded) ? k : 0)); // only used for banded matrices
+  kernel.SetArgument(18, 0); // only used for banded matrices
+  kernel.SetArgument(19, static_cast<int>(band_lower_real));
+  kernel.SetArgument(20, static_cast<int>(band_upper_real));
+
+  // Launches the kernel: one work-group per block of rows
+  const auto num_blocks = CeilDiv(n, db_["WGS6"]*db_["WPT6"]);
+  const auto global = std::vector<size_t>{num_blocks * db_["WGS6"]};
+  const auto local = std::vector<size_t>{db_["WGS6"]};
+  if (!in_place) {
+    kernel.SetArgument(21, 0);
+    kernel.SetArgument(22, x_buffer()); // not used
+    RunKernel(kernel, queue_, device_, global, local, event_);
+    return;
+  }
+
+  // Without support for in-place computation, the kernel reads from a copy of X instead. This is
+  // also the case for out-of-order queues, on which the shared ticket counters could be re-used by
+  // another call while the kernel is still running.
+  if (db_["TRMV_IN_PLACE"] == 0 || queue_.IsOutOfOrder()) {
+    const auto x_size = n*x_inc + x_offset;
+    auto scratch_buffer = Buffer<T>(context_, x_size);
+    x_buffer.CopyTo(queue_, x_size, scratch_buffer);
+    kernel.SetArgument(9, scratch_buffer());
+    kernel.SetArgument(21, 0);
+    kernel.SetArgument(22, scratch_buffer()); // not used
+    RunKernel(kernel, queue_, device_, global, local, event_);
+    return;
+  }
+
+  // Computes the result in-place. The ticket counters are kept zeroed by the kernel itself.
+  auto flags_buffer = GetSyncBuffer(queue_, context_, "Xtrmv", 2);
+  kernel.SetArgument(21, 1);
+  kernel.SetArgument(22, flags_buffer());
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// The implementation for symmetric and hermitian matrices (SYMV and HEMV)
+template <typename T>
+void Xgemv<T>::SymMatVec(const Layout layout,
+                         const size_t n,
+                         const Scalar<T> &alpha,
+                         const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                         const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                         const Scalar<T> &beta,
+                         const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                         const size_t parameter) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // In case of row-major layout the kernel computes with the transpose of the stored matrix, which
+  // is only different for hermitian matrices
+  const auto a_rotated = (layout == Layout::kRowMajor);
+
+  // Tests the matrix and the vectors for validity
+  TestMatrixA(n, n, a_buffer, a_offset, a_ld);
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorY(n, y_buffer, y_offset, y_inc);
+
+  // Temporary buffer for the partial results: a vector for each work-group. The number of
+  // work-groups is limited, such that the size of this buffer grows only linearly with 'n'.
+  const auto tile_size = db_["WGS7"]*db_["WPT7"];
+  const auto num_tiles = CeilDiv(n, tile_size);
+  const auto num_groups = std::min(num_tiles, size_t{128});
+  auto work_buffer = Buffer<T>(context_, num_groups * num_tiles * tile_size);
+
+  // Computes the partial results, each work-group processing a set of tile rows of the matrix
+  auto kernel = Kernel(program_, "Xsymv");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, static_cast<int>(a_rotated));
+  kernel.SetArgument(2, a_buffer());
+  kernel.SetArgument(3, static_cast<int>(a_offset));
+  kernel.SetArgument(4, static_cast<int>(a_ld));
+  kernel.SetArgument(5, x_buffer());
+  kernel.SetArgument(6, static_cast<int>(x_offset));
+  kernel.SetArgument(7, static_cast<int>(x_inc));
+  kernel.SetArgument(8, work_buffer());
+  kernel.SetArgument(9, static_cast<int>(parameter));
+  const auto global = std::vector<size_t>{num_groups * db_["WGS7"]};
+  const auto local = std::vector<size_t>{db_["WGS7"]};
+  auto kernel_event = Event();
+  RunKernel(kernel, queue_, device_, global, local, kernel_event.pointer());
+
+  // Sums the partial results and computes the final result
+  auto reduce_kernel = Kernel(program_, "XsymvReduce");
+  reduce_kernel.SetArgument(0, static_cast<int>(n));
+  reduce_kernel.SetArgument(1, static_cast<int>(num_groups));
+  SetScalarArgument(reduce_kernel, 2, alpha);
+  SetScalarArgument(reduce_kernel, 4, beta);
+  reduce_kernel.SetArgument(6, work_buffer());
+  reduce_kernel.SetArgument(7, y_buffer());
+  reduce_kernel.SetArgument(8, static_cast<int>(y_offset));
+  reduce_kernel.SetArgument(9, static_cast<int>(y_inc));
+  const auto global_reduce = std::vector<size_t>{num_tiles * db_["WGS7"]};
+  const auto local_reduce = std::vector<size_t>{db_["WGS7"]};
+  auto eventWaitList = std::vector<Event>{kernel_event};
+  RunKernel(reduce_kernel, queue_, device_, global_reduce, local_reduce, event_, eventWaitList);
+}
+
+// =================================================================================================
+
 // Compiles the templated class
 template class Xgemv<half>;
 template class Xgemv<float>;
@@ -25,28 +25,66 @@ class Xgemv: public Routine {
  public:
 
   // Constructor
-  Xgemv(Queue &queue, EventPointer event, const std::string &name = "GEMV");
+  Xgemv(Queue &queue, EventPointer event, const std::string &name = "GEMV",
+        const bool device_scalars = false);
 
   // Templated-precision implementation of the routine
   void DoGemv(const Layout layout, const Transpose a_transpose,
               const size_t m, const size_t n,
-              const T alpha,
+              const Scalar<T> &alpha,
               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
               const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
-              const T beta,
+              const Scalar<T> &beta,
               const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc);
 
   // Generic version used also for other matrix-vector multiplications
   void MatVec(const Layout layout, const Transpose a_transpose,
               const size_t m, const size_t n,
-              const T alpha,
+              const Scalar<T> &alpha,
               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
               const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
-              const T beta,
+              const Scalar<T> &beta,
               const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
               bool fast_kernel, bool fast_kernel_rot,
               const size_t parameter, const bool packed,
               const size_t kl, const size_t ku);
+
+  // Version for banded matrices, only iterating over the band of the matrix. The 'band_lower' and
+  // 'band_upper' arguments give the number of possibly non-zero diagonals below and above the main
+  // diagonal of the (non-transposed) matrix as stored in column-major, the format of the kernel.
+  void BandMatVec(const Layout layout, const Transpose a_transpose,
+                  const size_t m, const size_t n,
+                  const Scalar<T> &alpha,
+                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                  const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                  const Scalar<T> &beta,
+                  const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                  const size_t parameter, const size_t kl, const size_t ku,
+                  const size_t band_lower, const size_t band_upper);
+
+  // Version for square matrices stored as a triangle: triangular (optionally banded or packed) and
+  // symmetric/hermitian packed matrices. In case of 'in_place' the matrix is triangular and the
+  // result is stored in the vector X, such that the vector Y is not used.
+  void TriangleMatVec(const Layout layout, const Transpose a_transpose,
+                      const size_t n,
+                      const Scalar<T> &alpha,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                      const Scalar<T> &beta,
+                      const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                      const size_t parameter, const bool packed, const bool banded,
+                      const size_t k, const bool in_place);
+
+  // Version for symmetric/hermitian matrices, reading only the stored triangle: 'parameter' is 1
+  // in case the matrix is stored as the upper triangle (as seen in column-major layout)
+  void SymMatVec(const Layout layout,
+                 const size_t n,
+                 const Scalar<T> &alpha,
+                 const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                 const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                 const Scalar<T> &beta,
+                 const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                 const size_t parameter);
 };
 
 // =================================================================================================
@@ -41,17 +41,15 @@ void Xhbmv<T>::DoHbmv(const Layout layout, const Triangle triangle,
   size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                      (triangle == Triangle::kLower && layout == Layout::kRowMajor));
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific hermitian banded matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_HBMV define.
-  bool fast_kernels = false;
-  MatVec(layout, Transpose::kNo,
-         n, n, alpha,
-         a_buffer, a_offset, a_ld,
-         x_buffer, x_offset, x_inc, beta,
-         y_buffer, y_offset, y_inc,
-         fast_kernels, fast_kernels,
-         is_upper, false, k, 0);
+  // Runs the banded matrix-vector multiplication, iterating only over the 'k' diagonals on both
+  // sides of the main diagonal. The specific hermitian banded matrix-accesses are implemented in
+  // the kernel guarded by the ROUTINE_HBMV define.
+  BandMatVec(layout, Transpose::kNo,
+             n, n, alpha,
+             a_buffer, a_offset, a_ld,
+             x_buffer, x_offset, x_inc, beta,
+             y_buffer, y_offset, y_inc,
+             is_upper, k, 0, k, k);
 }
 
 // =================================================================================================
@@ -27,7 +27,7 @@ class Xhbmv: public Xgemv<T> {
  public:
 
   // Uses the generic matrix-vector routine
-  using Xgemv<T>::MatVec;
+  using Xgemv<T>::BandMatVec;
 
   // Constructor
   Xhbmv(Queue &queue, EventPointer event, const std::string &name = "HBMV");
@@ -9,7 +9,7 @@
 //
 // This file implements the Xhemv routine. It is based on the generalized mat-vec multiplication
 // routine (Xgemv). The Xhemv class inherits from the templated class Xgemv, allowing it to call the
-// "MatVec" function directly.
+// "SymMatVec" function directly.
 //
 // =================================================================================================
 
@@ -27,7 +27,7 @@ class Xhemv: public Xgemv<T> {
  public:
 
   // Uses the generic matrix-vector routine
-  using Xgemv<T>::MatVec;
+  using Xgemv<T>::SymMatVec;
 
   // Constructor
   Xhemv(Queue &queue, EventPointer event, const std::string &name = "HEMV");
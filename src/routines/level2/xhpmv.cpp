@@ -41,17 +41,15 @@ void Xhpmv<T>::DoHpmv(const Layout layout, const Triangle triangle,
   size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                      (triangle == Triangle::kLower && layout == Layout::kRowMajor));
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific hermitian packed matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_HPMV define.
-  bool fast_kernels = false;
-  MatVec(layout, Transpose::kNo,
-         n, n, alpha,
-         ap_buffer, ap_offset, n,
-         x_buffer, x_offset, x_inc, beta,
-         y_buffer, y_offset, y_inc,
-         fast_kernels, fast_kernels,
-         is_upper, true, 0, 0);
+  // Runs the matrix-vector multiplication for matrices stored as a triangle. The specific
+  // hermitian packed matrix-accesses are implemented in the kernel guarded by the ROUTINE_HPMV
+  // define.
+  TriangleMatVec(layout, Transpose::kNo,
+                 n, alpha,
+                 ap_buffer, ap_offset, n,
+                 x_buffer, x_offset, x_inc, beta,
+                 y_buffer, y_offset, y_inc,
+                 is_upper, true, false, 0, false);
 }
 
 // =================================================================================================
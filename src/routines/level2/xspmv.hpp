@@ -27,7 +27,7 @@ class Xspmv: public Xgemv<T> {
  public:
 
   // Uses the generic matrix-vector routine
-  using Xgemv<T>::MatVec;
+  using Xgemv<T>::TriangleMatVec;
 
   // Constructor
   Xspmv(Queue &queue, EventPointer event, const std::string &name = "SPMV");
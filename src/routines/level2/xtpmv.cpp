@@ -35,10 +35,6 @@ void Xtpmv<T>::DoTpmv(const Layout layout, const Triangle triangle,
                       const Buffer<T> &ap_buffer, const size_t ap_offset,
                       const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
 
-  // Creates a copy of X: a temporary scratch buffer
-  auto scratch_buffer = Buffer<T>(context_, n*x_inc + x_offset);
-  x_buffer.CopyTo(queue_, n*x_inc + x_offset, scratch_buffer);
-
   // The data is either in the upper or lower triangle
   size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                      (triangle == Triangle::kLower && layout == Layout::kRowMajor));
@@ -46,27 +42,15 @@ void Xtpmv<T>::DoTpmv(const Layout layout, const Triangle triangle,
   // Adds '2' to the parameter if the diagonal is unit
   auto parameter = (diagonal == Diagonal::kUnit) ? is_upper + 2 : is_upper;
 
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific triangular packed matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_TPMV define.
-  auto fast_kernels = false;
-  try {
-    MatVec(layout, a_transpose,
-           n, n, ConstantOne<T>(),
-           ap_buffer, ap_offset, n,
-           scratch_buffer, x_offset, x_inc, ConstantZero<T>(),
-           x_buffer, x_offset, x_inc,
-           fast_kernels, fast_kernels,
-           parameter, true, 0, 0);
-  } catch (BLASError &e) {
-    // Returns the proper error code (renames vector Y to X)
-    switch (e.status()) {
-      case StatusCode::kInvalidVectorY:      throw BLASError(StatusCode::kInvalidVectorX, e.details());
-      case StatusCode::kInvalidIncrementY:   throw BLASError(StatusCode::kInvalidIncrementX, e.details());
-      case StatusCode::kInsufficientMemoryY: throw BLASError(StatusCode::kInsufficientMemoryX, e.details());
-      default:                               throw;
-    }
-  }
+  // Runs the triangular matrix-vector multiplication in-place in X, iterating only over the
+  // stored triangle. The specific triangular packed matrix-accesses are implemented in the kernel
+  // guarded by the ROUTINE_TPMV define.
+  TriangleMatVec(layout, a_transpose,
+                 n, ConstantOne<T>(),
+                 ap_buffer, ap_offset, n,
+                 x_buffer, x_offset, x_inc, ConstantZero<T>(),
+                 x_buffer, x_offset, x_inc,
+                 parameter, true, false, 0, true);
 }
 
 // =================================================================================================
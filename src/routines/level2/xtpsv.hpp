@@ -0,0 +1,47 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtpsv routine. It is based on the triangular solver (Xtrsv) and reuses
+// its substitution kernels with packed indexing. The off-diagonal blocks are updated by a kernel
+// reading the packed triangle directly, such that the matrix never needs to be unpacked.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTPSV_H_
+#define CLBLAST_ROUTINES_XTPSV_H_
+
+#include "routines/level2/xtrsv.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xtpsv: public Xtrsv<T> {
+ public:
+
+  // Uses the triangular solver
+  using Xtrsv<T>::BandedSolve;
+
+  // Constructor
+  Xtpsv(Queue &queue, EventPointer event, const std::string &name = "TPSV");
+
+  // Templated-precision implementation of the routine
+  void DoTpsv(const Layout layout, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n,
+              const Buffer<T> &ap_buffer, const size_t ap_offset,
+              const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XTPSV_H_
+#endif
@@ -27,9 +27,7 @@ class Xtrmv: public Xgemv<T> {
  public:
 
   // Uses the generic matrix-vector routine
-  using Xgemv<T>::queue_;
-  using Xgemv<T>::context_;
-  using Xgemv<T>::MatVec;
+  using Xgemv<T>::TriangleMatVec;
 
   // Constructor
   Xtrmv(Queue &queue, EventPointer event, const std::string &name = "TRMV");
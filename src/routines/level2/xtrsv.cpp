@@ -13,6 +13,7 @@
 
 #include "routines/level2/xtrsv.hpp"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -30,11 +31,12 @@ Xtrsv<T>::Xtrsv(Queue &queue, EventPointer event, const std::string &name):
 template <typename T>
 void Xtrsv<T>::Substitution(const Layout layout, const Triangle triangle,
                             const Transpose a_transpose, const Diagonal diagonal,
-                            const size_t n,
+                            const size_t n, const size_t block_start,
                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const size_t a_n, const size_t k,
                             const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_inc,
                             const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
-                            EventPointer event) {
+                            EventPointer event, const std::vector<Event> &waitForEvents) {
 
   if (n > db_["TRSV_BLOCK_SIZE"]) { throw BLASError(StatusCode::kUnexpectedError); };
 
@@ -47,6 +49,8 @@ void Xtrsv<T>::Substitution(const Layout layout, const Triangle triangle,
   // The data is either in the upper or lower triangle
   const auto is_upper = ((triangle == Triangle::kUpper && a_transpose == Transpose::kNo) ||
                          (triangle == Triangle::kLower && a_transpose != Transpose::kNo));
+  const auto is_upper_storage = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
+                                 (triangle == Triangle::kLower && layout == Layout::kRowMajor));
 
   // Retrieves the kernel from the compiled binary
   const auto kernel_name = (is_upper) ? "trsv_backward" : "trsv_forward";
@@ -66,11 +70,170 @@ void Xtrsv<T>::Substitution(const Layout layout, const Triangle triangle,
   kernel.SetArgument(10, static_cast<int>(is_transposed));
   kernel.SetArgument(11, static_cast<int>(is_unit_diagonal));
   kernel.SetArgument(12, static_cast<int>(do_conjugate));
+  kernel.SetArgument(13, static_cast<int>(block_start));
+  kernel.SetArgument(14, static_cast<int>(a_n));
+  kernel.SetArgument(15, static_cast<int>(k));
+  kernel.SetArgument(16, static_cast<int>(is_upper_storage));
 
   // Launches the kernel
   const auto local = std::vector<size_t>{db_["TRSV_BLOCK_SIZE"]};
   const auto global = std::vector<size_t>{Ceil(n, db_["TRSV_BLOCK_SIZE"])};
-  RunKernel(kernel, queue_, device_, global, local, event);
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
+}
+
+// =================================================================================================
+
+template <typename T>
+void Xtrsv<T>::BandedUpdate(const Layout layout, const Triangle triangle,
+                            const Transpose a_transpose,
+                            const size_t n, const size_t row_start,
+                            const size_t col_start, const size_t num_cols,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const size_t a_n, const size_t k,
+                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                            EventPointer event, const std::vector<Event> &waitForEvents) {
+
+  // Translates CLBlast arguments to 0/1 integers for the OpenCL kernel
+  const auto is_transposed = ((a_transpose == Transpose::kNo && layout == Layout::kColMajor) ||
+                              (a_transpose != Transpose::kNo && layout != Layout::kColMajor)) ? 0 : 1;
+  const auto do_conjugate = (a_transpose == Transpose::kConjugate) ? 1 : 0;
+  const auto is_upper_storage = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
+                                 (triangle == Triangle::kLower && layout == Layout::kRowMajor));
+
+  // Retrieves the kernel from the compiled binary
+  auto kernel = Kernel(program_, "trsv_update");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, static_cast<int>(row_start));
+  kernel.SetArgument(2, static_cast<int>(col_start));
+  kernel.SetArgument(3, static_cast<int>(num_cols));
+  kernel.SetArgument(4, a_buffer());
+  kernel.SetArgument(5, static_cast<int>(a_offset));
+  kernel.SetArgument(6, static_cast<int>(a_ld));
+  kernel.SetArgument(7, static_cast<int>(a_n));
+  kernel.SetArgument(8, static_cast<int>(k));
+  kernel.SetArgument(9, x_buffer());
+  kernel.SetArgument(10, static_cast<int>(x_offset));
+  kernel.SetArgument(11, static_cast<int>(x_inc));
+  kernel.SetArgument(12, static_cast<int>(is_transposed));
+  kernel.SetArgument(13, static_cast<int>(is_upper_storage));
+  kernel.SetArgument(14, static_cast<int>(do_conjugate));
+
+  // Launches the kernel: a single work-group
+  const auto local = std::vector<size_t>{db_["TRSV_BLOCK_SIZE"]};
+  const auto global = std::vector<size_t>{db_["TRSV_BLOCK_SIZE"]};
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
+}
+
+// =================================================================================================
+
+template <typename T>
+void Xtrsv<T>::BandedSolve(const Layout layout, const Triangle triangle,
+                           const Transpose a_transpose, const Diagonal diagonal,
+                           const size_t n, const size_t k,
+                           const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                           const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_inc) {
+
+  // Some parts of this kernel are not tunable and thus require some minimal OpenCL properties
+  if (device_.MaxWorkGroupSize() < 16) { // minimum of total local work size of 16
+    throw RuntimeErrorCode(StatusCode::kNotImplemented);
+  }
+
+  // Creates a copy of B to avoid overwriting input while computing output. The update kernel
+  // overwrites each block of x before its substitution, so no zero-initialisation is needed.
+  const auto x_offset = b_offset;
+  const auto x_inc = b_inc;
+  const auto x_size = n*x_inc + x_offset;
+  auto x_buffer = Buffer<T>(context_, x_size);
+  auto copy_event = Event();
+  b_buffer.CopyToAsync(queue_, x_size, x_buffer, copy_event.pointer());
+
+  // The data is either in the upper or lower triangle
+  const auto is_upper = ((triangle == Triangle::kUpper && a_transpose == Transpose::kNo) ||
+                         (triangle == Triangle::kLower && a_transpose != Transpose::kNo));
+
+  // Loops over the blocks, chaining the kernels through events instead of waiting on the host
+  auto events = std::vector<Event>{copy_event};
+  for (auto i = size_t{0}; i < n; i += db_["TRSV_BLOCK_SIZE"]) {
+    const auto block_size = std::min(db_["TRSV_BLOCK_SIZE"], n - i);
+    const auto col = (is_upper) ? n - i - block_size : i;
+
+    // The solved columns which are within the band of this block: below it in the upper case and
+    // above it in the lower case
+    const auto col_start = (is_upper) ? col + block_size : ((col > k) ? col - k : 0);
+    const auto col_end = (is_upper) ? std::min(n, col + block_size + k) : col;
+
+    // Computes the band-limited product with the solved part of x
+    auto update_event = Event();
+    BandedUpdate(layout, triangle, a_transpose, block_size, col, col_start, col_end - col_start,
+                 a_buffer, a_offset, a_ld, n, k,
+                 x_buffer, x_offset, x_inc, update_event.pointer(), events);
+
+    // Runs the triangular substitution for the block size
+    auto sub_event = Event();
+    Substitution(layout, triangle, a_transpose, diagonal, block_size, col,
+                 a_buffer, a_offset, a_ld, n, k,
+                 b_buffer, b_offset + col*b_inc, b_inc,
+                 x_buffer, x_offset + col*x_inc, x_inc, sub_event.pointer(), {update_event});
+    events = {sub_event};
+  }
+
+  // Retrieves the results
+  x_buffer.CopyToAsync(queue_, x_size, b_buffer, event_, events);
+}
+
+// =================================================================================================
+
+template <typename T>
+void Xtrsv<T>::SingleLaunchSolve(const Layout layout, const Triangle triangle,
+                                 const Transpose a_transpose, const Diagonal diagonal,
+                                 const size_t n,
+                                 const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                                 const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_inc) {
+
+  // Translates CLBlast arguments to 0/1 integers for the OpenCL kernel
+  const auto is_unit_diagonal = (diagonal == Diagonal::kNonUnit) ? 0 : 1;
+  const auto is_transposed = ((a_transpose == Transpose::kNo && layout == Layout::kColMajor) ||
+                              (a_transpose != Transpose::kNo && layout != Layout::kColMajor)) ? 0 : 1;
+  const auto do_conjugate = (a_transpose == Transpose::kConjugate) ? 1 : 0;
+  const auto is_upper = ((triangle == Triangle::kUpper && a_transpose == Transpose::kNo) ||
+                         (triangle == Triangle::kLower && a_transpose != Transpose::kNo)) ? 1 : 0;
+
+  // Temporary buffer with the ticket counter and a flag per block, cleared by a separate kernel
+  const auto block_size = db_["TRSV_BLOCK_SIZE"];
+  const auto num_blocks = CeilDiv(n, block_size);
+  const auto num_flags = num_blocks + 1;
+  auto flags_buffer = Buffer<int>(context_, num_flags);
+  auto init_kernel = Kernel(program_, "trsv_single_launch_init");
+  init_kernel.SetArgument(0, static_cast<int>(num_flags));
+  init_kernel.SetArgument(1, flags_buffer());
+  auto init_event = Event();
+  const auto local = std::vector<size_t>{block_size};
+  const auto global_init = std::vector<size_t>{Ceil(num_flags, block_size)};
+  RunKernel(init_kernel, queue_, device_, global_init, local, init_event.pointer());
+
+  // Retrieves the kernel from the compiled binary
+  auto kernel = Kernel(program_, "trsv_single_launch");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, a_buffer());
+  kernel.SetArgument(2, static_cast<int>(a_offset));
+  kernel.SetArgument(3, static_cast<int>(a_ld));
+  kernel.SetArgument(4, b_buffer());
+  kernel.SetArgument(5, static_cast<int>(b_offset));
+  kernel.SetArgument(6, static_cast<int>(b_inc));
+  kernel.SetArgument(7, static_cast<int>(is_upper));
+  kernel.SetArgument(8, static_cast<int>(is_transposed));
+  kernel.SetArgument(9, static_cast<int>(is_unit_diagonal));
+  kernel.SetArgument(10, static_cast<int>(do_conjugate));
+  kernel.SetArgument(11, flags_buffer());
+
+  // Launches the kernel: one work-group per block
+  auto eventWaitList = std::vector<Event>{init_event};
+  const auto global = std::vector<size_t>{num_blocks * block_size};
+  RunKernel(kernel, queue_, device_, global, local, event_, eventWaitList);
 }
 
 // =================================================================================================
@@ -95,6 +258,13 @@ void Xtrsv<T>::DoTrsv(const Layout layout, const Triangle triangle,
   TestMatrixA(n, n, a_buffer, a_offset, a_ld);
   TestVectorX(n, b_buffer, b_offset, b_inc);
 
+  // Solves the system in a single launch: block dependencies are resolved on the device
+  if (db_["TRSV_SINGLE_LAUNCH"] == 1) {
+    SingleLaunchSolve(layout, triangle, a_transpose, diagonal, n,
+                      a_buffer, a_offset, a_ld, b_buffer, b_offset, b_inc);
+    return;
+  }
+
   // Creates a copy of B to avoid overwriting input while computing output
   // TODO: Make x with 0 offset and unit increment by creating custom copy-to and copy-from kernels
   const auto x_offset = b_offset;
@@ -146,8 +316,8 @@ void Xtrsv<T>::DoTrsv(const Layout layout, const Triangle triangle,
 
     // Runs the triangular substitution for the block size
     auto sub_event = Event();
-    Substitution(layout, triangle, a_transpose, diagonal, block_size,
-                 a_buffer, a_offset + col + col*a_ld, a_ld,
+    Substitution(layout, triangle, a_transpose, diagonal, block_size, col,
+                 a_buffer, a_offset, a_ld, n, 0,
                  b_buffer, b_offset + col*b_inc, b_inc,
                  x_buffer, x_offset + col*x_inc, x_inc, sub_event.pointer());
     sub_event.WaitForCompletion();
@@ -9,13 +9,16 @@
 //
 // This file implements the Xtrsv routine. It uses a block-algorithm and performs small triangular
 // forward and backward substitutions on the diagonal parts of the matrix in combination with larger
-// GEMV computation on the remainder of the matrix.
+// GEMV computation on the remainder of the matrix. The banded and packed variants (TBSV and TPSV)
+// reuse the substitution kernels but update the blocks with a band-limited matrix-vector product.
 //
 // =================================================================================================
 
 #ifndef CLBLAST_ROUTINES_XTRSV_H_
 #define CLBLAST_ROUTINES_XTRSV_H_
 
+#include <vector>
+
 #include "routines/level2/xgemv.hpp"
 
 namespace clblast {
@@ -45,14 +48,42 @@ class Xtrsv: public Xgemv<T> {
               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
               const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc);
 
-  // Performs forward or backward substitution on a small triangular matrix
+  // Performs forward or backward substitution on the small triangular block of 'n' rows and columns
+  // starting at 'block_start'. The matrix has order 'a_n' and (for banded matrices) 'k' super- or
+  // sub-diagonals. The vector offsets point to the start of the block.
   void Substitution(const Layout layout, const Triangle triangle,
                     const Transpose a_transpose, const Diagonal diagonal,
-                    const size_t n,
+                    const size_t n, const size_t block_start,
                     const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                    const size_t a_n, const size_t k,
                     const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_inc,
                     const Buffer<T> &x_buffer, const size_t offset_x, const size_t x_inc,
-                    EventPointer event);
+                    EventPointer event, const std::vector<Event> &waitForEvents = {});
+
+  // Solves a banded (TBSV) or packed (TPSV) system block by block, overwriting 'b'. Before each
+  // substitution the block is updated with the already solved part, limited to the 'k' columns
+  // within the band (for packed matrices 'k' equals n-1 and 'a_ld' is unused).
+  void BandedSolve(const Layout layout, const Triangle triangle,
+                   const Transpose a_transpose, const Diagonal diagonal,
+                   const size_t n, const size_t k,
+                   const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                   const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_inc);
+
+  // Computes x[rows] = op(A)[rows][cols] * x[cols] for a block of 'n' rows and 'num_cols' columns
+  void BandedUpdate(const Layout layout, const Triangle triangle, const Transpose a_transpose,
+                    const size_t n, const size_t row_start,
+                    const size_t col_start, const size_t num_cols,
+                    const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                    const size_t a_n, const size_t k,
+                    const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                    EventPointer event, const std::vector<Event> &waitForEvents);
+
+  // Solves the full system in a single launch of the substitution kernel, overwriting 'b'
+  void SingleLaunchSolve(const Layout layout, const Triangle triangle,
+                         const Transpose a_transpose, const Diagonal diagonal,
+                         const size_t n,
+                         const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                         const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_inc);
 };
 
 // =================================================================================================
@@ -21,18 +21,16 @@ namespace clblast {
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xgemm<T>::Xgemm(Queue &queue, EventPointer event, const std::string &name):
+Xgemm<T>::Xgemm(Queue &queue, EventPointer event, const std::string &name,
+                const bool device_scalars):
     Routine(queue, event, name,
-            {"Copy","Pad","Transpose","Padtranspose","Xgemm","XgemmDirect","GemmRoutine"},
+            {"Copy","Pad","Transpose","Padtranspose","Xgemm","XgemmDirect","GemmRoutine","Gemm3m"},
             PrecisionValue<T>(), {}, {
     #include "../../kernels/level3/level3.opencl"
     #include "../../kernels/level3/copy_fast.opencl"
     #include "../../kernels/level3/copy_pad.opencl"
     #include "../../kernels/level3/transpose_fast.opencl"
     #include "../../kernels/level3/transpose_pad.opencl"
-    #include "../../kernels/level3/convert_symmetric.opencl"
-    #include "../../kernels/level3/convert_triangular.opencl"
-    #include "../../kernels/level3/convert_hermitian.opencl"
     , // separated in multiple parts to prevent C1091 in MSVC 2013
     #include "../../kernels/level3/xgemm_direct_part1.opencl"
     #include "../../kernels/level3/xgemm_direct_part2.opencl"
@@ -43,7 +41,7 @@ Xgemm<T>::Xgemm(Queue &queue, EventPointer event, const std::string &name):
     , // separated in multiple parts to prevent C1091 in MSVC 2013
     #include "../../kernels/level3/xgemm_part3.opencl"
     #include "../../kernels/level3/xgemm_part4.opencl"
-    }) {
+    }, device_scalars) {
 }
 
 // =================================================================================================
@@ -53,15 +51,20 @@ template <typename T>
 void Xgemm<T>::DoGemm(const Layout layout,
                       const Transpose a_transpose, const Transpose b_transpose,
                       const size_t m, const size_t n, const size_t k,
-                      const T alpha,
+                      const Scalar<T> &alpha,
                       const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                       const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
-                      const T beta,
+                      const Scalar<T> &beta,
                       const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
-                      const Buffer<T> &temp_buffer, const bool temp_buffer_provided) { // optional arguments
-
-  // Two methods to choose from, select which one to run
-  const auto do_gemm_direct = UseDirectKernel(m, n, k, db_["XGEMM_MIN_INDIRECT_SIZE"]);
+                      const Buffer<T> &temp_buffer, const bool temp_buffer_provided, // optional arguments
+                      const bool a_packed, const bool b_packed,
+                      const std::vector<Event> &waitForEvents) {
+
+  // Two methods to choose from, select which one to run. Pre-packed matrices are stored in the
+  // layout of the indirect kernel, so in that case the direct kernel is never used. The same holds
+  // for scalars in device memory, which only the indirect kernel can read.
+  const auto do_gemm_direct = !a_packed && !b_packed && !device_scalars_ &&
+                              UseDirectKernel(m, n, k, db_["XGEMM_MIN_INDIRECT_SIZE"]);
   const auto gemm_kernel_id = (do_gemm_direct) ? 0 : db_["GEMMK"];
 
   // Computes the transpose/conjugate options and sets the a/b/c sizes based on that
@@ -79,16 +82,31 @@ void Xgemm<T>::DoGemm(const Layout layout,
   //    matrix A cannot be less than K when rotated, or less than M when not-rotated
   //    matrix B cannot be less than N when rotated, or less than K when not-rotated
   //    matrix C cannot be less than N when rotated, or less than M when not-rotated
-  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
-  TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
+  // Pre-packed matrices are tested later on, once their internal dimensions are known.
+  if (!a_packed) { TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld); }
+  if (!b_packed) { TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld); }
   TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
 
+  // For large complex matrices, the 3M algorithm saves a quarter of the arithmetic. As it is less
+  // accurate, it is only used when enabled through the database (see 'Use3mAlgorithm'). It requires
+  // its own temporary buffers, so it is not used when the user provides the temporary buffer.
+  if (!temp_buffer_provided && !a_packed && !b_packed && !device_scalars_ &&
+      Use3mAlgorithm(m, n, k, db_["XGEMM_3M_MIN_SIZE"])) {
+    Gemm3m(layout, a_transpose, b_transpose, m, n, k, alpha.Value(),
+           a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta.Value(),
+           c_buffer, c_offset, c_ld,
+           a_one, a_two, a_conjugate, b_one, b_two, b_conjugate, c_one, c_two,
+           waitForEvents);
+    return;
+  }
+
   // Selects which version of GEMM to run
   if (do_gemm_direct) { // for small sizes (single kernel)
-    GemmDirect(m, n, k, alpha,
-               a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+    GemmDirect(m, n, k, alpha.Value(),
+               a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta.Value(),
                c_buffer, c_offset, c_ld,
-               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate);
+               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+               waitForEvents);
   }
   else { // for larger sizes (pre/post-processing plus a very fast kernel)
     GemmIndirect(m, n, k, alpha,
@@ -96,8 +114,144 @@ void Xgemm<T>::DoGemm(const Layout layout,
                  c_buffer, c_offset, c_ld,
                  a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
                  a_one, a_two, b_one, b_two, c_one, c_two,
-                 temp_buffer, temp_buffer_provided);
+                 temp_buffer, temp_buffer_provided, a_packed, b_packed, waitForEvents);
+  }
+}
+
+// =================================================================================================
+
+// Packs matrix A or B once into the padded and (possibly) transposed layout of the indirect kernel.
+// This is the same pre-processing as done in 'GemmIndirect', which can then be skipped for this
+// matrix in subsequent calls to 'DoGemm' as long as the tuning parameters remain the same.
+template <typename T>
+void Xgemm<T>::DoPackMatrix(const Layout layout, const Side side, const Transpose transpose,
+                            const size_t m, const size_t n, const size_t k,
+                            const Buffer<T> &buffer, const size_t offset, const size_t ld,
+                            const Buffer<T> &packed_buffer) {
+  PackMatrix(layout, side, transpose, m, n, k, buffer, offset, ld, packed_buffer, event_);
+}
+
+// As above, but as part of a chain of operations
+template <typename T>
+void Xgemm<T>::PackMatrix(const Layout layout, const Side side, const Transpose transpose,
+                          const size_t m, const size_t n, const size_t k,
+                          const Buffer<T> &buffer, const size_t offset, const size_t ld,
+                          const Buffer<T> &packed_buffer,
+                          EventPointer event, const std::vector<Event> &waitForEvents) {
+  const auto is_a = (side == Side::kLeft);
+
+  // Computes the transpose/conjugate options and sets the sizes based on that. The outer dimension
+  // of the other input matrix is irrelevant here, and is thus set to one.
+  const auto m_used = (is_a) ? m : size_t{1};
+  const auto n_used = (is_a) ? size_t{1} : n;
+  bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
+  size_t a_one, a_two, b_one, b_two, c_one, c_two;
+  ProcessArguments(layout, transpose, transpose, m_used, n_used, k,
+                   a_one, a_two, b_one, b_two, c_one, c_two,
+                   a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                   db_["GEMMK"]);
+
+  // Computes the internal (padded) dimensions of the packed matrix
+  size_t a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i;
+  CalculateInternalDimensions(m_used, n_used, k, db_["MWG"], db_["NWG"], db_["KWG"] * db_["KREG"],
+                              a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i,
+                              db_["GEMMK"]);
+  const auto one = (is_a) ? a_one : b_one;
+  const auto two = (is_a) ? a_two : b_two;
+  const auto one_i = (is_a) ? a_one_i : b_one_i;
+  const auto two_i = (is_a) ? a_two_i : b_two_i;
+
+  // Tests the input and output matrices for validity
+  if (is_a) { TestMatrixA(one, two, buffer, offset, ld); }
+  else { TestMatrixB(one, two, buffer, offset, ld); }
+  if (packed_buffer.GetSize() < one_i * two_i * sizeof(T)) {
+    throw BLASError(StatusCode::kInsufficientMemoryTemp);
   }
+
+  // Runs the pre-processing kernel, padding with zeros and transposing if needed
+  PadCopyTransposeMatrix(queue_, device_, db_, event, waitForEvents,
+                         one, two, ld, offset, buffer,
+                         one_i, two_i, one_i, 0, packed_buffer,
+                         ConstantOne<T>(), program_,
+                         true, (is_a) ? a_do_transpose : b_do_transpose,
+                         (is_a) ? a_conjugate : b_conjugate);
+}
+
+// Packs a squared symmetric, hermitian, or triangular matrix straight from its stored triangle into
+// the layout of the indirect kernel. This replaces first creating a squared copy of the matrix and
+// then padding and transposing that copy in 'GemmIndirect'.
+template <typename T>
+Buffer<T> Xgemm<T>::PackStructuredMatrix(const Layout layout, const Side side,
+                                         const Transpose transpose,
+                                         const size_t m, const size_t n, const size_t k,
+                                         Kernel &kernel, const bool is_upper,
+                                         const Buffer<T> &buffer, const size_t offset,
+                                         const size_t ld, EventPointer event) {
+  const auto is_a = (side == Side::kLeft);
+
+  // Computes the transpose/conjugate options and the internal (padded) dimensions as above. The
+  // structured matrix itself is squared: its dimension is the k-dimension of the GEMM.
+  const auto m_used = (is_a) ? m : size_t{1};
+  const auto n_used = (is_a) ? size_t{1} : n;
+  bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
+  size_t a_one, a_two, b_one, b_two, c_one, c_two;
+  ProcessArguments(layout, transpose, transpose, m_used, n_used, k,
+                   a_one, a_two, b_one, b_two, c_one, c_two,
+                   a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                   db_["GEMMK"]);
+  size_t a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i;
+  CalculateInternalDimensions(m_used, n_used, k, db_["MWG"], db_["NWG"], db_["KWG"] * db_["KREG"],
+                              a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i,
+                              db_["GEMMK"]);
+  const auto one_i = (is_a) ? a_one_i : b_one_i;
+  const auto two_i = (is_a) ? a_two_i : b_two_i;
+  const auto do_transpose = (is_a) ? a_do_transpose : b_do_transpose;
+  const auto do_conjugate = (is_a) ? a_conjugate : b_conjugate;
+
+  // Sets the common arguments of the packing kernels
+  auto packed_buffer = Buffer<T>(context_, one_i * two_i);
+  kernel.SetArgument(0, static_cast<int>(k));
+  kernel.SetArgument(1, static_cast<int>(ld));
+  kernel.SetArgument(2, static_cast<int>(offset));
+  kernel.SetArgument(3, buffer());
+  kernel.SetArgument(4, static_cast<int>(one_i));
+  kernel.SetArgument(5, static_cast<int>(two_i));
+  kernel.SetArgument(6, packed_buffer());
+  kernel.SetArgument(7, static_cast<int>(is_upper));
+  kernel.SetArgument(8, static_cast<int>(do_transpose));
+  kernel.SetArgument(9, static_cast<int>(do_conjugate));
+
+  // Launches the kernel over the whole packed matrix, using the padding kernel's thread
+  // configuration (this is allowed since the packing kernels use the same parameters)
+  const auto global = std::vector<size_t>{Ceil(CeilDiv(one_i, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+                                          Ceil(CeilDiv(two_i, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
+  const auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+  RunKernel(kernel, queue_, device_, global, local, event);
+  return packed_buffer;
+}
+
+// Creates a squared copy of a symmetric, hermitian, or triangular matrix from its stored triangle.
+// This is used for sizes at which the direct kernel runs, which does not read the packed layout.
+template <typename T>
+Buffer<T> Xgemm<T>::SquareStructuredMatrix(const size_t k, Kernel &kernel,
+                                           const Buffer<T> &buffer, const size_t offset,
+                                           const size_t ld, EventPointer event) {
+  auto squared_buffer = Buffer<T>(context_, k * k);
+  kernel.SetArgument(0, static_cast<int>(k));
+  kernel.SetArgument(1, static_cast<int>(ld));
+  kernel.SetArgument(2, static_cast<int>(offset));
+  kernel.SetArgument(3, buffer());
+  kernel.SetArgument(4, static_cast<int>(k));
+  kernel.SetArgument(5, static_cast<int>(k));
+  kernel.SetArgument(6, 0);
+  kernel.SetArgument(7, squared_buffer());
+
+  // Uses the common padding kernel's thread configuration, as above
+  const auto global = std::vector<size_t>{Ceil(CeilDiv(k, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+                                          Ceil(CeilDiv(k, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
+  const auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+  RunKernel(kernel, queue_, device_, global, local, event);
+  return squared_buffer;
 }
 
 // =================================================================================================
@@ -107,17 +261,19 @@ void Xgemm<T>::DoGemm(const Layout layout,
 // overhead of these extra kernels might not be ideal for certain devices/arguments.
 template <typename T>
 void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
-                            const T alpha,
+                            const Scalar<T> &alpha,
                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                             const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
-                            const T beta,
+                            const Scalar<T> &beta,
                             const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
                             const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                             const bool a_conjugate, const bool b_conjugate,
                             const size_t a_one, const size_t a_two,
                             const size_t b_one, const size_t b_two,
                             const size_t c_one, const size_t c_two,
-                            const Buffer<T> &temp_buffer, const bool temp_buffer_provided) {
+                            const Buffer<T> &temp_buffer, const bool temp_buffer_provided,
+                            const bool a_packed, const bool b_packed,
+                            const std::vector<Event> &waitForEvents) {
 
   // Calculates the ceiled versions of m, n, and k
   const auto m_ceiled = Ceil(m, db_["MWG"]);
@@ -131,9 +287,17 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
                               a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i,
                               db_["GEMMK"]);
 
+  // Pre-packed matrices are already in the internal format, verifies they are large enough
+  if (a_packed && a_buffer.GetSize() < a_one_i * a_two_i * sizeof(T)) {
+    throw BLASError(StatusCode::kInsufficientMemoryA);
+  }
+  if (b_packed && b_buffer.GetSize() < b_one_i * b_two_i * sizeof(T)) {
+    throw BLASError(StatusCode::kInsufficientMemoryB);
+  }
+
   // Determines whether or not temporary matrices are needed
-  auto a_no_temp = NoTempBuffer(a_one, a_one_i, a_two, a_two_i, a_ld, a_offset, a_do_transpose, a_conjugate);
-  auto b_no_temp = NoTempBuffer(b_one, b_one_i, b_two, b_two_i, b_ld, b_offset, b_do_transpose, b_conjugate);
+  auto a_no_temp = a_packed || NoTempBuffer(a_one, a_one_i, a_two, a_two_i, a_ld, a_offset, a_do_transpose, a_conjugate);
+  auto b_no_temp = b_packed || NoTempBuffer(b_one, b_one_i, b_two, b_two_i, b_ld, b_offset, b_do_transpose, b_conjugate);
   auto c_no_temp = NoTempBuffer(c_one, c_one_i, c_two, c_two_i, c_ld, c_offset, c_do_transpose, false);
 
   // Computes the sizes and offsets for (optional) temporary buffers for the 3 matrices
@@ -161,16 +325,16 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
   const auto b_temp = (b_no_temp) ? b_buffer : temp_buffer_all;
   const auto c_temp = (c_no_temp) ? c_buffer : temp_buffer_all;
 
-  // Events of all kernels (including pre/post processing kernels)
-  auto eventWaitList = std::vector<Event>();
-  auto emptyEventList = std::vector<Event>();
+  // Events of all kernels (including pre/post processing kernels). All kernels wait for the events
+  // passed in by the caller, the pre-processing kernels directly and the others through them.
+  auto eventWaitList = waitForEvents;
 
   // Runs the pre-processing kernel for matrix A. This transposes the matrix, but also pads zeros
   // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
   // case nothing has to be done, these kernels can be skipped.
   if (!a_no_temp) {
     auto eventProcessA = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA.pointer(), waitForEvents,
                            a_one, a_two, a_ld, a_offset, a_buffer,
                            a_one_i, a_two_i, a_one_i, 0, a_temp,
                            ConstantOne<T>(), program_,
@@ -181,7 +345,7 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
   // As above, but now for matrix B
   if (!b_no_temp) {
     auto eventProcessB = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB.pointer(), waitForEvents,
                            b_one, b_two, b_ld, b_offset, b_buffer,
                            b_one_i, b_two_i, b_one_i, b_temp_offset, b_temp,
                            ConstantOne<T>(), program_,
@@ -189,10 +353,11 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
     eventWaitList.push_back(eventProcessB);
   }
 
-  // As above, but now for matrix C. This is only necessary if C is used both as input and output.
-  if (!c_no_temp && beta != static_cast<T>(0)) {
+  // As above, but now for matrix C. This is only necessary if C is used both as input and output,
+  // which is assumed in case beta is stored in device memory.
+  if (!c_no_temp && (beta.OnDevice() || beta.Value() != static_cast<T>(0))) {
     auto eventProcessC = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
+    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), waitForEvents,
                            c_one, c_two, c_ld, c_offset, c_buffer,
                            c_one_i, c_two_i, c_one_i, c_temp_offset, c_temp,
                            ConstantOne<T>(), program_,
@@ -207,13 +372,13 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
   kernel.SetArgument(0, static_cast<int>(m_ceiled));
   kernel.SetArgument(1, static_cast<int>(n_ceiled));
   kernel.SetArgument(2, static_cast<int>(k_ceiled));
-  kernel.SetArgument(3, GetRealArg(alpha));
-  kernel.SetArgument(4, GetRealArg(beta));
-  kernel.SetArgument(5, a_temp());
-  kernel.SetArgument(6, b_temp());
-  kernel.SetArgument(7, c_temp());
-  kernel.SetArgument(8, static_cast<int>(b_temp_offset / db_["VWN"]));
-  kernel.SetArgument(9, static_cast<int>(c_temp_offset / db_["VWM"]));
+  SetScalarArgument(kernel, 3, alpha);
+  SetScalarArgument(kernel, 5, beta);
+  kernel.SetArgument(7, a_temp());
+  kernel.SetArgument(8, b_temp());
+  kernel.SetArgument(9, c_temp());
+  kernel.SetArgument(10, static_cast<int>(b_temp_offset / db_["VWN"]));
+  kernel.SetArgument(11, static_cast<int>(c_temp_offset / db_["VWM"]));
 
   // Computes the global and local thread sizes
   const auto global_divider_one = c_want_rotated_(db_["GEMMK"]) ? db_["NWG"] : db_["MWG"];
@@ -241,6 +406,96 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
 }
 
 
+// =================================================================================================
+
+// The 3M version of complex GEMM. First, matrices A and B are split into planes of real numbers
+// holding the real part, the imaginary part, and their sum. Then, three real GEMMs compute the
+// products of these planes and finally these are combined into the complex result. This uses the
+// regular GEMM routine for the real data-type for the products, saving a quarter of the arithmetic
+// at the cost of slightly less accurate imaginary parts.
+template <typename T>
+void Xgemm<T>::Gemm3m(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const T alpha,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                      const T beta,
+                      const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                      const size_t a_one, const size_t a_two, const bool a_conjugate,
+                      const size_t b_one, const size_t b_two, const bool b_conjugate,
+                      const size_t c_one, const size_t c_two,
+                      const std::vector<Event> &waitForEvents) {
+  using real_t = typename BaseType<T>::Type;
+
+  // Temporary buffers for the three planes of each of the matrices A, B, and C
+  const auto a_plane_size = a_one * a_two;
+  const auto b_plane_size = b_one * b_two;
+  const auto c_plane_size = c_one * c_two;
+  auto a_planes = Buffer<real_t>(context_, 3 * a_plane_size);
+  auto b_planes = Buffer<real_t>(context_, 3 * b_plane_size);
+  auto c_planes = Buffer<real_t>(context_, 3 * c_plane_size);
+
+  // The split and combine kernels are compiled separately, as only the 3M algorithm needs them
+  const auto program_3m = GetProgram("3M", {
+    #include "../../kernels/level3/level3.opencl"
+    #include "../../kernels/level3/xgemm_3m.opencl"
+  });
+
+  // Uses the common padding kernel's thread configuration for the split and combine kernels. This is
+  // allowed, since these kernels use the same parameters.
+  const auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+
+  // Splits matrices A and B into their planes. In case of a conjugate transpose, the conjugation is
+  // applied here, such that the real GEMMs only need to transpose.
+  auto eventWaitList = std::vector<Event>();
+  const auto split = [&](const size_t one, const size_t two, const size_t ld, const size_t offset,
+                         const Buffer<T> &buffer, const Buffer<real_t> &planes, const bool conjugate) {
+    auto kernel = Kernel(program_3m, "Xgemm3mSplit");
+    kernel.SetArgument(0, static_cast<int>(one));
+    kernel.SetArgument(1, static_cast<int>(two));
+    kernel.SetArgument(2, static_cast<int>(ld));
+    kernel.SetArgument(3, static_cast<int>(offset));
+    kernel.SetArgument(4, buffer());
+    kernel.SetArgument(5, planes());
+    kernel.SetArgument(6, static_cast<int>(conjugate));
+    const auto global = std::vector<size_t>{Ceil(CeilDiv(one, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+                                            Ceil(CeilDiv(two, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
+    auto eventSplit = Event();
+    RunKernel(kernel, queue_, device_, global, local, eventSplit.pointer(), waitForEvents);
+    eventWaitList.push_back(eventSplit);
+  };
+  split(a_one, a_two, a_ld, a_offset, a_buffer, a_planes, a_conjugate);
+  split(b_one, b_two, b_ld, b_offset, b_buffer, b_planes, b_conjugate);
+
+  // Computes the three real products T1 = Ar * Br, T2 = Ai * Bi, and T3 = (Ar + Ai) * (Br + Bi)
+  const auto a_transpose_real = (a_transpose == Transpose::kNo) ? Transpose::kNo : Transpose::kYes;
+  const auto b_transpose_real = (b_transpose == Transpose::kNo) ? Transpose::kNo : Transpose::kYes;
+  auto eventProducts = std::vector<Event>();
+  for (auto plane = size_t{0}; plane < 3; ++plane) {
+    auto eventGemm = Event();
+    auto gemm = Xgemm<real_t>(queue_, eventGemm.pointer());
+    gemm.DoGemm(layout, a_transpose_real, b_transpose_real, m, n, k, ConstantOne<real_t>(),
+                a_planes, plane * a_plane_size, a_one, b_planes, plane * b_plane_size, b_one,
+                ConstantZero<real_t>(), c_planes, plane * c_plane_size, c_one,
+                Buffer<real_t>(0), false, false, false, eventWaitList);
+    eventProducts.push_back(eventGemm);
+  }
+
+  // Combines the three products into the final result, also applying alpha and beta
+  auto kernel = Kernel(program_3m, "Xgemm3mCombine");
+  kernel.SetArgument(0, static_cast<int>(c_one));
+  kernel.SetArgument(1, static_cast<int>(c_two));
+  kernel.SetArgument(2, GetRealArg(alpha));
+  kernel.SetArgument(3, GetRealArg(beta));
+  kernel.SetArgument(4, c_planes());
+  kernel.SetArgument(5, static_cast<int>(c_ld));
+  kernel.SetArgument(6, static_cast<int>(c_offset));
+  kernel.SetArgument(7, c_buffer());
+  const auto global = std::vector<size_t>{Ceil(CeilDiv(c_one, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+                                          Ceil(CeilDiv(c_two, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
+  RunKernel(kernel, queue_, device_, global, local, event_, eventProducts);
+}
+
 // =================================================================================================
 
 // The direct version of GEMM, requiring just one kernel, no pre or post-processing kernels.
@@ -252,7 +507,8 @@ void Xgemm<T>::GemmDirect(const size_t m, const size_t n, const size_t k,
                           const T beta,
                           const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
                           const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
-                          const bool a_conjugate, const bool b_conjugate) {
+                          const bool a_conjugate, const bool b_conjugate,
+                          const std::vector<Event> &waitForEvents) {
 
   // Retrieves the proper XgemmDirect kernel from the compiled binary
   const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectTT" : "XgemmDirectTN") :
@@ -290,7 +546,7 @@ void Xgemm<T>::GemmDirect(const size_t m, const size_t n, const size_t k,
   const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"]};
 
   // Launches the kernel
-  RunKernel(kernel, queue_, device_, global, local, event_);
+  RunKernel(kernel, queue_, device_, global, local, event_, waitForEvents);
 }
 
 // =================================================================================================
@@ -76,6 +76,14 @@ class Xgemm: public Routine {
     return (m_n_k < min_indirect_size_e3);
   }
 
+  // Selects whether or not to use the 3M algorithm: only for complex data-types and only for large
+  // enough matrices (all of m, n, and k). It is opt-in: a minimum size of zero disables it.
+  static bool Use3mAlgorithm(const size_t m, const size_t n, const size_t k, const size_t min_3m_size) {
+    const auto is_complex = PrecisionValue<T>() == Precision::kComplexSingle ||
+                            PrecisionValue<T>() == Precision::kComplexDouble;
+    return is_complex && min_3m_size != 0 && std::min(std::min(m, n), k) >= min_3m_size;
+  }
+
   // Process the user-arguments, computes secondary parameters
   static void ProcessArguments(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
                                const size_t m, const size_t n, const size_t k,
@@ -153,32 +161,100 @@ class Xgemm: public Routine {
     c_two_i = (c_want_rotated_(gemm_kernel_id)) ? m_ceiled : n_ceiled;
   }
 
+  // Computes the size of a pre-packed matrix A (side is left) or B (side is right), i.e. a matrix
+  // stored in the padded and possibly rotated layout as expected by the indirect GEMM kernel
+  static size_t GetPackedSize(const Side side, const size_t m, const size_t n, const size_t k,
+                              const size_t mwg, const size_t nwg, const size_t kwg,
+                              const size_t gemm_kernel_id) {
+    size_t a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i;
+    CalculateInternalDimensions(m, n, k, mwg, nwg, kwg,
+                                a_one_i, a_two_i, b_one_i, b_two_i, c_one_i, c_two_i,
+                                gemm_kernel_id);
+    return (side == Side::kLeft) ? a_one_i * a_two_i : b_one_i * b_two_i;
+  }
+
   // Constructor
-  Xgemm(Queue &queue, EventPointer event, const std::string &name = "GEMM");
+  Xgemm(Queue &queue, EventPointer event, const std::string &name = "GEMM",
+        const bool device_scalars = false);
+
+  // Retrieves the tuning parameters that determine the layout of a pre-packed matrix, in the order
+  // MWG, NWG, KWG (including KREG), and GEMMK
+  std::vector<size_t> GetPackingParameters() const {
+    return {db_["MWG"], db_["NWG"], db_["KWG"] * db_["KREG"], db_["GEMMK"]};
+  }
+
+  // Packs matrix A (side is left) or B (side is right) into the internal layout of the indirect
+  // GEMM kernel, such that it can later be passed to 'DoGemm' as a pre-packed matrix
+  void DoPackMatrix(const Layout layout, const Side side, const Transpose transpose,
+                    const size_t m, const size_t n, const size_t k,
+                    const Buffer<T> &buffer, const size_t offset, const size_t ld,
+                    const Buffer<T> &packed_buffer);
+
+  // As above, but signals the given event and waits for the given events instead
+  void PackMatrix(const Layout layout, const Side side, const Transpose transpose,
+                  const size_t m, const size_t n, const size_t k,
+                  const Buffer<T> &buffer, const size_t offset, const size_t ld,
+                  const Buffer<T> &packed_buffer,
+                  EventPointer event, const std::vector<Event> &waitForEvents = {});
 
-  // Templated-precision implementation of the routine
+  // Packs a squared symmetric, hermitian, or triangular matrix A (side is left) or B (side is
+  // right) directly from the triangle which holds its data into the internal layout of the indirect
+  // GEMM kernel. This runs one of the 'XxxToPacked' kernels, of which any extra arguments (from
+  // index 10 onwards) are set by the caller. Returns the newly allocated packed matrix.
+  Buffer<T> PackStructuredMatrix(const Layout layout, const Side side, const Transpose transpose,
+                                 const size_t m, const size_t n, const size_t k,
+                                 Kernel &kernel, const bool is_upper,
+                                 const Buffer<T> &buffer, const size_t offset, const size_t ld,
+                                 EventPointer event);
+
+  // As above, but creates a squared k-by-k copy of the matrix instead, which the direct GEMM kernel
+  // can read. This runs one of the 'XxxToSquared' kernels, of which any extra arguments (from index
+  // 8 onwards) are set by the caller. Returns the newly allocated squared matrix.
+  Buffer<T> SquareStructuredMatrix(const size_t k, Kernel &kernel,
+                                   const Buffer<T> &buffer, const size_t offset, const size_t ld,
+                                   EventPointer event);
+
+  // Templated-precision implementation of the routine. With scalars in device memory only the
+  // indirect kernel is used, as the direct and 3M versions take their scalars from the host.
   void DoGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
               const size_t m, const size_t n, const size_t k,
-              const T alpha,
+              const Scalar<T> &alpha,
               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
-              const T beta,
+              const Scalar<T> &beta,
               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
-              const Buffer<T> &temp_buffer = Buffer<T>(0), const bool temp_buffer_provided = false);
+              const Buffer<T> &temp_buffer = Buffer<T>(0), const bool temp_buffer_provided = false,
+              const bool a_packed = false, const bool b_packed = false,
+              const std::vector<Event> &waitForEvents = {});
 
   // Indirect version of GEMM (with pre and post-processing kernels)
   void GemmIndirect(const size_t m, const size_t n, const size_t k,
-                    const T alpha,
+                    const Scalar<T> &alpha,
                     const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                     const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
-                    const T beta,
+                    const Scalar<T> &beta,
                     const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
                     const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                     const bool a_conjugate, const bool b_conjugate,
                     const size_t a_one, const size_t a_two,
                     const size_t b_one, const size_t b_two,
                     const size_t c_one, const size_t c_two,
-                    const Buffer<T> &temp_buffer, const bool temp_buffer_provided);
+                    const Buffer<T> &temp_buffer, const bool temp_buffer_provided,
+                    const bool a_packed = false, const bool b_packed = false,
+                    const std::vector<Event> &waitForEvents = {});
+
+  // Complex version of GEMM using the 3M algorithm: three real GEMMs on the real and imaginary parts
+  void Gemm3m(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+              const size_t m, const size_t n, const size_t k,
+              const T alpha,
+              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+              const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+              const T beta,
+              const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+              const size_t a_one, const size_t a_two, const bool a_conjugate,
+              const size_t b_one, const size_t b_two, const bool b_conjugate,
+              const size_t c_one, const size_t c_two,
+              const std::vector<Event> &waitForEvents = {});
 
   // Direct version of GEMM (no pre and post-processing kernels)
   void GemmDirect(const size_t m, const size_t n, const size_t k,
@@ -188,7 +264,8 @@ class Xgemm: public Routine {
                   const T beta,
                   const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
                   const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
-                  const bool a_conjugate, const bool b_conjugate);
+                  const bool a_conjugate, const bool b_conjugate,
+                  const std::vector<Event> &waitForEvents = {});
 };
 
 // =================================================================================================
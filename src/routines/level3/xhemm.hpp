@@ -31,8 +31,11 @@ class Xhemm: public Xgemm<T> {
   using Xgemm<T>::context_;
   using Xgemm<T>::device_;
   using Xgemm<T>::program_;
+  using Xgemm<T>::GetProgram;
   using Xgemm<T>::db_;
   using Xgemm<T>::DoGemm;
+  using Xgemm<T>::PackStructuredMatrix;
+  using Xgemm<T>::SquareStructuredMatrix;
 
   // Constructor
   Xhemm(Queue &queue, EventPointer event, const std::string &name = "HEMM");
@@ -47,7 +47,8 @@ void Xherk<T,U>::DoHerk(const Layout layout, const Triangle triangle, const Tran
                               const U alpha,
                               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
                               const U beta,
-                              const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
+                              const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                              const std::vector<Event> &waitForEvents) {
   const auto b_transpose = (a_transpose != Transpose::kNo) ? Transpose::kNo : Transpose::kYes;
   const auto b_buffer = a_buffer;
   const auto b_offset = a_offset;
@@ -56,7 +57,7 @@ void Xherk<T,U>::DoHerk(const Layout layout, const Triangle triangle, const Tran
   const auto complex_beta = T{beta, static_cast<U>(0.0)};
   HerkAB(layout, triangle, a_transpose, b_transpose, n, k, complex_alpha,
          a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, complex_beta, c_buffer, c_offset, c_ld,
-         event_, true);
+         event_, true, false, waitForEvents);
 }
 
 template <typename T, typename U>
@@ -67,7 +68,8 @@ void Xherk<T,U>::HerkAB(const Layout layout, const Triangle triangle, const Tran
                         const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
                         const T complex_beta,
                         const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
-                        EventPointer final_event, const bool diagonal_to_zero) {
+                        EventPointer final_event, const bool diagonal_to_zero, const bool rank_2k,
+                        const std::vector<Event> &waitForEvents) {
 
   // Computes the transpose/conjugate options and sets the a/b/c sizes based on that
   bool a_do_transpose, b_do_transpose, c_do_transpose, dummy1, dummy2;
@@ -92,59 +94,111 @@ void Xherk<T,U>::HerkAB(const Layout layout, const Triangle triangle, const Tran
   TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
   TestMatrixC(n, n, c_buffer, c_offset, c_ld);
 
-  // Calculates the ceiled versions of n and k
-  auto n_ceiled = Ceil(Ceil(n, db_["MWG"]), db_["NWG"]);
-  auto k_ceiled = Ceil(k, db_["KWG"] * db_["KREG"]);
+  // Calculates the ceiled versions of n and k. In case of a rank-2k update, the two products are
+  // fused into a single one by concatenating [A, B] and [B, A] in the k-dimension.
+  const auto n_ceiled = Ceil(Ceil(n, db_["MWG"]), db_["NWG"]);
+  const auto k_ceiled = Ceil(k, db_["KWG"] * db_["KREG"]);
+  const auto num_parts = (rank_2k) ? size_t{2} : size_t{1};
+  const auto k_total = num_parts * k_ceiled;
 
   // Computes the first and second "internal" (ceiled) dimensions of the 3 matrices taking into account
-  // whether the matrices need to be rotated or not for the kernel.
-  const auto a_one_i = (Xgemm<T>::a_want_rotated_(db_["GEMMK"])) ? k_ceiled : n_ceiled;
-  const auto a_two_i = (Xgemm<T>::a_want_rotated_(db_["GEMMK"])) ? n_ceiled : k_ceiled;
-  const auto b_one_i = (!Xgemm<T>::b_want_rotated_(db_["GEMMK"])) ? k_ceiled : n_ceiled;
-  const auto b_two_i = (!Xgemm<T>::b_want_rotated_(db_["GEMMK"])) ? n_ceiled : k_ceiled;
-
-  // Decides which kernel to run: the upper-triangular or lower-triangular version
-  auto kernel_name = (triangle == Triangle::kUpper) ? "XgemmUpper" : "XgemmLower";
-
-  // Determines whether or not temporary matrices are needed
-  const auto a_no_temp = Xgemm<T>::NoTempBuffer(a_one, a_one_i, a_two, a_two_i, a_ld, a_offset, a_do_transpose, a_conjugate);
-  const auto b_no_temp = Xgemm<T>::NoTempBuffer(b_one, b_one_i, b_two, b_two_i, b_ld, b_offset, b_do_transpose, b_conjugate);
+  // whether the matrices need to be rotated or not for the kernel. In case of a rank-2k update,
+  // each consists of two parts of size 'part_one' by 'part_two', the second one at 'part_offset'.
+  const auto a_k_first = Xgemm<T>::a_want_rotated_(db_["GEMMK"]);
+  const auto b_k_first = !Xgemm<T>::b_want_rotated_(db_["GEMMK"]);
+  const auto a_part_one = (a_k_first) ? k_ceiled : n_ceiled;
+  const auto a_part_two = (a_k_first) ? n_ceiled : k_ceiled;
+  const auto b_part_one = (b_k_first) ? k_ceiled : n_ceiled;
+  const auto b_part_two = (b_k_first) ? n_ceiled : k_ceiled;
+  const auto a_one_i = (a_k_first) ? k_total : n_ceiled;
+  const auto a_two_i = (a_k_first) ? n_ceiled : k_total;
+  const auto b_one_i = (b_k_first) ? k_total : n_ceiled;
+  const auto b_two_i = (b_k_first) ? n_ceiled : k_total;
+  const auto a_part_offset = (a_k_first) ? k_ceiled : n_ceiled * k_ceiled;
+  const auto b_part_offset = (b_k_first) ? k_ceiled : n_ceiled * k_ceiled;
+
+  // Determines whether or not temporary matrices are needed. Matrix C can be computed in-place if
+  // it is stored such that the kernel can access it directly, otherwise a (possibly padded) copy of
+  // C is made, since it is not allowed to modify the other triangle.
+  const auto a_no_temp = !rank_2k && Xgemm<T>::NoTempBuffer(a_one, a_one_i, a_two, a_two_i, a_ld, a_offset, a_do_transpose, a_conjugate);
+  const auto b_no_temp = !rank_2k && Xgemm<T>::NoTempBuffer(b_one, b_one_i, b_two, b_two_i, b_ld, b_offset, b_do_transpose, b_conjugate);
+  const auto c_in_place = (db_["GEMMK"] == 0) && !c_do_transpose && (n == n_ceiled) &&
+                          (c_ld == n_ceiled) && IsMultiple(c_offset, db_["VWM"]);
 
   // Creates the temporary matrices
   auto a_temp = (a_no_temp) ? a_buffer : Buffer<T>(context_, a_one_i * a_two_i);
   auto b_temp = (b_no_temp) ? b_buffer : Buffer<T>(context_, b_one_i * b_two_i);
-  auto c_temp = Buffer<T>(context_, n_ceiled*n_ceiled);
-
-  // Events of all kernels (including pre/post processing kernels)
-  auto eventWaitList = std::vector<Event>();
-  auto emptyEventList = std::vector<Event>();
-
-  // Runs the pre-processing kernel for matrix A. This transposes the matrix, but also pads zeros
-  // to fill it up until it reaches a certain multiple of size (kernel parameter dependent). In
-  // case nothing has to be done, these kernels can be skipped. Two copies are created.
-  if (!a_no_temp) {
+  auto c_temp = (c_in_place) ? c_buffer : Buffer<T>(context_, n_ceiled*n_ceiled);
+
+  // In case of a rank-2k update, the two parts of A are scaled by alpha and its conjugate, such that
+  // the kernel itself uses a scaling factor of one
+  const auto conjugate_alpha = T{complex_alpha.real(), -complex_alpha.imag()};
+  const auto complex_one = T{static_cast<U>(1.0), static_cast<U>(0.0)};
+  const auto kernel_alpha = (rank_2k) ? complex_one : complex_alpha;
+
+  // Events of all kernels (including pre/post processing kernels). All kernels wait for the events
+  // passed in by the caller, the pre-processing kernels directly and the others through them.
+  auto eventWaitList = waitForEvents;
+
+  // Runs the pre-processing kernels for matrices A and B. These transpose the matrices, but also
+  // pad zeros to fill them up until they reach a certain multiple of size (kernel parameter
+  // dependent). In case nothing has to be done, these kernels can be skipped. In case of a rank-2k
+  // update, the first matrix is A followed by B and the second matrix is B followed by A.
+  for (auto part = size_t{0}; part < num_parts && !a_no_temp; ++part) {
+    const auto &src_buffer = (part == 0) ? a_buffer : b_buffer;
     auto eventProcessA = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA.pointer(), emptyEventList,
-                           a_one, a_two, a_ld, a_offset, a_buffer,
-                           a_one_i, a_two_i, a_one_i, 0, a_temp,
-                           ConstantOne<T>(), program_,
-                           true, a_do_transpose, a_conjugate);
+    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessA.pointer(), waitForEvents,
+                           a_one, a_two, (part == 0) ? a_ld : b_ld,
+                           (part == 0) ? a_offset : b_offset, src_buffer,
+                           a_part_one, a_part_two, a_one_i, part * a_part_offset, a_temp,
+                           (!rank_2k) ? complex_one : (part == 0) ? complex_alpha : conjugate_alpha,
+                           program_, true, a_do_transpose, a_conjugate);
     eventWaitList.push_back(eventProcessA);
   }
-  if (!b_no_temp) {
+  for (auto part = size_t{0}; part < num_parts && !b_no_temp; ++part) {
+    const auto &src_buffer = (part == 0) ? b_buffer : a_buffer;
     auto eventProcessB = Event();
-    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB.pointer(), emptyEventList,
-                           b_one, b_two, b_ld, b_offset, b_buffer,
-                           b_one_i, b_two_i, b_one_i, 0, b_temp,
+    PadCopyTransposeMatrix(queue_, device_, db_, eventProcessB.pointer(), waitForEvents,
+                           b_one, b_two, (part == 0) ? b_ld : a_ld,
+                           (part == 0) ? b_offset : a_offset, src_buffer,
+                           b_part_one, b_part_two, b_one_i, part * b_part_offset, b_temp,
                            ConstantOne<T>(), program_,
                            true, b_do_transpose, b_conjugate);
     eventWaitList.push_back(eventProcessB);
   }
 
-  // Furthermore, also creates a (possibly padded) copy of matrix C, since it is not allowed to
-  // modify the other triangle.
+  // Computes the global and local thread sizes
+  auto global = std::vector<size_t>{
+    (n_ceiled * db_["MDIMC"]) / db_["MWG"],
+    (n_ceiled * db_["NDIMC"]) / db_["NWG"]
+  };
+  auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
+
+  // Computes the triangle directly in C. Tiles on the diagonal temporarily store the elements of
+  // the other triangle in a small buffer with a number of slots per row of tiles.
+  if (c_in_place) {
+    const auto num_slots = (n_ceiled / db_["MWG"]) * (CeilDiv(db_["MWG"], db_["NWG"]) + 1);
+    auto stash_buffer = Buffer<T>(context_, num_slots * db_["MWG"] * db_["NWG"]);
+    auto kernel = Kernel(program_, "XgemmTriangleInPlace");
+    kernel.SetArgument(0, static_cast<int>(n_ceiled));
+    kernel.SetArgument(1, static_cast<int>(k_total));
+    kernel.SetArgument(2, GetRealArg(kernel_alpha));
+    kernel.SetArgument(3, GetRealArg(complex_beta));
+    kernel.SetArgument(4, a_temp());
+    kernel.SetArgument(5, b_temp());
+    kernel.SetArgument(6, c_buffer());
+    kernel.SetArgument(7, static_cast<int>(c_offset / db_["VWM"]));
+    kernel.SetArgument(8, stash_buffer());
+    kernel.SetArgument(9, static_cast<int>(triangle == Triangle::kUpper));
+    kernel.SetArgument(10, static_cast<int>(diagonal_to_zero));
+    RunKernel(kernel, queue_, device_, global, local, final_event, eventWaitList);
+    return;
+  }
+
+  // Otherwise creates a (possibly padded) copy of matrix C, since it is not allowed to modify the
+  // other triangle
   auto eventProcessC = Event();
-  PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
+  PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), waitForEvents,
                          n, n, c_ld, c_offset, c_buffer,
                          n_ceiled, n_ceiled, n_ceiled, 0, c_temp,
                          ConstantOne<T>(), program_,
@@ -152,24 +206,18 @@ void Xherk<T,U>::HerkAB(const Layout layout, const Triangle triangle, const Tran
   eventWaitList.push_back(eventProcessC);
 
   // Retrieves the XgemmUpper or XgemmLower kernel from the compiled binary
+  auto kernel_name = (triangle == Triangle::kUpper) ? "XgemmUpper" : "XgemmLower";
   auto kernel = Kernel(program_, kernel_name);
 
   // Sets the kernel arguments
   kernel.SetArgument(0, static_cast<int>(n_ceiled));
-  kernel.SetArgument(1, static_cast<int>(k_ceiled));
-  kernel.SetArgument(2, GetRealArg(complex_alpha));
+  kernel.SetArgument(1, static_cast<int>(k_total));
+  kernel.SetArgument(2, GetRealArg(kernel_alpha));
   kernel.SetArgument(3, GetRealArg(complex_beta));
   kernel.SetArgument(4, a_temp());
   kernel.SetArgument(5, b_temp());
   kernel.SetArgument(6, c_temp());
 
-  // Computes the global and local thread sizes
-  auto global = std::vector<size_t>{
-    (n_ceiled * db_["MDIMC"]) / db_["MWG"],
-    (n_ceiled * db_["NDIMC"]) / db_["NWG"]
-  };
-  auto local = std::vector<size_t>{db_["MDIMC"], db_["NDIMC"]};
-
   // Launches the kernel
   auto eventKernel = Event();
   RunKernel(kernel, queue_, device_, global, local, eventKernel.pointer(), eventWaitList);
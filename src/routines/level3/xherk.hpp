@@ -35,9 +35,11 @@ class Xherk: public Routine {
               const U alpha,
               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
               const U beta,
-              const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+              const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+              const std::vector<Event> &waitForEvents = {});
 
-  // Helper function to be reused for HER2K
+  // Helper function to be reused for HER2K: in case of a rank-2k update, this computes both
+  // products alpha*A*B^H and conj(alpha)*B*A^H in a single kernel
   void HerkAB(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Transpose b_transpose,
               const size_t n, const size_t k,
               const T complex_alpha,
@@ -45,7 +47,8 @@ class Xherk: public Routine {
               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
               const T complex_beta,
               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
-              EventPointer final_event, const bool diagonal_to_zero);
+              EventPointer final_event, const bool diagonal_to_zero, const bool rank_2k = false,
+              const std::vector<Event> &waitForEvents = {});
 };
 
 // =================================================================================================
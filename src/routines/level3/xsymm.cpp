@@ -47,49 +47,40 @@ void Xsymm<T>::DoSymm(const Layout layout, const Side side, const Triangle trian
   // Checks for validity of the squared A matrix
   TestMatrixA(k, k, a_buffer, a_offset, a_ld);
 
-  // Determines which kernel to run based on the layout (the Xgemm kernel assumes column-major as
-  // default) and on whether we are dealing with an upper or lower triangle of the symmetric matrix
+  // Determines which triangle holds the data based on the layout (the Xgemm kernel assumes
+  // column-major as default) and on whether we are dealing with an upper or lower triangle
   bool is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                    (triangle == Triangle::kLower && layout == Layout::kRowMajor));
-  auto kernel_name = (is_upper) ? "SymmUpperToSquared" : "SymmLowerToSquared";
-
-  // Temporary buffer for a copy of the symmetric matrix
-  auto temp_symm = Buffer<T>(context_, k*k);
-
-  // Creates a general matrix from the symmetric matrix to be able to run the regular Xgemm
-  // routine afterwards
-  auto kernel = Kernel(program_, kernel_name);
-
-  // Sets the arguments for the symmetric-to-squared kernel
-  kernel.SetArgument(0, static_cast<int>(k));
-  kernel.SetArgument(1, static_cast<int>(a_ld));
-  kernel.SetArgument(2, static_cast<int>(a_offset));
-  kernel.SetArgument(3, a_buffer());
-  kernel.SetArgument(4, static_cast<int>(k));
-  kernel.SetArgument(5, static_cast<int>(k));
-  kernel.SetArgument(6, static_cast<int>(0));
-  kernel.SetArgument(7, temp_symm());
-
-  // Uses the common padding kernel's thread configuration. This is allowed, since the
-  // symmetric-to-squared kernel uses the same parameters.
-  auto global = std::vector<size_t>{Ceil(CeilDiv(k, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
-                                    Ceil(CeilDiv(k, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
-  auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
-  auto kernelEvent = Event();
-  RunKernel(kernel, queue_, device_, global, local, kernelEvent.pointer());
-
-  // Synchronize now: 'DoGemm' does not accept a list of events to wait for
-  kernelEvent.WaitForCompletion();
+
+  // For sizes at which GEMM runs the direct kernel, a squared copy of the symmetric matrix is made,
+  // as the direct kernel reads its inputs in place. Otherwise, the matrix is packed straight from
+  // its stored triangle into the internal layout of the indirect kernel, which replaces the padding
+  // that GEMM would otherwise do. The conversion kernels are compiled separately, as the GEMM
+  // routine itself does not need them.
+  const auto program = GetProgram("CONVERT", {
+    #include "../../kernels/level3/level3.opencl"
+    #include "../../kernels/level3/convert_symmetric.opencl"
+  });
+  const auto use_direct = Xgemm<T>::UseDirectKernel(m, n, k, db_["XGEMM_MIN_INDIRECT_SIZE"]);
+  const auto squared_kernel_name = (is_upper) ? "SymmUpperToSquared" : "SymmLowerToSquared";
+  auto kernel = Kernel(program, (use_direct) ? squared_kernel_name : "SymmToPacked");
+  auto convertEvent = Event();
+  const auto symm = (use_direct) ?
+      SquareStructuredMatrix(k, kernel, a_buffer, a_offset, a_ld, convertEvent.pointer()) :
+      PackStructuredMatrix(layout, side, Transpose::kNo, m, n, k,
+                           kernel, is_upper, a_buffer, a_offset, a_ld, convertEvent.pointer());
+  const auto waitForEvents = std::vector<Event>{convertEvent};
 
   // Runs the regular Xgemm code with either "C := AB+C" or ...
   if (side == Side::kLeft) {
     DoGemm(layout, Transpose::kNo, Transpose::kNo,
            m, n, k,
            alpha,
-           temp_symm, 0, k,
+           symm, 0, k,
            b_buffer, b_offset, b_ld,
            beta,
-           c_buffer, c_offset, c_ld);
+           c_buffer, c_offset, c_ld,
+           Buffer<T>(0), false, !use_direct, false, waitForEvents);
   }
 
   // ... with "C := BA+C". Note that A and B are now reversed.
@@ -99,9 +90,10 @@ void Xsymm<T>::DoSymm(const Layout layout, const Side side, const Triangle trian
              m, n, k,
              alpha,
              b_buffer, b_offset, b_ld,
-             temp_symm, 0, k,
+             symm, 0, k,
              beta,
-             c_buffer, c_offset, c_ld);
+             c_buffer, c_offset, c_ld,
+             Buffer<T>(0), false, false, !use_direct, waitForEvents);
     } catch (BLASError &e) {
       // A and B are now reversed, so also reverse the error codes returned from the Xgemm routine
       switch(e.status()) {
@@ -9,8 +9,9 @@
 //
 // This file implements the Xsymm routine. It is based on the generalized matrix multiplication
 // routine (Xgemm). The Xsymm class inherits from the templated class Xgemm, allowing it to call the
-// "DoGemm" function directly. The "DoSymm" function first preprocesses the symmetric matrix by
-// transforming it into a general matrix, and then calls the regular GEMM code.
+// "DoGemm" function directly. The "DoSymm" function first packs the symmetric matrix from its stored
+// triangle directly into the internal layout of the GEMM kernel, and then calls the regular GEMM
+// code with this pre-packed matrix.
 //
 // =================================================================================================
 
@@ -33,8 +34,11 @@ class Xsymm: public Xgemm<T> {
   using Xgemm<T>::context_;
   using Xgemm<T>::device_;
   using Xgemm<T>::program_;
+  using Xgemm<T>::GetProgram;
   using Xgemm<T>::db_;
   using Xgemm<T>::DoGemm;
+  using Xgemm<T>::PackStructuredMatrix;
+  using Xgemm<T>::SquareStructuredMatrix;
 
   // Constructor
   Xsymm(Queue &queue, EventPointer event, const std::string &name = "SYMM");
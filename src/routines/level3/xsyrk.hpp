@@ -37,9 +37,11 @@ class Xsyrk: public Routine {
               const T alpha,
               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
               const T beta,
-              const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+              const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+              const std::vector<Event> &waitForEvents = {});
 
-  // Helper function to be reused for SYR2K
+  // Helper function to be reused for SYR2K: in case of a rank-2k update, this computes both
+  // products A*B^T and B*A^T in a single kernel
   void SyrkAB(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Transpose b_transpose,
               const size_t n, const size_t k,
               const T alpha,
@@ -47,7 +49,8 @@ class Xsyrk: public Routine {
               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
               const T beta,
               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
-              EventPointer final_event);
+              EventPointer final_event, const bool rank_2k = false,
+              const std::vector<Event> &waitForEvents = {});
 };
 
 // =================================================================================================
@@ -51,58 +51,62 @@ void Xtrmm<T>::DoTrmm(const Layout layout, const Side side, const Triangle trian
   const auto b_two = (layout == Layout::kRowMajor) ? m : n;
   TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
 
-  // Creates a copy of B to avoid overwriting input in GEMM while computing output
-  const auto b_size = (b_ld * (b_two - 1) + b_one + b_offset);
-  auto b_buffer_copy = Buffer<T>(context_, b_size);
-  b_buffer.CopyTo(queue_, b_size, b_buffer_copy);
-
-  // Determines which kernel to run based on the layout (the Xgemm kernel assumes column-major as
-  // default) and on whether we are dealing with an upper or lower triangle of the triangular matrix
+  // Determines which triangle holds the data based on the layout (the Xgemm kernel assumes
+  // column-major as default) and on whether we are dealing with an upper or lower triangle
   bool is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
                    (triangle == Triangle::kLower && layout == Layout::kRowMajor));
-  auto kernel_name = (is_upper) ? "TriaUpperToSquared" : "TriaLowerToSquared";
 
   // Determines whether or not the triangular matrix is unit-diagonal
   auto unit_diagonal = (diagonal == Diagonal::kUnit) ? true : false;
 
-  // Temporary buffer for a copy of the triangular matrix
-  auto temp_triangular = Buffer<T>(context_, k*k);
-
-  // Creates a general matrix from the triangular matrix to be able to run the regular Xgemm
-  // routine afterwards
-  auto kernel = Kernel(program_, kernel_name);
-
-  // Sets the arguments for the triangular-to-squared kernel
-  kernel.SetArgument(0, static_cast<int>(k));
-  kernel.SetArgument(1, static_cast<int>(a_ld));
-  kernel.SetArgument(2, static_cast<int>(a_offset));
-  kernel.SetArgument(3, a_buffer());
-  kernel.SetArgument(4, static_cast<int>(k));
-  kernel.SetArgument(5, static_cast<int>(k));
-  kernel.SetArgument(6, static_cast<int>(0));
-  kernel.SetArgument(7, temp_triangular());
-  kernel.SetArgument(8, static_cast<int>(unit_diagonal));
-
-  // Uses the common padding kernel's thread configuration. This is allowed, since the
-  // triangular-to-squared kernel uses the same parameters.
-  auto global = std::vector<size_t>{Ceil(CeilDiv(k, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
-                                    Ceil(CeilDiv(k, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
-  auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
-  auto kernelEvent = Event();
-  RunKernel(kernel, queue_, device_, global, local, kernelEvent.pointer());
-
-  // Synchronize now: 'DoGemm' does not accept a list of events to wait for
-  kernelEvent.WaitForCompletion();
+  // For sizes at which GEMM runs the direct kernel, a squared copy of the triangular matrix is made,
+  // as the direct kernel reads its inputs in place. Otherwise, the matrix is packed straight from
+  // its stored triangle into the internal layout of the indirect kernel, which replaces the padding
+  // that GEMM would otherwise do. The conversion kernels are compiled separately, as the GEMM
+  // routine itself does not need them.
+  const auto program = GetProgram("CONVERT", {
+    #include "../../kernels/level3/level3.opencl"
+    #include "../../kernels/level3/convert_triangular.opencl"
+  });
+  const auto use_direct = Xgemm<T>::UseDirectKernel(m, n, k, db_["XGEMM_MIN_INDIRECT_SIZE"]);
+  const auto squared_kernel_name = (is_upper) ? "TriaUpperToSquared" : "TriaLowerToSquared";
+  auto kernel = Kernel(program, (use_direct) ? squared_kernel_name : "TriaToPacked");
+  kernel.SetArgument((use_direct) ? 8 : 10, static_cast<int>(unit_diagonal));
+  auto convertEventA = Event();
+  const auto triangular = (use_direct) ?
+      SquareStructuredMatrix(k, kernel, a_buffer, a_offset, a_ld, convertEventA.pointer()) :
+      PackStructuredMatrix(layout, side, a_transpose, m, n, k,
+                           kernel, is_upper, a_buffer, a_offset, a_ld, convertEventA.pointer());
+
+  // Since B is both input and output, the GEMM kernel can't read it in-place. For the direct kernel
+  // a plain copy of B is made. Otherwise, B is packed as the other GEMM input matrix, which again
+  // replaces the padding that the GEMM routine would otherwise perform itself.
+  const auto b_side = (side == Side::kLeft) ? Side::kRight : Side::kLeft;
+  const auto b_copy_size = (use_direct) ? b_ld * (b_two - 1) + b_one + b_offset :
+                           Xgemm<T>::GetPackedSize(b_side, m, n, k, db_["MWG"], db_["NWG"],
+                                                   db_["KWG"] * db_["KREG"], db_["GEMMK"]);
+  auto b_buffer_copy = Buffer<T>(context_, b_copy_size);
+  auto convertEventB = Event();
+  if (use_direct) {
+    b_buffer.CopyToAsync(queue_, b_copy_size, b_buffer_copy, convertEventB.pointer());
+  }
+  else {
+    PackMatrix(layout, b_side, Transpose::kNo, m, n, k, b_buffer, b_offset, b_ld, b_buffer_copy,
+               convertEventB.pointer());
+  }
+  const auto b_copy_offset = (use_direct) ? b_offset : size_t{0};
+  const auto waitForEvents = std::vector<Event>{convertEventA, convertEventB};
 
   // Runs the regular Xgemm code with either "B := alpha*A*B" or ...
   if (side == Side::kLeft) {
     DoGemm(layout, a_transpose, Transpose::kNo,
            m, n, k,
            alpha,
-           temp_triangular, 0, k,
-           b_buffer_copy, b_offset, b_ld,
+           triangular, 0, k,
+           b_buffer_copy, b_copy_offset, b_ld,
            ConstantZero<T>(),
-           b_buffer, b_offset, b_ld);
+           b_buffer, b_offset, b_ld,
+           Buffer<T>(0), false, !use_direct, !use_direct, waitForEvents);
   }
 
   // ... with "B := alpha*B*A". Note that A and B are now reversed.
@@ -111,10 +115,11 @@ void Xtrmm<T>::DoTrmm(const Layout layout, const Side side, const Triangle trian
       DoGemm(layout, Transpose::kNo, a_transpose,
              m, n, k,
              alpha,
-             b_buffer_copy, b_offset, b_ld,
-             temp_triangular, 0, k,
+             b_buffer_copy, b_copy_offset, b_ld,
+             triangular, 0, k,
              ConstantZero<T>(),
-             b_buffer, b_offset, b_ld);
+             b_buffer, b_offset, b_ld,
+             Buffer<T>(0), false, !use_direct, !use_direct, waitForEvents);
     } catch (BLASError &e) {
       // A and B are now reversed, so also reverse the error codes returned from the Xgemm routine
       switch(e.status()) {
@@ -7,9 +7,10 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Xtrmm routine. The implementation is based on first transforming the
-// upper/lower unit/non-unit triangular matrix into a regular matrix and then calling the GEMM
-// routine. Therefore, this class inherits from the Xgemm class.
+// This file implements the Xtrmm routine. The implementation is based on first packing the
+// upper/lower unit/non-unit triangular matrix and the input/output matrix B into the internal layout
+// of the GEMM kernel and then calling the GEMM routine. Therefore, this class inherits from the
+// Xgemm class.
 //
 // =================================================================================================
 
@@ -32,8 +33,12 @@ class Xtrmm: public Xgemm<T> {
   using Xgemm<T>::context_;
   using Xgemm<T>::device_;
   using Xgemm<T>::program_;
+  using Xgemm<T>::GetProgram;
   using Xgemm<T>::db_;
   using Xgemm<T>::DoGemm;
+  using Xgemm<T>::PackMatrix;
+  using Xgemm<T>::PackStructuredMatrix;
+  using Xgemm<T>::SquareStructuredMatrix;
 
   // Constructor
   Xtrmm(Queue &queue, EventPointer event, const std::string &name = "TRMM");
@@ -10,7 +10,9 @@
 // This file implements the triangular matrix solver (A * X = B) TRSM class. This code is based
 // on the TRSM implementation in the CUDA version of Magma version 2.2.0 and the poster "Triangular
 // Linear System Solver for GPU with CUDA and OpenCL" by Peng Du, Stanimire Tomov, Piotr Luszczek,
-// and Jack Dongarra and the OpenCL implementation in clBLAS.
+// and Jack Dongarra and the OpenCL implementation in clBLAS. Instead of processing one diagonal
+// block at a time, the triangle is split recursively in halves, such that most of the work is done
+// in large GEMMs.
 //
 // =================================================================================================
 
@@ -38,7 +40,8 @@ void Xtrsm<T>::DoTrsm(const Layout layout, Side side, Triangle triangle,
                       size_t m, size_t n,
                       const T alpha,
                       const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
-                      const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld) {
+                      const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                      const std::vector<Event> &waitForEvents) {
 
   // Converts row-major to a col-major problem:
   // The idea is that
@@ -58,7 +61,7 @@ void Xtrsm<T>::DoTrsm(const Layout layout, Side side, Triangle triangle,
   TrsmColMajor(side, triangle, a_transpose, diagonal,
                m, n, alpha,
                a_buffer, a_offset, a_ld,
-               b_buffer, b_offset, b_ld);
+               b_buffer, b_offset, b_ld, waitForEvents);
 }
 
 // =================================================================================================
@@ -70,7 +73,8 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
                             const size_t m, const size_t n,
                             const T alpha,
                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
-                            const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld) {
+                            const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                            const std::vector<Event> &waitForEvents) {
 
   // Settings
   constexpr auto block_size = size_t{16}; // tuneable
@@ -93,6 +97,10 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
   // Checks for validity of the input B matrix
   TestMatrixB(m, n, b_buffer, b_offset, b_ld);
 
+  // All operations below are chained through events, such that the host never has to wait. The
+  // first ones wait for the events passed in by the caller.
+  auto events = waitForEvents;
+
   // Creates a copy of B to avoid overwriting input in GEMM while computing output
   const auto b_size = b_ld * (n - 1) + m + b_offset;
   const auto x_one = m;
@@ -101,152 +109,143 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
   const auto x_ld = b_ld;
   const auto x_offset = b_offset;
   auto x_buffer = Buffer<T>(context_, x_size);
-  b_buffer.CopyTo(queue_, x_size, x_buffer);
+  auto copy_event = Event();
+  b_buffer.CopyToAsync(queue_, x_size, x_buffer, copy_event.pointer(), events);
 
   // Temporary buffer for the inverse of the A matrix
   const auto a_inv_size = Ceil(k, block_size) * block_size;
   auto a_inv_buffer = Buffer<T>(context_, a_inv_size);
 
   // Fills the output buffer with zeros
-  auto eventWaitList = std::vector<Event>();
+  auto eventWaitList = std::vector<Event>{copy_event};
   auto fill_matrix_event = Event();
   FillMatrix(queue_, device_, program_, fill_matrix_event.pointer(), eventWaitList,
              x_one, x_two, x_ld, x_offset, x_buffer, ConstantZero<T>(), 16);
-  fill_matrix_event.WaitForCompletion();
 
-  // Inverts the diagonal blocks
+  // Inverts the diagonal blocks, which is independent of the above
   auto diagonal_invert_event = Event();
   auto inverter = Xinvert<T>(queue_, diagonal_invert_event.pointer());
   inverter.InvertMatrixDiagonalBlocks(Layout::kColMajor, triangle, diagonal,
-                                      k, block_size, a_buffer, a_offset, a_ld, a_inv_buffer);
-  diagonal_invert_event.WaitForCompletion();
+                                      k, block_size, a_buffer, a_offset, a_ld, a_inv_buffer,
+                                      waitForEvents);
+  events = std::vector<Event>{fill_matrix_event, diagonal_invert_event};
 
-  // Derives properties based on the arguments
+  // Derives properties based on the arguments: the solve runs either from the first to the last
+  // diagonal block (forward) or the other way around (backward)
   const auto condition = ((triangle == Triangle::kUpper && a_transpose != Transpose::kNo) ||
                           (triangle == Triangle::kLower && a_transpose == Transpose::kNo));
+  const auto forward = (side == Side::kLeft) ? condition : !condition;
 
-  // Left side
-  if (side == Side::kLeft) {
+  // Solves the system recursively, starting with the full triangle
+  TrsmRecursive(side, forward, a_transpose, m, n, 0, k, alpha,
+                a_buffer, a_offset, a_ld, a_inv_buffer, block_size,
+                b_buffer, b_offset, b_ld, x_buffer, x_offset, x_ld, events);
 
-    // True when (lower triangular) or (upper triangular and transposed)
-    if (condition) {
-      for (auto i = size_t{0}; i < m; i += block_size) {
-        const auto gemm_alpha = (i == 0) ? alpha : ConstantOne<T>();
-        const auto current_block_size = std::min(m - i, block_size);
-        auto gemm1_event = Event();
-        auto gemm1 = Xgemm<T>(queue_, gemm1_event.pointer());
-        gemm1.DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-                     current_block_size, n, current_block_size, gemm_alpha,
-                     a_inv_buffer, i * block_size, block_size,
-                     b_buffer, b_offset + i, b_ld, ConstantZero<T>(),
-                     x_buffer, x_offset + i, x_ld);
-        gemm1_event.WaitForCompletion();
-        if (i + block_size >= m) { break; }
-
-        const auto this_a_offset = (a_transpose == Transpose::kNo) ? (i + block_size) + i * a_ld : i + (block_size + i) * a_ld;
-        auto gemm2_event = Event();
-        auto gemm2 = Xgemm<T>(queue_, gemm2_event.pointer());
-        gemm2.DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-                     m - i - block_size, n, block_size, ConstantNegOne<T>(),
-                     a_buffer, this_a_offset + a_offset, a_ld,
-                     x_buffer, x_offset + i, x_ld, gemm_alpha,
-                     b_buffer, b_offset + i + block_size, b_ld);
-        gemm2_event.WaitForCompletion();
-      }
-    }
+  // Retrieves the results
+  x_buffer.CopyToAsync(queue_, b_size, b_buffer, event_, events);
+}
 
-    // True when (upper triangular) or (lower triangular and transposed)
+// Solves the sub-problem for the diagonal block of A starting at 'start' of size 'size'. This is
+// split in halves at a multiple of the block size (as used for the inverted diagonal blocks). The
+// first half is solved recursively, its contribution is subtracted from the remaining right-hand
+// side using a single GEMM, after which the second half is solved recursively. This way, most of
+// the work is done in a few large GEMMs rather than in many GEMMs with a k-dimension equal to the
+// block size. In case of a backward solve, the order of the two halves is reversed.
+template <typename T>
+void Xtrsm<T>::TrsmRecursive(const Side side, const bool forward, const Transpose a_transpose,
+                             const size_t m, const size_t n, const size_t start, const size_t size,
+                             const T alpha,
+                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                             const Buffer<T> &a_inv_buffer, const size_t block_size,
+                             const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                             const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_ld,
+                             std::vector<Event> &events) {
+  const auto b_index = [&](const size_t i) {
+    return (side == Side::kLeft) ? b_offset + i : b_offset + i * b_ld;
+  };
+  const auto x_index = [&](const size_t i) {
+    return (side == Side::kLeft) ? x_offset + i : x_offset + i * x_ld;
+  };
+
+  // Base case: multiplies the right-hand side with the inverse of a single diagonal block
+  if (size <= block_size) {
+    if (side == Side::kLeft) {
+      ChainedGemm(a_transpose, Transpose::kNo,
+                  size, n, size, alpha,
+                  a_inv_buffer, start * block_size, block_size,
+                  b_buffer, b_index(start), b_ld, ConstantZero<T>(),
+                  x_buffer, x_index(start), x_ld, events);
+    }
     else {
-      const auto special_block_size = (m % block_size == 0) ? block_size : (m % block_size);
-      const auto i_start = static_cast<int>(m) - static_cast<int>(special_block_size);
-      for (auto i = i_start; i >= 0; i -= static_cast<int>(block_size)) {
-        const auto current_block_size = (i == i_start) ? special_block_size : block_size;
-        const auto gemm_alpha = (i == i_start) ? alpha : ConstantOne<T>();
-        auto gemm1_event = Event();
-        auto gemm1 = Xgemm<T>(queue_, gemm1_event.pointer());
-        gemm1.DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-                     current_block_size, n, current_block_size, gemm_alpha,
-                     a_inv_buffer, i * block_size, block_size,
-                     b_buffer, b_offset + i, b_ld, ConstantZero<T>(),
-                     x_buffer, x_offset + i, x_ld);
-        gemm1_event.WaitForCompletion();
-        if (i - static_cast<int>(block_size) < 0) { break; }
-
-        const auto this_a_offset = (a_transpose == Transpose::kNo) ? i * a_ld : i;
-        auto gemm2_event = Event();
-        auto gemm2 = Xgemm<T>(queue_, gemm2_event.pointer());
-        gemm2.DoGemm(Layout::kColMajor, a_transpose, Transpose::kNo,
-                     i, n, current_block_size, ConstantNegOne<T>(),
-                     a_buffer, this_a_offset + a_offset, a_ld,
-                     x_buffer, x_offset + i, x_ld, gemm_alpha,
-                     b_buffer, b_offset, b_ld);
-        gemm2_event.WaitForCompletion();
-      }
+      ChainedGemm(Transpose::kNo, a_transpose,
+                  m, size, size, alpha,
+                  b_buffer, b_index(start), b_ld,
+                  a_inv_buffer, start * block_size, block_size, ConstantZero<T>(),
+                  x_buffer, x_index(start), x_ld, events);
     }
+    return;
   }
 
-  // Right side
+  // Splits the diagonal block in two parts, the first one being a multiple of the block size
+  const auto size1 = (CeilDiv(size, block_size) / 2) * block_size;
+  const auto size2 = size - size1;
+  const auto start2 = start + size1;
+  const auto solved_start = (forward) ? start : start2;
+  const auto solved_size = (forward) ? size1 : size2;
+  const auto update_start = (forward) ? start2 : start;
+  const auto update_size = (forward) ? size2 : size1;
+
+  // Solves the first part of the system
+  TrsmRecursive(side, forward, a_transpose, m, n, solved_start, solved_size, alpha,
+                a_buffer, a_offset, a_ld, a_inv_buffer, block_size,
+                b_buffer, b_offset, b_ld, x_buffer, x_offset, x_ld, events);
+
+  // Updates the remaining part of the right-hand side: this is the off-diagonal block of op(A) at
+  // rows 'update_start' and columns 'solved_start' on the left side, or vice-versa on the right
+  const auto a_row = (side == Side::kLeft) ? update_start : solved_start;
+  const auto a_col = (side == Side::kLeft) ? solved_start : update_start;
+  const auto a_block_offset = (a_transpose == Transpose::kNo) ? a_row + a_col * a_ld
+                                                              : a_col + a_row * a_ld;
+  if (side == Side::kLeft) {
+    ChainedGemm(a_transpose, Transpose::kNo,
+                update_size, n, solved_size, ConstantNegOne<T>(),
+                a_buffer, a_offset + a_block_offset, a_ld,
+                x_buffer, x_index(solved_start), x_ld, alpha,
+                b_buffer, b_index(update_start), b_ld, events);
+  }
   else {
-
-    // True when (lower triangular) or (upper triangular and transposed)
-    if (condition) {
-      const auto special_block_size = (n % block_size == 0) ? block_size : (n % block_size);
-      const auto i_start = static_cast<int>(n) - static_cast<int>(special_block_size);
-      for (auto i = i_start; i >= 0; i -= static_cast<int>(block_size)) {
-        const auto current_block_size = (i == i_start) ? special_block_size : block_size;
-        const auto gemm_alpha = (i == i_start) ? alpha : ConstantOne<T>();
-        auto gemm1_event = Event();
-        auto gemm1 = Xgemm<T>(queue_, gemm1_event.pointer());
-        gemm1.DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-                     m, current_block_size, current_block_size, gemm_alpha,
-                     b_buffer, b_offset + i * b_ld, b_ld,
-                     a_inv_buffer, i * block_size, block_size, ConstantZero<T>(),
-                     x_buffer, x_offset + i * x_ld, x_ld);
-        gemm1_event.WaitForCompletion();
-        if (i - static_cast<int>(block_size) < 0) { break; }
-
-        const auto this_a_offset = (a_transpose == Transpose::kNo) ? i : i * a_ld;
-        auto gemm2_event = Event();
-        auto gemm2 = Xgemm<T>(queue_, gemm2_event.pointer());
-        gemm2.DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-                     m, i, current_block_size, ConstantNegOne<T>(),
-                     x_buffer, x_offset + i * x_ld, x_ld,
-                     a_buffer, this_a_offset + a_offset, a_ld, gemm_alpha,
-                     b_buffer, b_offset, b_ld);
-        gemm2_event.WaitForCompletion();
-      }
-    }
-
-    // True when (upper triangular) or (lower triangular and transposed)
-    else {
-      for (auto i = size_t{0}; i < n; i += block_size) {
-        const auto gemm_alpha = (i == 0) ? alpha : ConstantOne<T>();
-        const auto current_block_size = std::min(n - i, block_size);
-        auto gemm1_event = Event();
-        auto gemm1 = Xgemm<T>(queue_, gemm1_event.pointer());
-        gemm1.DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-                     m, current_block_size, current_block_size, gemm_alpha,
-                     b_buffer, b_offset + i * b_ld, b_ld,
-                     a_inv_buffer, i * block_size, block_size, ConstantZero<T>(),
-                     x_buffer, x_offset + i * x_ld, x_ld);
-        gemm1_event.WaitForCompletion();
-        if (i + block_size >= n) { break; }
-
-        const auto this_a_offset = (a_transpose == Transpose::kNo) ? i + (block_size + i) * a_ld : (i + block_size) + i * a_ld;
-        auto gemm2_event = Event();
-        auto gemm2 = Xgemm<T>(queue_, gemm2_event.pointer());
-        gemm2.DoGemm(Layout::kColMajor, Transpose::kNo, a_transpose,
-                     m, n - i - block_size, block_size, ConstantNegOne<T>(),
-                     x_buffer, x_offset + i * x_ld, x_ld,
-                     a_buffer, this_a_offset + a_offset, a_ld, gemm_alpha,
-                     b_buffer, b_offset + (i + block_size) * b_ld, b_ld);
-        gemm2_event.WaitForCompletion();
-      }
-    }
+    ChainedGemm(Transpose::kNo, a_transpose,
+                m, update_size, solved_size, ConstantNegOne<T>(),
+                x_buffer, x_index(solved_start), x_ld,
+                a_buffer, a_offset + a_block_offset, a_ld, alpha,
+                b_buffer, b_index(update_start), b_ld, events);
   }
 
-  // Retrieves the results
-  x_buffer.CopyToAsync(queue_, b_size, b_buffer, event_);
+  // Solves the second part of the system, for which alpha has already been applied
+  TrsmRecursive(side, forward, a_transpose, m, n, update_start, update_size, ConstantOne<T>(),
+                a_buffer, a_offset, a_ld, a_inv_buffer, block_size,
+                b_buffer, b_offset, b_ld, x_buffer, x_offset, x_ld, events);
+}
+
+// Runs a column-major GEMM after the previous operation(s) in 'events' have completed. This re-uses
+// the GEMM kernels compiled for this routine and replaces 'events' by the event of the GEMM.
+template <typename T>
+void Xtrsm<T>::ChainedGemm(const Transpose a_transpose, const Transpose b_transpose,
+                           const size_t m, const size_t n, const size_t k,
+                           const T alpha,
+                           const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                           const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                           const T beta,
+                           const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                           std::vector<Event> &events) {
+  auto event = Event();
+  const auto user_event = event_;
+  event_ = event.pointer();
+  DoGemm(Layout::kColMajor, a_transpose, b_transpose, m, n, k, alpha,
+         a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+         c_buffer, c_offset, c_ld, Buffer<T>(0), false, false, false, events);
+  event_ = user_event;
+  events = std::vector<Event>{event};
 }
 
 // =================================================================================================
@@ -15,6 +15,8 @@
 #ifndef CLBLAST_ROUTINES_XTRSM_H_
 #define CLBLAST_ROUTINES_XTRSM_H_
 
+#include <vector>
+
 #include "routines/level3/xgemm.hpp"
 
 namespace clblast {
@@ -43,7 +45,8 @@ class Xtrsm: public Xgemm<T> {
               size_t m, size_t n,
               const T alpha,
               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
-              const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld);
+              const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+              const std::vector<Event> &waitForEvents = {});
 
   // Implementation of the column-major version
   void TrsmColMajor(const Side side, const Triangle triangle,
@@ -51,7 +54,31 @@ class Xtrsm: public Xgemm<T> {
                     const size_t m, const size_t n,
                     const T alpha,
                     const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
-                    const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld);
+                    const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                    const std::vector<Event> &waitForEvents = {});
+
+ private:
+
+  // Recursive implementation of the column-major version, solving for the diagonal block of A
+  // starting at 'start' of size 'size'
+  void TrsmRecursive(const Side side, const bool forward, const Transpose a_transpose,
+                     const size_t m, const size_t n, const size_t start, const size_t size,
+                     const T alpha,
+                     const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                     const Buffer<T> &a_inv_buffer, const size_t block_size,
+                     const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                     const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_ld,
+                     std::vector<Event> &events);
+
+  // Runs a column-major GEMM as part of the chain of operations given by 'events'
+  void ChainedGemm(const Transpose a_transpose, const Transpose b_transpose,
+                   const size_t m, const size_t n, const size_t k,
+                   const T alpha,
+                   const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                   const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                   const T beta,
+                   const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                   std::vector<Event> &events);
 };
 
 // =================================================================================================
@@ -0,0 +1,94 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XasumBatched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xasumbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XasumBatched<T>::XasumBatched(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xdot", "ReductionSingleLaunch"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/reduction.opencl"
+    #include "../../kernels/level1/xasum.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XasumBatched<T>::DoAsumBatched(const size_t n,
+                                    const Buffer<T> &asum_buffer, const std::vector<size_t> &asum_offsets,
+                                    const Buffer<T> &x_buffer, const std::vector<size_t> &x_offsets, const size_t x_inc,
+                                    const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (x_offsets.size() != batch_count) ||
+      (asum_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vectors for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestVectorX(n, x_buffer, x_offsets[batch], x_inc);
+    TestVectorScalar(1, asum_buffer, asum_offsets[batch]);
+  }
+
+  // Upload the arguments to the device
+  auto x_offsets_int = std::vector<int>(batch_count);
+  auto asum_offsets_int = std::vector<int>(batch_count);
+  for (auto batch = size_t{ 0 }; batch < batch_count; ++batch) {
+    x_offsets_int[batch] = static_cast<int>(x_offsets[batch]);
+    asum_offsets_int[batch] = static_cast<int>(asum_offsets[batch]);
+  }
+  auto x_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  auto asum_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  x_offsets_device.Write(queue_, batch_count, x_offsets_int);
+  asum_offsets_device.Write(queue_, batch_count, asum_offsets_int);
+
+  // Retrieves the Xasum kernel from the compiled binary
+  auto kernel = Kernel(program_, "XasumBatched");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, x_buffer());
+  kernel.SetArgument(2, x_offsets_device());
+  kernel.SetArgument(3, static_cast<int>(x_inc));
+  kernel.SetArgument(4, asum_buffer());
+  kernel.SetArgument(5, asum_offsets_device());
+
+  // Launches the kernel: a single work-group per reduction
+  auto global = std::vector<size_t>{db_["WGS1"], batch_count};
+  auto local = std::vector<size_t>{db_["WGS1"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XasumBatched<half>;
+template class XasumBatched<float>;
+template class XasumBatched<double>;
+template class XasumBatched<float2>;
+template class XasumBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,45 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XasumBatched routine. This is a non-blas batched version of ASUM. Each
+// reduction is computed by a single work-group, such that the entire batch runs as a single kernel
+// launch. The work-group size is taken from the 'Xdot' database entry ('WGS1').
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XASUMBATCHED_H_
+#define CLBLAST_ROUTINES_XASUMBATCHED_H_
+
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XasumBatched: public Routine {
+ public:
+
+  // Constructor
+  XasumBatched(Queue &queue, EventPointer event, const std::string &name = "ASUMBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoAsumBatched(const size_t n,
+                     const Buffer<T> &asum_buffer, const std::vector<size_t> &asum_offsets,
+                     const Buffer<T> &x_buffer, const std::vector<size_t> &x_offsets, const size_t x_inc,
+                     const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XASUMBATCHED_H_
+#endif
@@ -0,0 +1,87 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XasumStridedBatched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xasumstridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XasumStridedBatched<T>::XasumStridedBatched(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xdot", "ReductionSingleLaunch"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/reduction.opencl"
+    #include "../../kernels/level1/xasum.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XasumStridedBatched<T>::DoAsumStridedBatched(const size_t n,
+                                                  const Buffer<T> &asum_buffer, const size_t asum_offset, const size_t asum_stride,
+                                                  const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                  const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if (batch_count < 1) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Makes sure the strides are valid
+  if (asum_stride == 0 && batch_count > 1) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the vectors for validity
+  const auto last_batch = batch_count - 1;
+  TestVectorX(n, x_buffer, x_offset + last_batch * x_stride, x_inc);
+  TestVectorScalar(1, asum_buffer, asum_offset + last_batch * asum_stride);
+
+  // Retrieves the Xasum kernel from the compiled binary
+  auto kernel = Kernel(program_, "XasumStridedBatched");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, x_buffer());
+  kernel.SetArgument(2, static_cast<int>(x_offset));
+  kernel.SetArgument(3, static_cast<int>(x_inc));
+  kernel.SetArgument(4, static_cast<int>(x_stride));
+  kernel.SetArgument(5, asum_buffer());
+  kernel.SetArgument(6, static_cast<int>(asum_offset));
+  kernel.SetArgument(7, static_cast<int>(asum_stride));
+
+  // Launches the kernel: a single work-group per reduction
+  auto global = std::vector<size_t>{db_["WGS1"], batch_count};
+  auto local = std::vector<size_t>{db_["WGS1"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XasumStridedBatched<half>;
+template class XasumStridedBatched<float>;
+template class XasumStridedBatched<double>;
+template class XasumStridedBatched<float2>;
+template class XasumStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,111 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xaxpby class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xaxpby.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xaxpby<T>::Xaxpby(Queue &queue, EventPointer event, const std::string &name,
+                  const bool device_scalars):
+    Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/level1.opencl"
+    #include "../../kernels/level1/xaxpy.opencl"
+    }, device_scalars) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xaxpby<T>::DoAxpby(const size_t n, const Scalar<T> &alpha,
+                        const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                        const Scalar<T> &beta,
+                        const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vectors for validity
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorY(n, y_buffer, y_offset, y_inc);
+
+  // Determines whether or not the fast-version can be used
+  const auto use_faster_kernel = (x_offset == 0) && (x_inc == 1) &&
+                                 (y_offset == 0) && (y_inc == 1) &&
+                                 IsMultiple(n, db_["WPT"]*db_["VW"]);
+  const auto use_fastest_kernel = use_faster_kernel &&
+                                  IsMultiple(n, db_["WGS"]*db_["WPT"]*db_["VW"]);
+
+  // If possible, run the fast-version of the kernel
+  const auto kernel_name = (use_fastest_kernel) ? "XaxpbyFastest" :
+                           (use_faster_kernel) ? "XaxpbyFaster" : "Xaxpby";
+
+  // Retrieves the Xaxpby kernel from the compiled binary
+  auto kernel = Kernel(program_, kernel_name);
+
+  // Sets the kernel arguments
+  if (use_faster_kernel || use_fastest_kernel) {
+    kernel.SetArgument(0, static_cast<int>(n));
+    SetScalarArgument(kernel, 1, alpha);
+    SetScalarArgument(kernel, 3, beta);
+    kernel.SetArgument(5, x_buffer());
+    kernel.SetArgument(6, y_buffer());
+  }
+  else {
+    kernel.SetArgument(0, static_cast<int>(n));
+    SetScalarArgument(kernel, 1, alpha);
+    SetScalarArgument(kernel, 3, beta);
+    kernel.SetArgument(5, x_buffer());
+    kernel.SetArgument(6, static_cast<int>(x_offset));
+    kernel.SetArgument(7, static_cast<int>(x_inc));
+    kernel.SetArgument(8, y_buffer());
+    kernel.SetArgument(9, static_cast<int>(y_offset));
+    kernel.SetArgument(10, static_cast<int>(y_inc));
+  }
+
+  // Launches the kernel
+  if (use_fastest_kernel) {
+    auto global = std::vector<size_t>{CeilDiv(n, db_["WPT"]*db_["VW"])};
+    auto local = std::vector<size_t>{db_["WGS"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+  }
+  else if (use_faster_kernel) {
+    auto global = std::vector<size_t>{Ceil(CeilDiv(n, db_["WPT"]*db_["VW"]), db_["WGS"])};
+    auto local = std::vector<size_t>{db_["WGS"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+  }
+  else {
+    const auto n_ceiled = Ceil(n, db_["WGS"]*db_["WPT"]);
+    auto global = std::vector<size_t>{n_ceiled/db_["WPT"]};
+    auto local = std::vector<size_t>{db_["WGS"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+  }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xaxpby<half>;
+template class Xaxpby<float>;
+template class Xaxpby<double>;
+template class Xaxpby<float2>;
+template class Xaxpby<double2>;
+
+// =================================================================================================
+} // namespace clblast
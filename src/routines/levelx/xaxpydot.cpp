@@ -0,0 +1,141 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xaxpydot class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xaxpydot.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor. The reduction uses the Xdot parameters, the
+// vector width is taken from Xaxpy.
+template <typename T>
+Xaxpydot<T>::Xaxpydot(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xdot", "Xaxpy", "ReductionSingleLaunch"},
+            PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/level1.opencl"
+    #include "../../kernels/level1/reduction.opencl"
+    #include "../../kernels/level1/xdot.opencl"
+    #include "../../kernels/level1/xnrm2.opencl"
+    #include "../../kernels/level1/xaxpydot.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xaxpydot<T>::DoAxpydot(const size_t n,
+                            const Buffer<T> &dot_buffer, const size_t dot_offset, const T alpha,
+                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                            const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                            const Buffer<T> &z_buffer, const size_t z_offset, const size_t z_inc,
+                            const bool do_norm) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vectors for validity
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorY(n, y_buffer, y_offset, y_inc);
+  if (!do_norm) { TestVectorX(n, z_buffer, z_offset, z_inc); }
+  TestVectorScalar(1, dot_buffer, dot_offset);
+
+  // Creates the buffer for intermediate values
+  auto temp_size = 2*db_["WGS2"];
+  auto temp_buffer = Buffer<T>(context_, temp_size);
+
+  // Determines whether or not the vectorized version can be used
+  const auto use_fast_kernel = (x_offset == 0) && (x_inc == 1) &&
+                               (y_offset == 0) && (y_inc == 1) &&
+                               (do_norm || ((z_offset == 0) && (z_inc == 1))) &&
+                               IsMultiple(n, db_["VW"]);
+
+  // In single-launch mode the last work-group to finish performs the final reduction, such that the
+  // epilogue kernel is not needed. This requires a work-group counter, kept zeroed by the kernel,
+  // which can only be shared between calls on an in-order queue.
+  const auto single_launch = (db_["REDUCTION_SINGLE_LAUNCH"] == 1) && !queue_.IsOutOfOrder();
+
+  // Retrieves the main kernel from the compiled binary
+  auto kernel1 = Kernel(program_, (use_fast_kernel) ? "XaxpyDotFast" : "XaxpyDot");
+
+  // Sets the kernel arguments
+  kernel1.SetArgument(0, static_cast<int>(n));
+  kernel1.SetArgument(1, GetRealArg(alpha));
+  auto next_arg = 0;
+  if (use_fast_kernel) {
+    kernel1.SetArgument(2, x_buffer());
+    kernel1.SetArgument(3, y_buffer());
+    kernel1.SetArgument(4, z_buffer());
+    next_arg = 5;
+  }
+  else {
+    kernel1.SetArgument(2, x_buffer());
+    kernel1.SetArgument(3, static_cast<int>(x_offset));
+    kernel1.SetArgument(4, static_cast<int>(x_inc));
+    kernel1.SetArgument(5, y_buffer());
+    kernel1.SetArgument(6, static_cast<int>(y_offset));
+    kernel1.SetArgument(7, static_cast<int>(y_inc));
+    kernel1.SetArgument(8, z_buffer());
+    kernel1.SetArgument(9, static_cast<int>(z_offset));
+    kernel1.SetArgument(10, static_cast<int>(z_inc));
+    next_arg = 11;
+  }
+  kernel1.SetArgument(next_arg + 0, temp_buffer());
+  kernel1.SetArgument(next_arg + 1, static_cast<int>(do_norm));
+  kernel1.SetArgument(next_arg + 2, static_cast<int>(single_launch));
+  if (single_launch) {
+    auto counter_buffer = GetSyncBuffer(queue_, context_, "ReductionCounter", 1);
+    kernel1.SetArgument(next_arg + 3, counter_buffer());
+  }
+  else {
+    kernel1.SetArgument(next_arg + 3, dot_buffer()); // not used
+  }
+  kernel1.SetArgument(next_arg + 4, dot_buffer());
+  kernel1.SetArgument(next_arg + 5, static_cast<int>(dot_offset));
+
+  // Launches the main kernel
+  auto global1 = std::vector<size_t>{db_["WGS1"]*temp_size};
+  auto local1 = std::vector<size_t>{db_["WGS1"]};
+  if (single_launch) {
+    RunKernel(kernel1, queue_, device_, global1, local1, event_);
+    return;
+  }
+  auto eventWaitList = std::vector<Event>();
+  auto kernelEvent = Event();
+  RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
+  eventWaitList.push_back(kernelEvent);
+
+  // Launches the epilogue kernel of either DOT or NRM2
+  auto kernel2 = Kernel(program_, (do_norm) ? "Xnrm2Epilogue" : "XdotEpilogue");
+  kernel2.SetArgument(0, temp_buffer());
+  kernel2.SetArgument(1, dot_buffer());
+  kernel2.SetArgument(2, static_cast<int>(dot_offset));
+  auto global2 = std::vector<size_t>{db_["WGS2"]};
+  auto local2 = std::vector<size_t>{db_["WGS2"]};
+  RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xaxpydot<half>;
+template class Xaxpydot<float>;
+template class Xaxpydot<double>;
+template class Xaxpydot<float2>;
+template class Xaxpydot<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,46 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xaxpydot routine: the vector update y = alpha * x + y followed by the
+// dot product of the updated y with z, both computed in a single pass over the data. This is a
+// non-BLAS routine. The precision is implemented using a template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XAXPYDOT_H_
+#define CLBLAST_ROUTINES_XAXPYDOT_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xaxpydot: public Routine {
+ public:
+
+  // Constructor
+  Xaxpydot(Queue &queue, EventPointer event, const std::string &name = "AXPYDOT");
+
+  // Templated-precision implementation of the routine. In case of 'do_norm', the Euclidian norm of
+  // the updated y is computed instead and the vector z is not used.
+  void DoAxpydot(const size_t n,
+                 const Buffer<T> &dot_buffer, const size_t dot_offset, const T alpha,
+                 const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                 const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                 const Buffer<T> &z_buffer, const size_t z_offset, const size_t z_inc,
+                 const bool do_norm = false);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XAXPYDOT_H_
+#endif
@@ -0,0 +1,53 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xaxpynrm2 class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xaxpynrm2.hpp"
+
+#include <string>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xaxpynrm2<T>::Xaxpynrm2(Queue &queue, EventPointer event, const std::string &name):
+    Xaxpydot<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xaxpynrm2<T>::DoAxpynrm2(const size_t n,
+                              const Buffer<T> &nrm2_buffer, const size_t nrm2_offset,
+                              const T alpha,
+                              const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                              const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc) {
+  DoAxpydot(n, nrm2_buffer, nrm2_offset, alpha,
+            x_buffer, x_offset, x_inc,
+            y_buffer, y_offset, y_inc,
+            y_buffer, y_offset, y_inc,
+            true);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xaxpynrm2<half>;
+template class Xaxpynrm2<float>;
+template class Xaxpynrm2<double>;
+template class Xaxpynrm2<float2>;
+template class Xaxpynrm2<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,46 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xaxpynrm2 routine: the vector update y = alpha * x + y followed by the
+// Euclidian norm of the updated y, both computed in a single pass over the data. This is a
+// non-BLAS routine. The precision is implemented using a template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XAXPYNRM2_H_
+#define CLBLAST_ROUTINES_XAXPYNRM2_H_
+
+#include "routines/levelx/xaxpydot.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xaxpynrm2: public Xaxpydot<T> {
+ public:
+
+  // Uses the fused AXPY-DOT routine
+  using Xaxpydot<T>::DoAxpydot;
+
+  // Constructor
+  Xaxpynrm2(Queue &queue, EventPointer event, const std::string &name = "AXPYNRM2");
+
+  // Templated-precision implementation of the routine
+  void DoAxpynrm2(const size_t n,
+                  const Buffer<T> &nrm2_buffer, const size_t nrm2_offset, const T alpha,
+                  const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                  const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XAXPYNRM2_H_
+#endif
@@ -0,0 +1,103 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XdotBatched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xdotbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XdotBatched<T>::XdotBatched(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xdot", "ReductionSingleLaunch"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/reduction.opencl"
+    #include "../../kernels/level1/xdot.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XdotBatched<T>::DoDotBatched(const size_t n,
+                                  const Buffer<T> &dot_buffer, const std::vector<size_t> &dot_offsets,
+                                  const Buffer<T> &x_buffer, const std::vector<size_t> &x_offsets, const size_t x_inc,
+                                  const Buffer<T> &y_buffer, const std::vector<size_t> &y_offsets, const size_t y_inc,
+                                  const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (x_offsets.size() != batch_count) ||
+      (y_offsets.size() != batch_count) || (dot_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vectors for validity
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestVectorX(n, x_buffer, x_offsets[batch], x_inc);
+    TestVectorY(n, y_buffer, y_offsets[batch], y_inc);
+    TestVectorScalar(1, dot_buffer, dot_offsets[batch]);
+  }
+
+  // Upload the arguments to the device
+  auto x_offsets_int = std::vector<int>(batch_count);
+  auto y_offsets_int = std::vector<int>(batch_count);
+  auto dot_offsets_int = std::vector<int>(batch_count);
+  for (auto batch = size_t{ 0 }; batch < batch_count; ++batch) {
+    x_offsets_int[batch] = static_cast<int>(x_offsets[batch]);
+    y_offsets_int[batch] = static_cast<int>(y_offsets[batch]);
+    dot_offsets_int[batch] = static_cast<int>(dot_offsets[batch]);
+  }
+  auto x_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  auto y_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  auto dot_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+  x_offsets_device.Write(queue_, batch_count, x_offsets_int);
+  y_offsets_device.Write(queue_, batch_count, y_offsets_int);
+  dot_offsets_device.Write(queue_, batch_count, dot_offsets_int);
+
+  // Retrieves the Xdot kernel from the compiled binary
+  auto kernel = Kernel(program_, "XdotBatched");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, x_buffer());
+  kernel.SetArgument(2, x_offsets_device());
+  kernel.SetArgument(3, static_cast<int>(x_inc));
+  kernel.SetArgument(4, y_buffer());
+  kernel.SetArgument(5, y_offsets_device());
+  kernel.SetArgument(6, static_cast<int>(y_inc));
+  kernel.SetArgument(7, dot_buffer());
+  kernel.SetArgument(8, dot_offsets_device());
+
+  // Launches the kernel: a single work-group per reduction
+  auto global = std::vector<size_t>{db_["WGS1"], batch_count};
+  auto local = std::vector<size_t>{db_["WGS1"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XdotBatched<half>;
+template class XdotBatched<float>;
+template class XdotBatched<double>;
+template class XdotBatched<float2>;
+template class XdotBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
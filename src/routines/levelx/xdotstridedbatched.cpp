@@ -0,0 +1,93 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XdotStridedBatched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xdotstridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XdotStridedBatched<T>::XdotStridedBatched(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xdot", "ReductionSingleLaunch"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/reduction.opencl"
+    #include "../../kernels/level1/xdot.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XdotStridedBatched<T>::DoDotStridedBatched(const size_t n,
+                                                const Buffer<T> &dot_buffer, const size_t dot_offset, const size_t dot_stride,
+                                                const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if (batch_count < 1) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Makes sure the strides are valid
+  if (dot_stride == 0 && batch_count > 1) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the vectors for validity
+  const auto last_batch = batch_count - 1;
+  TestVectorX(n, x_buffer, x_offset + last_batch * x_stride, x_inc);
+  TestVectorY(n, y_buffer, y_offset + last_batch * y_stride, y_inc);
+  TestVectorScalar(1, dot_buffer, dot_offset + last_batch * dot_stride);
+
+  // Retrieves the Xdot kernel from the compiled binary
+  auto kernel = Kernel(program_, "XdotStridedBatched");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, x_buffer());
+  kernel.SetArgument(2, static_cast<int>(x_offset));
+  kernel.SetArgument(3, static_cast<int>(x_inc));
+  kernel.SetArgument(4, static_cast<int>(x_stride));
+  kernel.SetArgument(5, y_buffer());
+  kernel.SetArgument(6, static_cast<int>(y_offset));
+  kernel.SetArgument(7, static_cast<int>(y_inc));
+  kernel.SetArgument(8, static_cast<int>(y_stride));
+  kernel.SetArgument(9, dot_buffer());
+  kernel.SetArgument(10, static_cast<int>(dot_offset));
+  kernel.SetArgument(11, static_cast<int>(dot_stride));
+
+  // Launches the kernel: a single work-group per reduction
+  auto global = std::vector<size_t>{db_["WGS1"], batch_count};
+  auto local = std::vector<size_t>{db_["WGS1"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XdotStridedBatched<half>;
+template class XdotStridedBatched<float>;
+template class XdotStridedBatched<double>;
+template class XdotStridedBatched<float2>;
+template class XdotStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -101,9 +101,15 @@ void XgemmBatched<T>::DoGemmBatched(const Layout layout, const Transpose a_trans
 
   // Selects which version of the batched GEMM to run
   if (do_gemm_direct) { // single generic kernel
+    auto a_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+    auto b_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+    auto c_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
+    a_offsets_device.Write(queue_, batch_count, a_offsets_int);
+    b_offsets_device.Write(queue_, batch_count, b_offsets_int);
+    c_offsets_device.Write(queue_, batch_count, c_offsets_int);
     BatchedGemmDirect(m, n, k, alphas_device,
-                      a_buffer, a_offsets_int, a_ld, b_buffer, b_offsets_int, b_ld,
-                      betas_device, c_buffer, c_offsets_int, c_ld,
+                      a_buffer, a_offsets_device, a_ld, b_buffer, b_offsets_device, b_ld,
+                      betas_device, c_buffer, c_offsets_device, c_ld,
                       a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
                       batch_count);
   }
@@ -116,6 +122,51 @@ void XgemmBatched<T>::DoGemmBatched(const Layout layout, const Transpose a_trans
   }
 }
 
+// =================================================================================================
+
+// As above, but with all per-batch arguments already residing on the device
+template <typename T>
+void XgemmBatched<T>::DoGemmBatchedDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const Buffer<T> &alphas,
+                                          const Buffer<T> & a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                                          const Buffer<T> & b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
+                                          const Buffer<T> &betas,
+                                          const Buffer<T> & c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
+                                          const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if (batch_count < 1) { throw BLASError(StatusCode::kInvalidBatchCount); }
+
+  // Computes the transpose/conjugate options and sets the a/b/c sizes based on that. The offsets
+  // are unknown on the host, so only the direct kernel can be used: the indirect kernel would
+  // require a host-side decision on the temporary buffers and their (allocated) storage.
+  bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
+  size_t a_one, a_two, b_one, b_two, c_one, c_two;
+  Xgemm<T>::ProcessArguments(layout, a_transpose, b_transpose, m, n, k,
+                             a_one, a_two, b_one, b_two, c_one, c_two,
+                             a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                             0);
+
+  // Tests the matrices and the per-batch arguments for validity. The offsets themselves are stored
+  // on the device and can thus only be tested from a perspective of the first batch.
+  TestMatrixA(a_one, a_two, a_buffer, 0, a_ld, false); // don't test for invalid LD
+  TestMatrixB(b_one, b_two, b_buffer, 0, b_ld, false); // don't test for invalid LD
+  TestMatrixC(c_one, c_two, c_buffer, 0, c_ld);
+  TestVectorScalar(batch_count, alphas, 0);
+  TestVectorScalar(batch_count, betas, 0);
+  TestVectorIndex(batch_count, a_offsets, 0);
+  TestVectorIndex(batch_count, b_offsets, 0);
+  TestVectorIndex(batch_count, c_offsets, 0);
+
+  // Runs the direct version of the batched GEMM
+  BatchedGemmDirect(m, n, k, alphas,
+                    a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld,
+                    betas, c_buffer, c_offsets, c_ld,
+                    a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                    batch_count);
+}
+
 
 // =================================================================================================
 
@@ -266,22 +317,14 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
 template <typename T>
 void XgemmBatched<T>::BatchedGemmDirect(const size_t m, const size_t n, const size_t k,
                                         const Buffer<T> &alphas,
-                                        const Buffer<T> &a_buffer, const std::vector<int> &a_offsets, const size_t a_ld,
-                                        const Buffer<T> &b_buffer, const std::vector<int> &b_offsets, const size_t b_ld,
+                                        const Buffer<T> &a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                                        const Buffer<T> &b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
                                         const Buffer<T> &betas,
-                                        const Buffer<T> &c_buffer, const std::vector<int> &c_offsets, const size_t c_ld,
+                                        const Buffer<T> &c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
                                         const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                                         const bool a_conjugate, const bool b_conjugate,
                                         const size_t batch_count) {
 
-  // Uploads the offsets to the device
-  auto a_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
-  auto b_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
-  auto c_offsets_device = Buffer<int>(context_, BufferAccess::kReadWrite, batch_count);
-  a_offsets_device.Write(queue_, batch_count, a_offsets);
-  b_offsets_device.Write(queue_, batch_count, b_offsets);
-  c_offsets_device.Write(queue_, batch_count, c_offsets);
-
   // Retrieves the proper XgemmDirect kernel from the compiled binary
   const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectBatchedTT" : "XgemmDirectBatchedTN") :
                                        (b_do_transpose ? "XgemmDirectBatchedNT" : "XgemmDirectBatchedNN");
@@ -294,13 +337,13 @@ void XgemmBatched<T>::BatchedGemmDirect(const size_t m, const size_t n, const si
   kernel.SetArgument(3, alphas());
   kernel.SetArgument(4, betas());
   kernel.SetArgument(5, a_buffer());
-  kernel.SetArgument(6, a_offsets_device());
+  kernel.SetArgument(6, a_offsets());
   kernel.SetArgument(7, static_cast<int>(a_ld));
   kernel.SetArgument(8, b_buffer());
-  kernel.SetArgument(9, b_offsets_device());
+  kernel.SetArgument(9, b_offsets());
   kernel.SetArgument(10, static_cast<int>(b_ld));
   kernel.SetArgument(11, c_buffer());
-  kernel.SetArgument(12, c_offsets_device());
+  kernel.SetArgument(12, c_offsets());
   kernel.SetArgument(13, static_cast<int>(c_ld));
   kernel.SetArgument(14, static_cast<int>(c_do_transpose));
   kernel.SetArgument(15, static_cast<int>(a_conjugate));
@@ -39,6 +39,17 @@ class XgemmBatched: public Routine {
                      const Buffer<T> & c_buffer, const std::vector<size_t> &c_offsets, const size_t c_ld,
                      const size_t batch_count);
 
+  // As above, but with the scalars and offsets already stored in device buffers. This always uses
+  // the direct kernel and requires no host-device transfers nor any additional allocations.
+  void DoGemmBatchedDevice(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                           const size_t m, const size_t n, const size_t k,
+                           const Buffer<T> &alphas,
+                           const Buffer<T> & a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                           const Buffer<T> & b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
+                           const Buffer<T> &betas,
+                           const Buffer<T> & c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
+                           const size_t batch_count);
+
   // Indirect version of batched GEMM (with pre and post-processing kernels)
   void BatchedGemmIndirect(const size_t m, const size_t n, const size_t k,
                            const Buffer<T> &alphas,
@@ -56,10 +67,10 @@ class XgemmBatched: public Routine {
   // Direct version of batched GEMM (no pre and post-processing kernels)
   void BatchedGemmDirect(const size_t m, const size_t n, const size_t k,
                          const Buffer<T> &alphas,
-                         const Buffer<T> &a_buffer, const std::vector<int> &a_offsets, const size_t a_ld,
-                         const Buffer<T> &b_buffer, const std::vector<int> &b_offsets, const size_t b_ld,
+                         const Buffer<T> &a_buffer, const Buffer<int> &a_offsets, const size_t a_ld,
+                         const Buffer<T> &b_buffer, const Buffer<int> &b_offsets, const size_t b_ld,
                          const Buffer<T> &betas,
-                         const Buffer<T> &c_buffer, const std::vector<int> &c_offsets, const size_t c_ld,
+                         const Buffer<T> &c_buffer, const Buffer<int> &c_offsets, const size_t c_ld,
                          const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                          const bool a_conjugate, const bool b_conjugate,
                          const size_t batch_count);
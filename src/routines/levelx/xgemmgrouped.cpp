@@ -0,0 +1,141 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmGrouped class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmgrouped.hpp"
+#include "routines/level3/xgemm.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemmGrouped<T>::XgemmGrouped(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"XgemmDirect"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level3/xgemm_direct_part1.opencl"
+    #include "../../kernels/level3/xgemm_direct_part2.opencl"
+    #include "../../kernels/level3/xgemm_direct_part3.opencl"
+    , // separated in multiple parts to prevent C1091 in MSVC 2013
+    #include "../../kernels/level3/xgemm_direct_batched.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine. All problems are computed by a single launch of the direct GEMM kernel: the
+// work-group tiles of all problems are concatenated into one flat list and each work-group finds
+// its problem and tile on the device. The indirect kernel is not used here, since its padding and
+// transposing pre-processing steps would have to be done per problem.
+template <typename T>
+void XgemmGrouped<T>::DoGemmGrouped(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                                    const std::vector<size_t> &ms, const std::vector<size_t> &ns,
+                                    const std::vector<size_t> &ks,
+                                    const std::vector<T> &alphas,
+                                    const Buffer<T> & a_buffer, const std::vector<size_t> &a_offsets,
+                                    const std::vector<size_t> &a_lds,
+                                    const Buffer<T> & b_buffer, const std::vector<size_t> &b_offsets,
+                                    const std::vector<size_t> &b_lds,
+                                    const std::vector<T> &betas,
+                                    const Buffer<T> & c_buffer, const std::vector<size_t> &c_offsets,
+                                    const std::vector<size_t> &c_lds,
+                                    const size_t group_count) {
+
+  // Tests for a valid group count
+  if ((group_count < 1) || (ms.size() != group_count) || (ns.size() != group_count) ||
+      (ks.size() != group_count) || (alphas.size() != group_count) || (betas.size() != group_count) ||
+      (a_offsets.size() != group_count) || (b_offsets.size() != group_count) || (c_offsets.size() != group_count) ||
+      (a_lds.size() != group_count) || (b_lds.size() != group_count) || (c_lds.size() != group_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Describes each problem as a record of integers, see 'xgemm_direct_batched.opencl' for the format.
+  // The number of work-group tiles of all problems are prefix-summed to form one flat list of tiles.
+  const auto record_size = size_t{10};
+  auto problems = std::vector<int>(group_count * record_size);
+  auto num_tiles = size_t{0};
+  bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
+  for (auto group = size_t{0}; group < group_count; ++group) {
+
+    // Computes the transpose/conjugate options and sets the a/b/c sizes based on that
+    size_t a_one, a_two, b_one, b_two, c_one, c_two;
+    Xgemm<T>::ProcessArguments(layout, a_transpose, b_transpose, ms[group], ns[group], ks[group],
+                               a_one, a_two, b_one, b_two, c_one, c_two,
+                               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                               0);
+
+    // Tests the matrices of this problem for validity
+    TestMatrixA(a_one, a_two, a_buffer, a_offsets[group], a_lds[group]);
+    TestMatrixB(b_one, b_two, b_buffer, b_offsets[group], b_lds[group]);
+    TestMatrixC(c_one, c_two, c_buffer, c_offsets[group], c_lds[group]);
+
+    // Stores the problem description
+    const auto record = group * record_size;
+    problems[record + 0] = static_cast<int>(num_tiles);
+    problems[record + 1] = static_cast<int>(ms[group]);
+    problems[record + 2] = static_cast<int>(ns[group]);
+    problems[record + 3] = static_cast<int>(ks[group]);
+    problems[record + 4] = static_cast<int>(a_offsets[group]);
+    problems[record + 5] = static_cast<int>(a_lds[group]);
+    problems[record + 6] = static_cast<int>(b_offsets[group]);
+    problems[record + 7] = static_cast<int>(b_lds[group]);
+    problems[record + 8] = static_cast<int>(c_offsets[group]);
+    problems[record + 9] = static_cast<int>(c_lds[group]);
+    num_tiles += CeilDiv(ms[group], db_["WGD"]) * CeilDiv(ns[group], db_["WGD"]);
+  }
+
+  // Uploads the problem descriptions and the scalar arguments to the device
+  auto problems_device = Buffer<int>(context_, BufferAccess::kReadWrite, problems.size());
+  auto alphas_device = Buffer<T>(context_, BufferAccess::kReadWrite, group_count);
+  auto betas_device = Buffer<T>(context_, BufferAccess::kReadWrite, group_count);
+  problems_device.Write(queue_, problems.size(), problems);
+  alphas_device.Write(queue_, group_count, alphas);
+  betas_device.Write(queue_, group_count, betas);
+
+  // Retrieves the proper XgemmDirectGrouped kernel from the compiled binary
+  const auto name = (a_do_transpose) ? (b_do_transpose ? "XgemmDirectGroupedTT" : "XgemmDirectGroupedTN") :
+                                       (b_do_transpose ? "XgemmDirectGroupedNT" : "XgemmDirectGroupedNN");
+  auto kernel = Kernel(program_, name);
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(group_count));
+  kernel.SetArgument(1, problems_device());
+  kernel.SetArgument(2, alphas_device());
+  kernel.SetArgument(3, betas_device());
+  kernel.SetArgument(4, a_buffer());
+  kernel.SetArgument(5, b_buffer());
+  kernel.SetArgument(6, c_buffer());
+  kernel.SetArgument(7, static_cast<int>(c_do_transpose));
+  kernel.SetArgument(8, static_cast<int>(a_conjugate));
+  kernel.SetArgument(9, static_cast<int>(b_conjugate));
+
+  // Computes the global and local thread sizes: one work-group per tile of any of the problems
+  const auto global = std::vector<size_t>{num_tiles * db_["MDIMCD"], db_["NDIMCD"]};
+  const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"]};
+
+  // Launches the kernel
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmGrouped<half>;
+template class XgemmGrouped<float>;
+template class XgemmGrouped<double>;
+template class XgemmGrouped<float2>;
+template class XgemmGrouped<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,52 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmGrouped routine. This is a non-blas grouped version of GEMM: a
+// batched GEMM in which every problem has its own sizes (m, n, k) and leading dimensions.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMGROUPED_H_
+#define CLBLAST_ROUTINES_XGEMMGROUPED_H_
+
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemmGrouped: public Routine {
+ public:
+
+  // Constructor
+  XgemmGrouped(Queue &queue, EventPointer event, const std::string &name = "GEMMGROUPED");
+
+  // Templated-precision implementation of the routine
+  void DoGemmGrouped(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                     const std::vector<size_t> &ms, const std::vector<size_t> &ns,
+                     const std::vector<size_t> &ks,
+                     const std::vector<T> &alphas,
+                     const Buffer<T> & a_buffer, const std::vector<size_t> &a_offsets,
+                     const std::vector<size_t> &a_lds,
+                     const Buffer<T> & b_buffer, const std::vector<size_t> &b_offsets,
+                     const std::vector<size_t> &b_lds,
+                     const std::vector<T> &betas,
+                     const Buffer<T> & c_buffer, const std::vector<size_t> &c_offsets,
+                     const std::vector<size_t> &c_lds,
+                     const size_t group_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMGROUPED_H_
+#endif
@@ -0,0 +1,288 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmStrassen class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmstrassen.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor and retrieves the recursion parameters from the
+// separate 'GemmStrassen' database (the base class's database is shared with the regular GEMM)
+template <typename T>
+XgemmStrassen<T>::XgemmStrassen(Queue &queue, EventPointer event, const std::string &name):
+    Xgemm<T>(queue, event, name) {
+  const auto kernel_names = std::vector<std::string>{"GemmStrassen"};
+  Databases db(kernel_names);
+  Routine::InitDatabase(device_, kernel_names, PrecisionValue<T>(), {}, db);
+  min_size_ = db["XGEMM_STRASSEN_MIN_SIZE"];
+  max_depth_ = db["XGEMM_STRASSEN_MAX_DEPTH"];
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemmStrassen<T>::DoGemmStrassen(const Layout layout,
+                                      const Transpose a_transpose, const Transpose b_transpose,
+                                      const size_t m, const size_t n, const size_t k,
+                                      const T alpha,
+                                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                                      const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                                      const T beta,
+                                      const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                                      const Buffer<T> &temp_buffer, const bool temp_buffer_provided) {
+
+  // Makes sure all dimensions are larger than zero and computes the sizes of the matrices in memory
+  bool a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate;
+  size_t a_one, a_two, b_one, b_two, c_one, c_two;
+  Xgemm<T>::ProcessArguments(layout, a_transpose, b_transpose, m, n, k,
+                             a_one, a_two, b_one, b_two, c_one, c_two,
+                             a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                             0);
+
+  // Tests the matrices for validity as a whole: the recursion only touches sub-matrices
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
+  TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
+
+  // Creates the workspace for the temporary sub-matrices or verifies that the provided one is large
+  // enough. Note that we use 'c_buffer' in case when no workspace is needed, but that's just to
+  // make it compile: it is never used.
+  const auto temp_size = GetTempSize(m, n, k, min_size_, max_depth_);
+  if (temp_buffer_provided && temp_buffer.GetSize() < temp_size * sizeof(T)) {
+    throw BLASError(StatusCode::kInsufficientMemoryTemp);
+  }
+  const auto temp_buffer_all = (temp_buffer_provided) ? temp_buffer :
+                               ((temp_size > 0) ? Buffer<T>(context_, temp_size) : c_buffer);
+
+  // The recursion is implemented for column-major matrices only. In case of row-major, the
+  // transposed problem C^T = op(B)^T * op(A)^T is computed in column-major layout instead: this
+  // comes down to swapping A and B while keeping the transpose options as they are.
+  auto events = std::vector<Event>();
+  if (layout == Layout::kColMajor) {
+    Recurse(a_transpose, b_transpose, m, n, k, alpha,
+            a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+            c_buffer, c_offset, c_ld, temp_buffer_all, 0, 0, events, true);
+  }
+  else {
+    Recurse(b_transpose, a_transpose, n, m, k, alpha,
+            b_buffer, b_offset, b_ld, a_buffer, a_offset, a_ld, beta,
+            c_buffer, c_offset, c_ld, temp_buffer_all, 0, 0, events, true);
+  }
+}
+
+// =================================================================================================
+
+// Computes one level of the Strassen-Winograd algorithm, following the schedule of Boyer et al.
+// ("Memory efficient scheduling of Strassen-Winograd's matrix multiplication algorithm", 2009)
+// which requires just two temporary sums (S, T) and two temporary products (M, U) per level.
+template <typename T>
+void XgemmStrassen<T>::Recurse(const Transpose a_transpose, const Transpose b_transpose,
+                               const size_t m, const size_t n, const size_t k,
+                               const T alpha,
+                               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                               const T beta,
+                               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                               const Buffer<T> &temp_buffer, const size_t temp_offset, const size_t depth,
+                               std::vector<Event> &events, const bool last) {
+
+  // Runs the regular GEMM at the leaves of the recursion
+  if (depth >= max_depth_ || !UseRecursion(m, n, k, min_size_)) {
+    LeafGemm(a_transpose, b_transpose, m, n, k, alpha,
+             a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+             c_buffer, c_offset, c_ld, events, last);
+    return;
+  }
+
+  // Sizes of the quadrants: in case of odd sizes the last row/column is handled separately
+  const auto m2 = m / 2;
+  const auto n2 = n / 2;
+  const auto k2 = k / 2;
+  const auto a_no_transpose = (a_transpose == Transpose::kNo);
+  const auto b_no_transpose = (b_transpose == Transpose::kNo);
+
+  // Computes the offsets of the quadrants of op(A), op(B), and C
+  const auto a11 = a_offset;
+  const auto a12 = a_offset + ((a_no_transpose) ? k2 * a_ld : k2);
+  const auto a21 = a_offset + ((a_no_transpose) ? m2 : m2 * a_ld);
+  const auto a22 = a12 + a21 - a_offset;
+  const auto b11 = b_offset;
+  const auto b12 = b_offset + ((b_no_transpose) ? n2 * b_ld : n2);
+  const auto b21 = b_offset + ((b_no_transpose) ? k2 : k2 * b_ld);
+  const auto b22 = b12 + b21 - b_offset;
+  const auto c11 = c_offset;
+  const auto c12 = c_offset + n2 * c_ld;
+  const auto c21 = c_offset + m2;
+  const auto c22 = c12 + m2;
+
+  // The sums of quadrants are computed as stored in memory (i.e. not transposed), such that the
+  // temporary sums S and T are used with the same transpose options as A and B
+  const auto a_one = (a_no_transpose) ? m2 : k2;
+  const auto a_two = (a_no_transpose) ? k2 : m2;
+  const auto b_one = (b_no_transpose) ? k2 : n2;
+  const auto b_two = (b_no_transpose) ? n2 : k2;
+
+  // Offsets of the temporary matrices in the workspace, followed by the workspace of the next level
+  const auto s = temp_offset;
+  const auto t = s + m2 * k2;
+  const auto p = t + k2 * n2;
+  const auto u = p + m2 * n2;
+  const auto next_temp_offset = u + m2 * n2;
+  const auto &temp = temp_buffer;
+  const auto one = ConstantOne<T>();
+  const auto zero = ConstantZero<T>();
+  const auto neg_one = ConstantNegOne<T>();
+
+  // Peels off the last column and row of C in case of odd 'n' or 'm' using the regular GEMM. For an
+  // odd 'k' the rank-1 update of the remaining even-sized part is done first, also applying 'beta'.
+  auto beta_even = beta;
+  if (n % 2 == 1) {
+    LeafGemm(a_transpose, b_transpose, 2 * m2, 1, k, alpha,
+             a_buffer, a_offset, a_ld,
+             b_buffer, b_offset + ((b_no_transpose) ? 2 * n2 * b_ld : 2 * n2), b_ld, beta,
+             c_buffer, c_offset + 2 * n2 * c_ld, c_ld, events, false);
+  }
+  if (m % 2 == 1) {
+    LeafGemm(a_transpose, b_transpose, 1, n, k, alpha,
+             a_buffer, a_offset + ((a_no_transpose) ? 2 * m2 : 2 * m2 * a_ld), a_ld,
+             b_buffer, b_offset, b_ld, beta,
+             c_buffer, c_offset + 2 * m2, c_ld, events, false);
+  }
+  if (k % 2 == 1) {
+    LeafGemm(a_transpose, b_transpose, 2 * m2, 2 * n2, 1, alpha,
+             a_buffer, a_offset + ((a_no_transpose) ? 2 * k2 * a_ld : 2 * k2), a_ld,
+             b_buffer, b_offset + ((b_no_transpose) ? 2 * k2 : 2 * k2 * b_ld), b_ld, beta,
+             c_buffer, c_offset, c_ld, events, false);
+    beta_even = one;
+  }
+
+  // C11 = beta * C11 + alpha * (A11 * B11 + A12 * B21), keeping P = alpha * A11 * B11 for later
+  Recurse(a_transpose, b_transpose, m2, n2, k2, alpha, a_buffer, a11, a_ld, b_buffer, b11, b_ld,
+          zero, temp, p, m2, temp, next_temp_offset, depth + 1, events, false);
+  MatrixAdd(m2, n2, one, temp, p, m2, beta_even, c_buffer, c11, c_ld, c_buffer, c11, c_ld, events);
+  Recurse(a_transpose, b_transpose, m2, n2, k2, alpha, a_buffer, a12, a_ld, b_buffer, b21, b_ld,
+          one, c_buffer, c11, c_ld, temp, next_temp_offset, depth + 1, events, false);
+
+  // S = A11 - A21, T = B22 - B12, U = alpha * S * T, C21 = beta * C21 + U, C22 = beta * C22 + U
+  MatrixAdd(a_one, a_two, one, a_buffer, a11, a_ld, neg_one, a_buffer, a21, a_ld, temp, s, a_one, events);
+  MatrixAdd(b_one, b_two, one, b_buffer, b22, b_ld, neg_one, b_buffer, b12, b_ld, temp, t, b_one, events);
+  Recurse(a_transpose, b_transpose, m2, n2, k2, alpha, temp, s, a_one, temp, t, b_one,
+          zero, temp, u, m2, temp, next_temp_offset, depth + 1, events, false);
+  MatrixAdd(m2, n2, one, temp, u, m2, beta_even, c_buffer, c21, c_ld, c_buffer, c21, c_ld, events);
+  MatrixAdd(m2, n2, one, temp, u, m2, beta_even, c_buffer, c22, c_ld, c_buffer, c22, c_ld, events);
+
+  // S = A21 + A22, T = B12 - B11, U = alpha * S * T, C22 = C22 + U, C12 = beta * C12 + U
+  MatrixAdd(a_one, a_two, one, a_buffer, a21, a_ld, one, a_buffer, a22, a_ld, temp, s, a_one, events);
+  MatrixAdd(b_one, b_two, one, b_buffer, b12, b_ld, neg_one, b_buffer, b11, b_ld, temp, t, b_one, events);
+  Recurse(a_transpose, b_transpose, m2, n2, k2, alpha, temp, s, a_one, temp, t, b_one,
+          zero, temp, u, m2, temp, next_temp_offset, depth + 1, events, false);
+  MatrixAdd(m2, n2, one, temp, u, m2, one, c_buffer, c22, c_ld, c_buffer, c22, c_ld, events);
+  MatrixAdd(m2, n2, one, temp, u, m2, beta_even, c_buffer, c12, c_ld, c_buffer, c12, c_ld, events);
+
+  // S = S - A11, T = B22 - T, P = P + alpha * S * T, and adds P to C12, C21, and C22
+  MatrixAdd(a_one, a_two, one, temp, s, a_one, neg_one, a_buffer, a11, a_ld, temp, s, a_one, events);
+  MatrixAdd(b_one, b_two, one, b_buffer, b22, b_ld, neg_one, temp, t, b_one, temp, t, b_one, events);
+  Recurse(a_transpose, b_transpose, m2, n2, k2, alpha, temp, s, a_one, temp, t, b_one,
+          one, temp, p, m2, temp, next_temp_offset, depth + 1, events, false);
+  MatrixAdd(m2, n2, one, temp, p, m2, one, c_buffer, c12, c_ld, c_buffer, c12, c_ld, events);
+  MatrixAdd(m2, n2, one, temp, p, m2, one, c_buffer, c21, c_ld, c_buffer, c21, c_ld, events);
+  MatrixAdd(m2, n2, one, temp, p, m2, one, c_buffer, c22, c_ld, c_buffer, c22, c_ld, events);
+
+  // S = A12 - S, C12 = C12 + alpha * S * B22
+  MatrixAdd(a_one, a_two, one, a_buffer, a12, a_ld, neg_one, temp, s, a_one, temp, s, a_one, events);
+  Recurse(a_transpose, b_transpose, m2, n2, k2, alpha, temp, s, a_one, b_buffer, b22, b_ld,
+          one, c_buffer, c12, c_ld, temp, next_temp_offset, depth + 1, events, false);
+
+  // T = B21 - T, C21 = C21 + alpha * A22 * T. This is the last operation of this level.
+  MatrixAdd(b_one, b_two, one, b_buffer, b21, b_ld, neg_one, temp, t, b_one, temp, t, b_one, events);
+  Recurse(a_transpose, b_transpose, m2, n2, k2, alpha, a_buffer, a22, a_ld, temp, t, b_one,
+          one, c_buffer, c21, c_ld, temp, next_temp_offset, depth + 1, events, last);
+}
+
+// =================================================================================================
+
+// Runs the regular GEMM routine after the previous operation has completed. Only the very last
+// operation of the routine signals the user's event.
+template <typename T>
+void XgemmStrassen<T>::LeafGemm(const Transpose a_transpose, const Transpose b_transpose,
+                                const size_t m, const size_t n, const size_t k,
+                                const T alpha,
+                                const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                                const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                                const T beta,
+                                const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                                std::vector<Event> &events, const bool last) {
+  auto event = Event();
+  const auto user_event = event_;
+  if (!last) { event_ = event.pointer(); }
+  DoGemm(Layout::kColMajor, a_transpose, b_transpose, m, n, k, alpha,
+         a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+         c_buffer, c_offset, c_ld, Buffer<T>(0), false, false, false, events);
+  event_ = user_event;
+  events = std::vector<Event>{event};
+}
+
+// Launches the matrix addition kernel after the previous operation has completed
+template <typename T>
+void XgemmStrassen<T>::MatrixAdd(const size_t one, const size_t two,
+                                 const T alpha, const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_ld,
+                                 const T beta, const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_ld,
+                                 const Buffer<T> &z_buffer, const size_t z_offset, const size_t z_ld,
+                                 std::vector<Event> &events) {
+
+  // Retrieves the kernel from its own program, which is only compiled when the recursion is used
+  const auto program = GetProgram("ADD", {
+    #include "../../kernels/level3/level3.opencl"
+    #include "../../kernels/level3/xgemm_strassen.opencl"
+  });
+  auto kernel = Kernel(program, "XgemmStrassenAdd");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(one));
+  kernel.SetArgument(1, static_cast<int>(two));
+  kernel.SetArgument(2, GetRealArg(alpha));
+  kernel.SetArgument(3, x_buffer());
+  kernel.SetArgument(4, static_cast<int>(x_offset));
+  kernel.SetArgument(5, static_cast<int>(x_ld));
+  kernel.SetArgument(6, GetRealArg(beta));
+  kernel.SetArgument(7, y_buffer());
+  kernel.SetArgument(8, static_cast<int>(y_offset));
+  kernel.SetArgument(9, static_cast<int>(y_ld));
+  kernel.SetArgument(10, z_buffer());
+  kernel.SetArgument(11, static_cast<int>(z_offset));
+  kernel.SetArgument(12, static_cast<int>(z_ld));
+
+  // Uses the common padding kernel's thread configuration. This is allowed, since the addition
+  // kernel uses the same parameters.
+  const auto global = std::vector<size_t>{Ceil(CeilDiv(one, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+                                          Ceil(CeilDiv(two, db_["PAD_WPTY"]), db_["PAD_DIMY"])};
+  const auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+  auto event = Event();
+  RunKernel(kernel, queue_, device_, global, local, event.pointer(), events);
+  events = std::vector<Event>{event};
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmStrassen<half>;
+template class XgemmStrassen<float>;
+template class XgemmStrassen<double>;
+template class XgemmStrassen<float2>;
+template class XgemmStrassen<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,119 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmStrassen routine: a GEMM variant for large matrices which applies
+// the Strassen-Winograd algorithm recursively on top of the regular GEMM routine. At each level of
+// recursion, a product is computed with 7 half-sized products instead of 8 and with 15 matrix
+// additions. The recursion stops at the leaf size or depth as given by the tuning database, after
+// which the regular Xgemm routine is used. Odd dimensions are handled by peeling off the last
+// row, column, and/or rank-1 update. Note that this algorithm is less accurate than regular GEMM:
+// the error bound grows with the depth of the recursion.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMSTRASSEN_H_
+#define CLBLAST_ROUTINES_XGEMMSTRASSEN_H_
+
+#include <algorithm>
+#include <vector>
+
+#include "routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemmStrassen: public Xgemm<T> {
+ public:
+
+  // Uses methods and variables the regular Xgemm routine
+  using Xgemm<T>::queue_;
+  using Xgemm<T>::context_;
+  using Xgemm<T>::device_;
+  using Xgemm<T>::program_;
+  using Xgemm<T>::GetProgram;
+  using Xgemm<T>::db_;
+  using Xgemm<T>::event_;
+  using Xgemm<T>::DoGemm;
+
+  // Computes the size of the workspace required for the temporary sub-matrices, summed over all
+  // levels of recursion. This returns zero if no recursion is done at all.
+  static size_t GetTempSize(size_t m, size_t n, size_t k,
+                            const size_t min_size, const size_t max_depth) {
+    auto temp_size = size_t{0};
+    for (auto depth = size_t{0}; depth < max_depth; ++depth) {
+      if (!UseRecursion(m, n, k, min_size)) { break; }
+      m /= 2;
+      n /= 2;
+      k /= 2;
+      temp_size += m * k + k * n + 2 * m * n;
+    }
+    return temp_size;
+  }
+
+  // Constructor
+  XgemmStrassen(Queue &queue, EventPointer event, const std::string &name = "GEMMSTRASSEN");
+
+  // Templated-precision implementation of the routine
+  void DoGemmStrassen(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const T alpha,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                      const T beta,
+                      const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                      const Buffer<T> &temp_buffer = Buffer<T>(0), const bool temp_buffer_provided = false);
+
+ private:
+
+  // Tuning parameters: the minimum size of all of m, n, and k to recurse and the maximum depth
+  size_t min_size_;
+  size_t max_depth_;
+
+  // Whether or not another level of recursion is done for the given sizes
+  static bool UseRecursion(const size_t m, const size_t n, const size_t k, const size_t min_size) {
+    const auto min_dimension = std::min(std::min(m, n), k);
+    return min_dimension >= std::max(min_size, size_t{2});
+  }
+
+  // Recursive implementation in column-major layout. All operations are chained through 'events',
+  // and the last operation of the top-level call (indicated by 'last') signals the user's event.
+  void Recurse(const Transpose a_transpose, const Transpose b_transpose,
+               const size_t m, const size_t n, const size_t k,
+               const T alpha,
+               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+               const T beta,
+               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+               const Buffer<T> &temp_buffer, const size_t temp_offset, const size_t depth,
+               std::vector<Event> &events, const bool last);
+
+  // Runs the regular GEMM on column-major (sub-)matrices as part of the chain of operations
+  void LeafGemm(const Transpose a_transpose, const Transpose b_transpose,
+                const size_t m, const size_t n, const size_t k,
+                const T alpha,
+                const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                std::vector<Event> &events, const bool last);
+
+  // Computes Z = alpha * X + beta * Y for column-major (sub-)matrices of size 'one' by 'two'
+  void MatrixAdd(const size_t one, const size_t two,
+                 const T alpha, const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_ld,
+                 const T beta, const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_ld,
+                 const Buffer<T> &z_buffer, const size_t z_offset, const size_t z_ld,
+                 std::vector<Event> &events);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMSTRASSEN_H_
+#endif
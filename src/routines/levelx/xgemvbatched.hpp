@@ -0,0 +1,47 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemvBatched routine. This is a non-blas batched version of GEMV. The
+// entire batch runs as a single kernel launch, using the 'XgemvBatched' tuning parameters.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMVBATCHED_H_
+#define CLBLAST_ROUTINES_XGEMVBATCHED_H_
+
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemvBatched: public Routine {
+ public:
+
+  // Constructor
+  XgemvBatched(Queue &queue, EventPointer event, const std::string &name = "GEMVBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoGemvBatched(const Layout layout, const Transpose a_transpose,
+                     const size_t m, const size_t n,
+                     const std::vector<T> &alphas,
+                     const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets, const size_t a_ld,
+                     const Buffer<T> &x_buffer, const std::vector<size_t> &x_offsets, const size_t x_inc,
+                     const std::vector<T> &betas,
+                     const Buffer<T> &y_buffer, const std::vector<size_t> &y_offsets, const size_t y_inc,
+                     const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMVBATCHED_H_
+#endif
@@ -0,0 +1,113 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemvStridedBatched class (see the header for information about the
+// class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemvstridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemvStridedBatched<T>::XgemvStridedBatched(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"XgemvBatched"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level2/xgemv.opencl"
+    #include "../../kernels/level2/xgemv_batched.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemvStridedBatched<T>::DoGemvStridedBatched(const Layout layout, const Transpose a_transpose,
+                                                  const size_t m, const size_t n, const T alpha,
+                                                  const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride,
+                                                  const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                  const T beta,
+                                                  const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride,
+                                                  const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if (batch_count < 1) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Computes whether or not the matrix has an alternative layout (row or column-major)
+  const auto a_altlayout = (layout == Layout::kRowMajor);
+  const auto a_one = (a_altlayout) ? n : m;
+  const auto a_two = (a_altlayout) ? m : n;
+
+  // Swap m and n if the matrix is transposed
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto m_real = (a_transposed) ? n : m;
+  const auto n_real = (a_transposed) ? m : n;
+
+  // Determines whether the kernel needs to perform rotated access ('^' is the XOR operator)
+  const auto a_rotated = a_transposed ^ a_altlayout;
+
+  // In case of complex data-types, the transpose can also become a conjugate transpose
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+
+  // Tests the matrices and the vectors for validity
+  const auto last_batch = batch_count - 1;
+  TestStridedBatchedMatrixA(a_one, a_two, a_buffer, a_offset, a_stride, batch_count, a_ld);
+  TestVectorX(n_real, x_buffer, x_offset + last_batch * x_stride, x_inc);
+  TestVectorY(m_real, y_buffer, y_offset + last_batch * y_stride, y_inc);
+
+  // Retrieves the XgemvStridedBatched kernel from the compiled binary
+  auto kernel = Kernel(program_, "XgemvStridedBatched");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(m_real));
+  kernel.SetArgument(1, static_cast<int>(n_real));
+  kernel.SetArgument(2, GetRealArg(alpha));
+  kernel.SetArgument(3, GetRealArg(beta));
+  kernel.SetArgument(4, static_cast<int>(a_rotated));
+  kernel.SetArgument(5, a_buffer());
+  kernel.SetArgument(6, static_cast<int>(a_offset));
+  kernel.SetArgument(7, static_cast<int>(a_ld));
+  kernel.SetArgument(8, static_cast<int>(a_stride));
+  kernel.SetArgument(9, x_buffer());
+  kernel.SetArgument(10, static_cast<int>(x_offset));
+  kernel.SetArgument(11, static_cast<int>(x_inc));
+  kernel.SetArgument(12, static_cast<int>(x_stride));
+  kernel.SetArgument(13, y_buffer());
+  kernel.SetArgument(14, static_cast<int>(y_offset));
+  kernel.SetArgument(15, static_cast<int>(y_inc));
+  kernel.SetArgument(16, static_cast<int>(y_stride));
+  kernel.SetArgument(17, static_cast<int>(a_conjugate));
+
+  // Launches the kernel: the batch is mapped onto the second dimension
+  const auto m_ceiled = Ceil(m_real, db_["WGS4"]*db_["WPT4"]);
+  auto global = std::vector<size_t>{m_ceiled / db_["WPT4"], batch_count};
+  auto local = std::vector<size_t>{db_["WGS4"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemvStridedBatched<half>;
+template class XgemvStridedBatched<float>;
+template class XgemvStridedBatched<double>;
+template class XgemvStridedBatched<float2>;
+template class XgemvStridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
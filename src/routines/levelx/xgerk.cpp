@@ -0,0 +1,91 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgerk class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgerk.hpp"
+#include "routines/level2/xger.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xgerk<T>::Xgerk(Queue &queue, EventPointer event, const std::string &name):
+    Xgemm<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xgerk<T>::DoGerk(const Layout layout,
+                      const size_t m, const size_t n, const size_t k,
+                      const T alpha,
+                      const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_ld,
+                      const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_ld,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0) || (k == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // A single update is a regular GER: the vectors are the first (and only) column of X and Y, which
+  // in row-major layout has the leading dimension as increment
+  if (k == 1) {
+    const auto x_inc = (layout == Layout::kRowMajor) ? x_ld : size_t{1};
+    const auto y_inc = (layout == Layout::kRowMajor) ? y_ld : size_t{1};
+    auto ger = Xger<T>(queue_, event_);
+    ger.DoGer(layout, m, n, alpha,
+              x_buffer, x_offset, x_inc,
+              y_buffer, y_offset, y_inc,
+              a_buffer, a_offset, a_ld);
+    return;
+  }
+
+  // Otherwise computes all updates at once as A := alpha * X * Y^T + A. The GEMM routine takes care
+  // of selecting the direct kernel for small sizes and the indirect kernel for large sizes.
+  try {
+    DoGemm(layout, Transpose::kNo, Transpose::kYes,
+           m, n, k,
+           alpha,
+           x_buffer, x_offset, x_ld,
+           y_buffer, y_offset, y_ld,
+           ConstantOne<T>(),
+           a_buffer, a_offset, a_ld);
+  } catch (BLASError &e) {
+    // The matrices of the Xgemm routine are X, Y, and A here, so translate the error codes to the
+    // ones of GER: the leading dimension of X and Y plays the role of the increment of the vectors
+    switch(e.status()) {
+      case StatusCode::kInvalidMatrixA:      throw BLASError(StatusCode::kInvalidVectorX, e.details());
+      case StatusCode::kInvalidMatrixB:      throw BLASError(StatusCode::kInvalidVectorY, e.details());
+      case StatusCode::kInvalidMatrixC:      throw BLASError(StatusCode::kInvalidMatrixA, e.details());
+      case StatusCode::kInvalidLeadDimA:     throw BLASError(StatusCode::kInvalidIncrementX, e.details());
+      case StatusCode::kInvalidLeadDimB:     throw BLASError(StatusCode::kInvalidIncrementY, e.details());
+      case StatusCode::kInvalidLeadDimC:     throw BLASError(StatusCode::kInvalidLeadDimA, e.details());
+      case StatusCode::kInsufficientMemoryA: throw BLASError(StatusCode::kInsufficientMemoryX, e.details());
+      case StatusCode::kInsufficientMemoryB: throw BLASError(StatusCode::kInsufficientMemoryY, e.details());
+      case StatusCode::kInsufficientMemoryC: throw BLASError(StatusCode::kInsufficientMemoryA, e.details());
+      default:                               throw;
+    }
+  }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xgerk<half>;
+template class Xgerk<float>;
+template class Xgerk<double>;
+
+// =================================================================================================
+} // namespace clblast
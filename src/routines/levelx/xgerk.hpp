@@ -0,0 +1,51 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgerk routine: a sequence of k rank-1 updates A += alpha * x_i * y_i^T
+// fused into a single rank-k update A += alpha * X * Y^T. In both layouts x_i is column i of the
+// m-by-k matrix X and y_i column i of the n-by-k matrix Y, with x_ld/y_ld as stride in row-major.
+// For k equal to one this is a regular GER, otherwise the update is computed as a GEMM, such that
+// matrix A is read and written only once instead of k times.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGERK_H_
+#define CLBLAST_ROUTINES_XGERK_H_
+
+#include "routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xgerk: public Xgemm<T> {
+ public:
+
+  // Uses methods and variables the regular Xgemm routine
+  using Xgemm<T>::queue_;
+  using Xgemm<T>::event_;
+  using Xgemm<T>::DoGemm;
+
+  // Constructor
+  Xgerk(Queue &queue, EventPointer event, const std::string &name = "GERK");
+
+  // Templated-precision implementation of the routine
+  void DoGerk(const Layout layout,
+              const size_t m, const size_t n, const size_t k,
+              const T alpha,
+              const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_ld,
+              const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_ld,
+              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGERK_H_
+#endif
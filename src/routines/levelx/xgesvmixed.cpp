@@ -0,0 +1,362 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgesvmixed class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgesvmixed.hpp"
+#include "routines/levelx/xgetrf.hpp"
+#include "routines/levelx/xomatcopy.hpp"
+#include "routines/level3/xtrsm.hpp"
+#include "routines/level3/xgemm.hpp"
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xgesvmixed<T>::Xgesvmixed(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"GesvMixed"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/levelx/xgesvmixed.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xgesvmixed<T>::DoGesvMixed(const Layout layout, const size_t n, const size_t nrhs,
+                                const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                                const Buffer<int> &ipiv_buffer, const size_t ipiv_offset,
+                                const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                                const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_ld,
+                                const Buffer<int> &info_buffer, const size_t info_offset,
+                                const Buffer<int> &iter_buffer, const size_t iter_offset) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0 || nrhs == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrices and the pivot, info and iter buffers for validity
+  const auto is_rowmajor = (layout == Layout::kRowMajor);
+  const auto b_one = (is_rowmajor) ? nrhs : n;
+  const auto b_two = (is_rowmajor) ? n : nrhs;
+  TestMatrixA(n, n, a_buffer, a_offset, a_ld);
+  TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
+  TestMatrixC(b_one, b_two, x_buffer, x_offset, x_ld);
+  TestVectorIndex(n, ipiv_buffer, ipiv_offset);
+  TestVectorIndex(1, info_buffer, info_offset);
+  TestVectorIndex(1, iter_buffer, iter_offset);
+
+  // The norm and convergence kernels run in a single work-group
+  if (device_.MaxWorkGroupSize() < db_["GESV_WGS"]) {
+    throw RuntimeErrorCode(StatusCode::kNotImplemented);
+  }
+
+  // Creates the temporary buffers: A and X in low precision, the residual R, and device scalars
+  auto a_low = Buffer<L>(context_, n * n);
+  auto x_low = Buffer<L>(context_, b_one * b_two);
+  auto r_buffer = Buffer<T>(context_, b_one * b_two);
+  auto norm_buffer = Buffer<U>(context_, 1);
+  auto ratio_buffer = Buffer<U>(context_, 1);
+  auto overflow_buffer = Buffer<int>(context_, 1);
+  auto overflow = std::vector<int>{0};
+  overflow_buffer.Write(queue_, 1, overflow);
+
+  // The convergence test compares the residual against ||X|| * ||A|| * eps * sqrt(n), as in LAPACK
+  const auto factor = static_cast<U>(std::numeric_limits<U>::epsilon() / 2 *
+                                     std::sqrt(static_cast<double>(n)));
+
+  // Computes the norm of A, used for the convergence test
+  auto norm_event = Event();
+  auto norm_kernel = Kernel(program_, "XgesvNormInf");
+  norm_kernel.SetArgument(0, static_cast<int>(n));
+  norm_kernel.SetArgument(1, a_buffer());
+  norm_kernel.SetArgument(2, static_cast<int>(a_offset));
+  norm_kernel.SetArgument(3, static_cast<int>(a_ld));
+  norm_kernel.SetArgument(4, static_cast<int>(is_rowmajor));
+  norm_kernel.SetArgument(5, norm_buffer());
+  const auto single_group = std::vector<size_t>{db_["GESV_WGS"]};
+  RunKernel(norm_kernel, queue_, device_, single_group, single_group, norm_event.pointer());
+
+  // Converts A and B to low precision and factors A
+  auto a_low_event = Event();
+  ConvertDown(n, n, a_buffer, a_offset, a_ld, a_low, n, overflow_buffer,
+              a_low_event.pointer(), {});
+  auto x_low_event = Event();
+  ConvertDown(b_one, b_two, b_buffer, b_offset, b_ld, x_low, b_one, overflow_buffer,
+              x_low_event.pointer(), {});
+  auto getrf_event = Event();
+  auto getrf = Xgetrf<L>(queue_, getrf_event.pointer());
+  getrf.DoGetrf(layout, n, n, a_low, 0, n, ipiv_buffer, ipiv_offset,
+                info_buffer, info_offset, {a_low_event});
+
+  // Falls back to full precision in case of an overflow or a failed factorization
+  norm_event.WaitForCompletion();
+  getrf_event.WaitForCompletion();
+  x_low_event.WaitForCompletion();
+  auto info = std::vector<int>(1);
+  overflow_buffer.Read(queue_, 1, overflow);
+  info_buffer.Read(queue_, 1, info, info_offset);
+  auto iteration_result = 0;
+  if (overflow[0] != 0) { iteration_result = -2; }
+  else if (info[0] != 0) { iteration_result = -3; }
+  else {
+
+    // Computes the initial solution in low precision
+    auto solve_event = Event();
+    SolveLow(layout, n, nrhs, a_low, ipiv_buffer, ipiv_offset, x_low, b_one,
+             solve_event.pointer(), {getrf_event, x_low_event});
+    auto update_event = Event();
+    ConvertUp(b_one, b_two, x_low, b_one, x_buffer, x_offset, x_ld, false,
+              update_event.pointer(), {solve_event});
+
+    // Refines the solution until convergence: in each iteration, the residual is computed in high
+    // precision, after which the correction is solved for in low precision
+    auto previous_ratio = std::numeric_limits<U>::infinity();
+    for (auto iteration = 0; ; ++iteration) {
+      auto residual_event = Event();
+      Residual(layout, n, nrhs, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+               x_buffer, x_offset, x_ld, r_buffer, b_one,
+               residual_event.pointer(), {update_event});
+
+      // Tests for convergence
+      auto convergence_event = Event();
+      auto kernel = Kernel(program_, "XgesvConvergence");
+      kernel.SetArgument(0, static_cast<int>(n));
+      kernel.SetArgument(1, static_cast<int>(nrhs));
+      kernel.SetArgument(2, r_buffer());
+      kernel.SetArgument(3, 0);
+      kernel.SetArgument(4, static_cast<int>(b_one));
+      kernel.SetArgument(5, x_buffer());
+      kernel.SetArgument(6, static_cast<int>(x_offset));
+      kernel.SetArgument(7, static_cast<int>(x_ld));
+      kernel.SetArgument(8, static_cast<int>(is_rowmajor));
+      kernel.SetArgument(9, norm_buffer());
+      kernel.SetArgument(10, GetRealArg(factor));
+      kernel.SetArgument(11, ratio_buffer());
+      RunKernel(kernel, queue_, device_, single_group, single_group, convergence_event.pointer(),
+                {residual_event});
+      convergence_event.WaitForCompletion();
+      auto ratio = std::vector<U>(1);
+      ratio_buffer.Read(queue_, 1, ratio);
+      if (ratio[0] <= U{1}) {
+        SetIter(iter_buffer, iter_offset, iteration, {});
+        return;
+      }
+
+      // Stops refining in case of too many iterations or in case refinement stalls
+      if (iteration == kMaxIterations || ratio[0] > kStallFactor * previous_ratio) {
+        iteration_result = -(kMaxIterations + 1);
+        break;
+      }
+      previous_ratio = ratio[0];
+
+      // Solves for the correction in low precision and adds it to the solution
+      auto r_low_event = Event();
+      ConvertDown(b_one, b_two, r_buffer, 0, b_one, x_low, b_one, overflow_buffer,
+                  r_low_event.pointer(), {});
+      r_low_event.WaitForCompletion();
+      overflow_buffer.Read(queue_, 1, overflow);
+      if (overflow[0] != 0) {
+        iteration_result = -2;
+        break;
+      }
+      auto correction_event = Event();
+      SolveLow(layout, n, nrhs, a_low, ipiv_buffer, ipiv_offset, x_low, b_one,
+               correction_event.pointer(), {r_low_event});
+      update_event = Event();
+      ConvertUp(b_one, b_two, x_low, b_one, x_buffer, x_offset, x_ld, true,
+                update_event.pointer(), {correction_event});
+    }
+  }
+
+  // Falls back to solving the system in full precision
+  auto full_event = Event();
+  auto full_events = std::vector<Event>();
+  if (SolveFull(layout, n, nrhs, a_buffer, a_offset, a_ld, ipiv_buffer, ipiv_offset,
+                b_buffer, b_offset, b_ld, x_buffer, x_offset, x_ld, info_buffer, info_offset,
+                full_event.pointer())) {
+    full_events.push_back(full_event);
+  }
+  SetIter(iter_buffer, iter_offset, iteration_result, full_events);
+}
+
+// =================================================================================================
+
+// Converts a matrix to low precision
+template <typename T>
+void Xgesvmixed<T>::ConvertDown(const size_t one, const size_t two,
+                                const Buffer<T> &src, const size_t src_offset, const size_t src_ld,
+                                const Buffer<L> &dest, const size_t dest_ld,
+                                const Buffer<int> &overflow,
+                                EventPointer event, const std::vector<Event> &waitForEvents) {
+  auto kernel = Kernel(program_, "XgesvConvertDown");
+  kernel.SetArgument(0, static_cast<int>(one));
+  kernel.SetArgument(1, static_cast<int>(two));
+  kernel.SetArgument(2, src());
+  kernel.SetArgument(3, static_cast<int>(src_offset));
+  kernel.SetArgument(4, static_cast<int>(src_ld));
+  kernel.SetArgument(5, dest());
+  kernel.SetArgument(6, 0);
+  kernel.SetArgument(7, static_cast<int>(dest_ld));
+  kernel.SetArgument(8, overflow());
+  const auto global = std::vector<size_t>{Ceil(one, db_["GESV_WGS"]), two};
+  const auto local = std::vector<size_t>{db_["GESV_WGS"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
+}
+
+// Converts a matrix back to high precision
+template <typename T>
+void Xgesvmixed<T>::ConvertUp(const size_t one, const size_t two,
+                              const Buffer<L> &src, const size_t src_ld,
+                              const Buffer<T> &dest, const size_t dest_offset, const size_t dest_ld,
+                              const bool accumulate,
+                              EventPointer event, const std::vector<Event> &waitForEvents) {
+  auto kernel = Kernel(program_, "XgesvConvertUp");
+  kernel.SetArgument(0, static_cast<int>(one));
+  kernel.SetArgument(1, static_cast<int>(two));
+  kernel.SetArgument(2, src());
+  kernel.SetArgument(3, 0);
+  kernel.SetArgument(4, static_cast<int>(src_ld));
+  kernel.SetArgument(5, dest());
+  kernel.SetArgument(6, static_cast<int>(dest_offset));
+  kernel.SetArgument(7, static_cast<int>(dest_ld));
+  kernel.SetArgument(8, static_cast<int>(accumulate));
+  const auto global = std::vector<size_t>{Ceil(one, db_["GESV_WGS"]), two};
+  const auto local = std::vector<size_t>{db_["GESV_WGS"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
+}
+
+// =================================================================================================
+
+// Solves the system in low precision: applies the row interchanges and solves with L and U
+template <typename T>
+void Xgesvmixed<T>::SolveLow(const Layout layout, const size_t n, const size_t nrhs,
+                             const Buffer<L> &a_low,
+                             const Buffer<int> &ipiv_buffer, const size_t ipiv_offset,
+                             const Buffer<L> &x_low, const size_t x_low_ld,
+                             EventPointer event, const std::vector<Event> &waitForEvents) {
+  auto swap_event = Event();
+  auto kernel = Kernel(program_, "XgesvSwapRowsLow");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, static_cast<int>(nrhs));
+  kernel.SetArgument(2, x_low());
+  kernel.SetArgument(3, 0);
+  kernel.SetArgument(4, static_cast<int>(x_low_ld));
+  kernel.SetArgument(5, static_cast<int>(layout == Layout::kRowMajor));
+  kernel.SetArgument(6, ipiv_buffer());
+  kernel.SetArgument(7, static_cast<int>(ipiv_offset));
+  const auto global = std::vector<size_t>{Ceil(nrhs, db_["GESV_WGS"])};
+  const auto local = std::vector<size_t>{db_["GESV_WGS"]};
+  RunKernel(kernel, queue_, device_, global, local, swap_event.pointer(), waitForEvents);
+
+  auto lower_event = Event();
+  auto lower = Xtrsm<L>(queue_, lower_event.pointer());
+  lower.DoTrsm(layout, Side::kLeft, Triangle::kLower, Transpose::kNo, Diagonal::kUnit,
+               n, nrhs, ConstantOne<L>(), a_low, 0, n, x_low, 0, x_low_ld, {swap_event});
+  auto upper = Xtrsm<L>(queue_, event);
+  upper.DoTrsm(layout, Side::kLeft, Triangle::kUpper, Transpose::kNo, Diagonal::kNonUnit,
+               n, nrhs, ConstantOne<L>(), a_low, 0, n, x_low, 0, x_low_ld, {lower_event});
+}
+
+// Computes the residual R = B - A * X in high precision
+template <typename T>
+void Xgesvmixed<T>::Residual(const Layout layout, const size_t n, const size_t nrhs,
+                             const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                             const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                             const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_ld,
+                             const Buffer<T> &r_buffer, const size_t r_ld,
+                             EventPointer event, const std::vector<Event> &waitForEvents) {
+  auto copy_event = Event();
+  auto copy = Xomatcopy<T>(queue_, copy_event.pointer());
+  copy.DoOmatcopy(layout, Transpose::kNo, n, nrhs, ConstantOne<T>(),
+                  b_buffer, b_offset, b_ld, r_buffer, 0, r_ld, waitForEvents);
+  auto gemm = Xgemm<T>(queue_, event);
+  gemm.DoGemm(layout, Transpose::kNo, Transpose::kNo, n, nrhs, n, -ConstantOne<T>(),
+              a_buffer, a_offset, a_ld, x_buffer, x_offset, x_ld, ConstantOne<T>(),
+              r_buffer, 0, r_ld, Buffer<T>(0), false, false, false, {copy_event});
+}
+
+// Solves the system in high precision: X = B, followed by an LU factorization and solve
+template <typename T>
+bool Xgesvmixed<T>::SolveFull(const Layout layout, const size_t n, const size_t nrhs,
+                              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                              const Buffer<int> &ipiv_buffer, const size_t ipiv_offset,
+                              const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                              const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_ld,
+                              const Buffer<int> &info_buffer, const size_t info_offset,
+                              EventPointer event) {
+  auto copy_event = Event();
+  auto copy = Xomatcopy<T>(queue_, copy_event.pointer());
+  copy.DoOmatcopy(layout, Transpose::kNo, n, nrhs, ConstantOne<T>(),
+                  b_buffer, b_offset, b_ld, x_buffer, x_offset, x_ld);
+  auto getrf_event = Event();
+  auto getrf = Xgetrf<T>(queue_, getrf_event.pointer());
+  getrf.DoGetrf(layout, n, n, a_buffer, a_offset, a_ld, ipiv_buffer, ipiv_offset,
+                info_buffer, info_offset);
+
+  // Stops in case A is singular, leaving X equal to B (as in LAPACK)
+  getrf_event.WaitForCompletion();
+  copy_event.WaitForCompletion();
+  auto info = std::vector<int>(1);
+  info_buffer.Read(queue_, 1, info, info_offset);
+  if (info[0] != 0) { return false; }
+
+  // Applies the row interchanges and solves with L and U
+  auto swap_event = Event();
+  auto kernel = Kernel(program_, "XgesvSwapRows");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, static_cast<int>(nrhs));
+  kernel.SetArgument(2, x_buffer());
+  kernel.SetArgument(3, static_cast<int>(x_offset));
+  kernel.SetArgument(4, static_cast<int>(x_ld));
+  kernel.SetArgument(5, static_cast<int>(layout == Layout::kRowMajor));
+  kernel.SetArgument(6, ipiv_buffer());
+  kernel.SetArgument(7, static_cast<int>(ipiv_offset));
+  const auto global = std::vector<size_t>{Ceil(nrhs, db_["GESV_WGS"])};
+  const auto local = std::vector<size_t>{db_["GESV_WGS"]};
+  RunKernel(kernel, queue_, device_, global, local, swap_event.pointer());
+
+  auto lower_event = Event();
+  auto lower = Xtrsm<T>(queue_, lower_event.pointer());
+  lower.DoTrsm(layout, Side::kLeft, Triangle::kLower, Transpose::kNo, Diagonal::kUnit,
+               n, nrhs, ConstantOne<T>(), a_buffer, a_offset, a_ld, x_buffer, x_offset, x_ld,
+               {swap_event});
+  auto upper = Xtrsm<T>(queue_, event);
+  upper.DoTrsm(layout, Side::kLeft, Triangle::kUpper, Transpose::kNo, Diagonal::kNonUnit,
+               n, nrhs, ConstantOne<T>(), a_buffer, a_offset, a_ld, x_buffer, x_offset, x_ld,
+               {lower_event});
+  return true;
+}
+
+// Stores the final number of iterations
+template <typename T>
+void Xgesvmixed<T>::SetIter(const Buffer<int> &iter_buffer, const size_t iter_offset,
+                            const int value, const std::vector<Event> &waitForEvents) {
+  auto kernel = Kernel(program_, "XgesvSetIter");
+  kernel.SetArgument(0, iter_buffer());
+  kernel.SetArgument(1, static_cast<int>(iter_offset));
+  kernel.SetArgument(2, value);
+  RunKernel(kernel, queue_, device_, {1}, {1}, event_, waitForEvents);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xgesvmixed<double>;
+template class Xgesvmixed<double2>;
+
+// =================================================================================================
+} // namespace clblast
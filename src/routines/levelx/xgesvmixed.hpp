@@ -0,0 +1,110 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgesvmixed routine: the solution of a general system of linear
+// equations A * X = B in double precision, using an LU factorization computed in single precision
+// followed by iterative refinement with residuals computed in double precision (as LAPACK's DSGESV
+// and ZCGESV). In case the conversion to single precision overflows, the factorization fails, or
+// the refinement does not converge, the system is solved in double precision instead. Contrary to
+// most other routines this one synchronises with the host: after each refinement step a single
+// value is read back to test for convergence.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGESVMIXED_H_
+#define CLBLAST_ROUTINES_XGESVMIXED_H_
+
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The low-precision data-type in which the factorization is computed
+template <typename T> struct LowPrecision { using Type = float; };
+template <> struct LowPrecision<double2> { using Type = float2; };
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xgesvmixed: public Routine {
+ public:
+
+  // Types of the low-precision data and of the real-valued norms
+  using L = typename LowPrecision<T>::Type;
+  using U = typename BaseType<T>::Type;
+
+  // The maximum number of refinement iterations (as in LAPACK)
+  static constexpr auto kMaxIterations = 30;
+
+  // Refinement is considered stalled in case an iteration does not reduce the convergence ratio
+  // by at least this factor, after which it falls back to full precision straight away
+  static constexpr auto kStallFactor = 0.5;
+
+  // Constructor
+  Xgesvmixed(Queue &queue, EventPointer event, const std::string &name = "GESV_MIXED");
+
+  // Templated-precision implementation of the routine
+  void DoGesvMixed(const Layout layout, const size_t n, const size_t nrhs,
+                   const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                   const Buffer<int> &ipiv_buffer, const size_t ipiv_offset,
+                   const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                   const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_ld,
+                   const Buffer<int> &info_buffer, const size_t info_offset,
+                   const Buffer<int> &iter_buffer, const size_t iter_offset);
+
+ private:
+
+  // Converts a matrix of 'one' by 'two' stored elements to low precision, flagging any overflow
+  void ConvertDown(const size_t one, const size_t two,
+                   const Buffer<T> &src, const size_t src_offset, const size_t src_ld,
+                   const Buffer<L> &dest, const size_t dest_ld, const Buffer<int> &overflow,
+                   EventPointer event, const std::vector<Event> &waitForEvents);
+
+  // Converts a matrix back to high precision, optionally adding it to the destination
+  void ConvertUp(const size_t one, const size_t two,
+                 const Buffer<L> &src, const size_t src_ld,
+                 const Buffer<T> &dest, const size_t dest_offset, const size_t dest_ld,
+                 const bool accumulate,
+                 EventPointer event, const std::vector<Event> &waitForEvents);
+
+  // Solves the system in low precision in-place, given the low-precision LU factors of A
+  void SolveLow(const Layout layout, const size_t n, const size_t nrhs,
+                const Buffer<L> &a_low, const Buffer<int> &ipiv_buffer, const size_t ipiv_offset,
+                const Buffer<L> &x_low, const size_t x_low_ld,
+                EventPointer event, const std::vector<Event> &waitForEvents);
+
+  // Computes the residual R = B - A * X in high precision
+  void Residual(const Layout layout, const size_t n, const size_t nrhs,
+                const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_ld,
+                const Buffer<T> &r_buffer, const size_t r_ld,
+                EventPointer event, const std::vector<Event> &waitForEvents);
+
+  // Solves the system entirely in high precision, overwriting A with its LU factors. Returns
+  // whether the factorization succeeded: if not, nothing is left running and 'event' is not set.
+  bool SolveFull(const Layout layout, const size_t n, const size_t nrhs,
+                 const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                 const Buffer<int> &ipiv_buffer, const size_t ipiv_offset,
+                 const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                 const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_ld,
+                 const Buffer<int> &info_buffer, const size_t info_offset,
+                 EventPointer event);
+
+  // Stores the final number of iterations, signalling the user's event
+  void SetIter(const Buffer<int> &iter_buffer, const size_t iter_offset, const int value,
+               const std::vector<Event> &waitForEvents);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGESVMIXED_H_
+#endif
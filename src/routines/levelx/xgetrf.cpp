@@ -0,0 +1,175 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgetrf class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgetrf.hpp"
+#include "routines/level3/xtrsm.hpp"
+#include "routines/level3/xgemm.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xgetrf<T>::Xgetrf(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Getrf"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/levelx/xgetrf.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xgetrf<T>::DoGetrf(const Layout layout, const size_t m, const size_t n,
+                        const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                        const Buffer<int> &ipiv_buffer, const size_t ipiv_offset,
+                        const Buffer<int> &info_buffer, const size_t info_offset,
+                        const std::vector<Event> &waitForEvents) {
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrix and the pivot and info buffers for validity
+  const auto a_one = (layout == Layout::kRowMajor) ? n : m;
+  const auto a_two = (layout == Layout::kRowMajor) ? m : n;
+  const auto min_mn = std::min(m, n);
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestVectorIndex(min_mn, ipiv_buffer, ipiv_offset);
+  TestVectorIndex(1, info_buffer, info_offset);
+
+  // The panel kernel runs in a single work-group
+  const auto panel_width = static_cast<size_t>(db_["GETRF_NB"]);
+  if (panel_width == 0 || device_.MaxWorkGroupSize() < db_["GETRF_WGS"]) {
+    throw RuntimeErrorCode(StatusCode::kNotImplemented);
+  }
+
+  // Computes the offset of element (row, col) of A, taking the layout into account
+  const auto index = [&](const size_t row, const size_t col) {
+    return (layout == Layout::kRowMajor) ? a_offset + row * a_ld + col :
+                                           a_offset + col * a_ld + row;
+  };
+
+  // Loops over the panels, chaining all operations through events. The last operation of the last
+  // panel signals the user's event.
+  auto events = waitForEvents;
+  for (auto block_start = size_t{0}; block_start < min_mn; block_start += panel_width) {
+    const auto block_size = std::min(panel_width, min_mn - block_start);
+    const auto trailing_start = block_start + block_size;
+    const auto is_last_panel = (trailing_start == min_mn);
+
+    // Factors the panel, including the pivot search and the interchanges within the panel
+    auto panel_event = Event();
+    const auto panel_is_last = (is_last_panel && block_size == n);
+    FactorPanel(layout, m, block_start, block_size, a_buffer, a_offset, a_ld,
+                ipiv_buffer, ipiv_offset, info_buffer, info_offset,
+                (panel_is_last) ? event_ : panel_event.pointer(), events);
+    if (panel_is_last) { break; }
+
+    // Applies the interchanges to the columns on the left and on the right of the panel
+    auto swap_event = Event();
+    const auto swap_is_last = (is_last_panel && trailing_start == n);
+    SwapRows(layout, n, block_start, block_size, a_buffer, a_offset, a_ld,
+             ipiv_buffer, ipiv_offset,
+             (swap_is_last) ? event_ : swap_event.pointer(), {panel_event});
+    if (swap_is_last) { break; }
+
+    // Solves the block row of U: U12 := L11^-1 * A12
+    auto trsm_event = Event();
+    auto trsm = Xtrsm<T>(queue_, (is_last_panel) ? event_ : trsm_event.pointer());
+    trsm.DoTrsm(layout, Side::kLeft, Triangle::kLower, Transpose::kNo, Diagonal::kUnit,
+                block_size, n - trailing_start, ConstantOne<T>(),
+                a_buffer, index(block_start, block_start), a_ld,
+                a_buffer, index(block_start, trailing_start), a_ld, {swap_event});
+    if (is_last_panel) { break; }
+
+    // Updates the trailing matrix: A22 := A22 - L21 * U12
+    auto gemm_event = Event();
+    auto gemm = Xgemm<T>(queue_, gemm_event.pointer());
+    gemm.DoGemm(layout, Transpose::kNo, Transpose::kNo,
+                m - trailing_start, n - trailing_start, block_size, -ConstantOne<T>(),
+                a_buffer, index(trailing_start, block_start), a_ld,
+                a_buffer, index(block_start, trailing_start), a_ld, ConstantOne<T>(),
+                a_buffer, index(trailing_start, trailing_start), a_ld,
+                Buffer<T>(0), false, false, false, {trsm_event});
+    events = {gemm_event};
+  }
+}
+
+// =================================================================================================
+
+// Factors a single panel
+template <typename T>
+void Xgetrf<T>::FactorPanel(const Layout layout, const size_t m,
+                            const size_t block_start, const size_t block_size,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer<int> &ipiv_buffer, const size_t ipiv_offset,
+                            const Buffer<int> &info_buffer, const size_t info_offset,
+                            EventPointer event, const std::vector<Event> &waitForEvents) {
+  auto kernel = Kernel(program_, "XgetrfPanel");
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(block_start));
+  kernel.SetArgument(2, static_cast<int>(block_size));
+  kernel.SetArgument(3, a_buffer());
+  kernel.SetArgument(4, static_cast<int>(a_offset));
+  kernel.SetArgument(5, static_cast<int>(a_ld));
+  kernel.SetArgument(6, static_cast<int>(layout == Layout::kRowMajor));
+  kernel.SetArgument(7, ipiv_buffer());
+  kernel.SetArgument(8, static_cast<int>(ipiv_offset));
+  kernel.SetArgument(9, info_buffer());
+  kernel.SetArgument(10, static_cast<int>(info_offset));
+  kernel.SetArgument(11, static_cast<int>(block_start == 0));
+
+  // Launches a single work-group
+  const auto local = std::vector<size_t>{db_["GETRF_WGS"]};
+  const auto global = std::vector<size_t>{db_["GETRF_WGS"]};
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
+}
+
+// Applies the row interchanges of a panel to the other columns
+template <typename T>
+void Xgetrf<T>::SwapRows(const Layout layout, const size_t n,
+                         const size_t block_start, const size_t block_size,
+                         const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                         const Buffer<int> &ipiv_buffer, const size_t ipiv_offset,
+                         EventPointer event, const std::vector<Event> &waitForEvents) {
+  auto kernel = Kernel(program_, "XgetrfSwapRows");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, static_cast<int>(block_start));
+  kernel.SetArgument(2, static_cast<int>(block_size));
+  kernel.SetArgument(3, a_buffer());
+  kernel.SetArgument(4, static_cast<int>(a_offset));
+  kernel.SetArgument(5, static_cast<int>(a_ld));
+  kernel.SetArgument(6, static_cast<int>(layout == Layout::kRowMajor));
+  kernel.SetArgument(7, ipiv_buffer());
+  kernel.SetArgument(8, static_cast<int>(ipiv_offset));
+
+  // Launches a work-item per column
+  const auto local = std::vector<size_t>{db_["GETRF_WGS"]};
+  const auto global = std::vector<size_t>{Ceil(n, db_["GETRF_WGS"])};
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xgetrf<float>;
+template class Xgetrf<double>;
+template class Xgetrf<float2>;
+template class Xgetrf<double2>;
+
+// =================================================================================================
+} // namespace clblast
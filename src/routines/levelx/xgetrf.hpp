@@ -0,0 +1,68 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgetrf routine: the LU factorization of a general m-by-n matrix with
+// partial pivoting (row interchanges), computed as a blocked right-looking algorithm. Per panel of
+// GETRF_NB columns (tunable through the database), the panel is factored including the pivot
+// search by a kernel running in a single work-group, the row interchanges are applied to the rest
+// of the matrix, the block row of U is solved with TRSM, and the trailing matrix is updated with
+// GEMM. All steps are chained through events: the host never waits, and the pivot indices and the
+// result ('info') are written to device buffers.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGETRF_H_
+#define CLBLAST_ROUTINES_XGETRF_H_
+
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xgetrf: public Routine {
+ public:
+
+  // Constructor
+  Xgetrf(Queue &queue, EventPointer event, const std::string &name = "GETRF");
+
+  // Templated-precision implementation of the routine
+  void DoGetrf(const Layout layout, const size_t m, const size_t n,
+               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+               const Buffer<int> &ipiv_buffer, const size_t ipiv_offset,
+               const Buffer<int> &info_buffer, const size_t info_offset,
+               const std::vector<Event> &waitForEvents = {});
+
+ private:
+
+  // Factors the panel of 'block_size' columns starting at row and column 'block_start' using a
+  // single work-group. This stores the pivots and reports the result in the 'info' buffer.
+  void FactorPanel(const Layout layout, const size_t m,
+                   const size_t block_start, const size_t block_size,
+                   const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                   const Buffer<int> &ipiv_buffer, const size_t ipiv_offset,
+                   const Buffer<int> &info_buffer, const size_t info_offset,
+                   EventPointer event, const std::vector<Event> &waitForEvents);
+
+  // Applies the row interchanges of the panel starting at 'block_start' to all other columns
+  void SwapRows(const Layout layout, const size_t n,
+                const size_t block_start, const size_t block_size,
+                const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                const Buffer<int> &ipiv_buffer, const size_t ipiv_offset,
+                EventPointer event, const std::vector<Event> &waitForEvents);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGETRF_H_
+#endif
@@ -42,7 +42,7 @@ template <typename T>
 void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle triangle, const Diagonal diag,
                                             const size_t n, const size_t block_size,
                                             const Buffer<T> &src, const size_t offset, const size_t ld_src,
-                                            Buffer<T> &dest) {
+                                            Buffer<T> &dest, const std::vector<Event> &waitForEvents) {
 
   // Makes sure all dimensions are larger than zero
   if ((block_size == 0) || (n == 0)) {
@@ -79,8 +79,9 @@ void Xinvert<T>::InvertMatrixDiagonalBlocks(const Layout layout, const Triangle
                          (triangle == Triangle::kLower && layout == Layout::kRowMajor));
   const auto name_postfix = (is_upper) ? "Upper" : "Lower";
 
-  // Fills the output buffer with zeros
-  auto event_wait_list = std::vector<Event>();
+  // Fills the output buffer with zeros. This waits for the events passed in by the caller, such
+  // that all subsequent kernels do so as well.
+  auto event_wait_list = waitForEvents;
   auto fill_matrix_event = Event();
   FillMatrix(queue_, device_, program_, fill_matrix_event.pointer(), event_wait_list,
              block_size, num_blocks * block_size, block_size, 0, dest, ConstantZero<T>(),
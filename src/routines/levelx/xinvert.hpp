@@ -30,7 +30,7 @@ class Xinvert: public Routine {
   void InvertMatrixDiagonalBlocks(const Layout layout, const Triangle triangle, const Diagonal diag,
                                   const size_t n, const size_t block_size,
                                   const Buffer<T> &src, const size_t offset, const size_t ld_src,
-                                  Buffer<T> &dest);
+                                  Buffer<T> &dest, const std::vector<Event> &waitForEvents = {});
 };
 
 // =================================================================================================
@@ -0,0 +1,87 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xnrm2StridedBatched class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xnrm2stridedbatched.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xnrm2StridedBatched<T>::Xnrm2StridedBatched(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xdot", "ReductionSingleLaunch"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/reduction.opencl"
+    #include "../../kernels/level1/xnrm2.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xnrm2StridedBatched<T>::DoNrm2StridedBatched(const size_t n,
+                                                  const Buffer<T> &nrm2_buffer, const size_t nrm2_offset, const size_t nrm2_stride,
+                                                  const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride,
+                                                  const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if (batch_count < 1) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Makes sure the strides are valid
+  if (nrm2_stride == 0 && batch_count > 1) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the vectors for validity
+  const auto last_batch = batch_count - 1;
+  TestVectorX(n, x_buffer, x_offset + last_batch * x_stride, x_inc);
+  TestVectorScalar(1, nrm2_buffer, nrm2_offset + last_batch * nrm2_stride);
+
+  // Retrieves the Xnrm2 kernel from the compiled binary
+  auto kernel = Kernel(program_, "Xnrm2StridedBatched");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, x_buffer());
+  kernel.SetArgument(2, static_cast<int>(x_offset));
+  kernel.SetArgument(3, static_cast<int>(x_inc));
+  kernel.SetArgument(4, static_cast<int>(x_stride));
+  kernel.SetArgument(5, nrm2_buffer());
+  kernel.SetArgument(6, static_cast<int>(nrm2_offset));
+  kernel.SetArgument(7, static_cast<int>(nrm2_stride));
+
+  // Launches the kernel: a single work-group per reduction
+  auto global = std::vector<size_t>{db_["WGS1"], batch_count};
+  auto local = std::vector<size_t>{db_["WGS1"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xnrm2StridedBatched<half>;
+template class Xnrm2StridedBatched<float>;
+template class Xnrm2StridedBatched<double>;
+template class Xnrm2StridedBatched<float2>;
+template class Xnrm2StridedBatched<double2>;
+
+// =================================================================================================
+} // namespace clblast
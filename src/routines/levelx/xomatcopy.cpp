@@ -38,7 +38,8 @@ template <typename T>
 void Xomatcopy<T>::DoOmatcopy(const Layout layout, const Transpose a_transpose,
                               const size_t m, const size_t n, const T alpha,
                               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
-                              const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld) {
+                              const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                              const std::vector<Event> &waitForEvents) {
 
   // Makes sure all dimensions are larger than zero
   if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
@@ -65,8 +66,7 @@ void Xomatcopy<T>::DoOmatcopy(const Layout layout, const Transpose a_transpose,
   TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
   TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
 
-  auto emptyEventList = std::vector<Event>();
-  PadCopyTransposeMatrix(queue_, device_, db_, event_, emptyEventList,
+  PadCopyTransposeMatrix(queue_, device_, db_, event_, waitForEvents,
                          a_one, a_two, a_ld, a_offset, a_buffer,
                          b_one, b_two, b_ld, b_offset, b_buffer,
                          alpha, program_, false, transpose, conjugate);
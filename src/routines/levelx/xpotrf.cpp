@@ -0,0 +1,182 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xpotrf class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xpotrf.hpp"
+#include "routines/level3/xtrsm.hpp"
+#include "routines/level3/xsyrk.hpp"
+#include "routines/level3/xherk.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+// Updates the trailing matrix C := C - A * A^T (not transposed) or C := C - A^T * A (transposed)
+// with SYRK for real matrices
+template <typename T>
+void RankKUpdate(Queue &queue, EventPointer event, const Triangle triangle, const bool transposed,
+                 const size_t n, const size_t k,
+                 const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                 const size_t c_offset, const std::vector<Event> &waitForEvents) {
+  auto routine = Xsyrk<T>(queue, event);
+  routine.DoSyrk(Layout::kColMajor, triangle, (transposed) ? Transpose::kYes : Transpose::kNo,
+                 n, k, -ConstantOne<T>(), a_buffer, a_offset, a_ld,
+                 ConstantOne<T>(), a_buffer, c_offset, a_ld, waitForEvents);
+}
+
+// As above, but now C := C - A * A^H or C := C - A^H * A with HERK for complex matrices
+template <typename T, typename U>
+void RankKUpdateComplex(Queue &queue, EventPointer event, const Triangle triangle,
+                        const bool transposed, const size_t n, const size_t k,
+                        const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                        const size_t c_offset, const std::vector<Event> &waitForEvents) {
+  auto routine = Xherk<T,U>(queue, event);
+  routine.DoHerk(Layout::kColMajor, triangle, (transposed) ? Transpose::kConjugate : Transpose::kNo,
+                 n, k, -ConstantOne<U>(), a_buffer, a_offset, a_ld,
+                 ConstantOne<U>(), a_buffer, c_offset, a_ld, waitForEvents);
+}
+template <>
+void RankKUpdate<float2>(Queue &queue, EventPointer event, const Triangle triangle,
+                         const bool transposed, const size_t n, const size_t k,
+                         const Buffer<float2> &a_buffer, const size_t a_offset, const size_t a_ld,
+                         const size_t c_offset, const std::vector<Event> &waitForEvents) {
+  RankKUpdateComplex<float2,float>(queue, event, triangle, transposed, n, k,
+                                   a_buffer, a_offset, a_ld, c_offset, waitForEvents);
+}
+template <>
+void RankKUpdate<double2>(Queue &queue, EventPointer event, const Triangle triangle,
+                          const bool transposed, const size_t n, const size_t k,
+                          const Buffer<double2> &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const size_t c_offset, const std::vector<Event> &waitForEvents) {
+  RankKUpdateComplex<double2,double>(queue, event, triangle, transposed, n, k,
+                                     a_buffer, a_offset, a_ld, c_offset, waitForEvents);
+}
+
+} // anonymous namespace
+
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xpotrf<T>::Xpotrf(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Potrf"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/levelx/xpotrf.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xpotrf<T>::DoPotrf(const Layout layout, const Triangle triangle, const size_t n,
+                        const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                        const Buffer<int> &info_buffer, const size_t info_offset) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrix and the info buffer for validity
+  TestMatrixA(n, n, a_buffer, a_offset, a_ld);
+  TestVectorIndex(1, info_buffer, info_offset);
+
+  // The panel kernel runs in a single work-group with one work-item per column of the panel
+  const auto panel_width = static_cast<size_t>(db_["POTRF_NB"]);
+  if (panel_width == 0 || device_.MaxWorkGroupSize() < panel_width) {
+    throw RuntimeErrorCode(StatusCode::kNotImplemented);
+  }
+
+  // Works on the column-major view of the stored matrix. A row-major matrix is the transpose of
+  // this, in which case the lower factor L (A = L * L^H) is stored as an upper factor L^T, and vice
+  // versa. For a hermitian matrix this also conjugates A, which is factored as conj(L) * L^T.
+  const auto is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
+                         (triangle == Triangle::kLower && layout == Layout::kRowMajor));
+  const auto col_major_triangle = (is_upper) ? Triangle::kUpper : Triangle::kLower;
+
+  // Loops over the panels, chaining all operations through events
+  auto events = std::vector<Event>();
+  for (auto block_start = size_t{0}; block_start < n; block_start += panel_width) {
+    const auto block_size = std::min(panel_width, n - block_start);
+    const auto trailing_start = block_start + block_size;
+
+    // Factors the diagonal block, signalling the user's event in case it is the last one
+    if (trailing_start == n) {
+      FactorPanel(block_start, block_size, is_upper, a_buffer, a_offset, a_ld,
+                  info_buffer, info_offset, event_, events);
+      break;
+    }
+    auto panel_event = Event();
+    FactorPanel(block_start, block_size, is_upper, a_buffer, a_offset, a_ld,
+                info_buffer, info_offset, panel_event.pointer(), events);
+
+    // Solves the off-diagonal block: L21 := A21 * L11^-H (lower) or U12 := U11^-H * A12 (upper)
+    const auto trailing_size = n - trailing_start;
+    const auto diagonal_offset = a_offset + block_start * a_ld + block_start;
+    const auto panel_offset = (is_upper) ? a_offset + trailing_start * a_ld + block_start :
+                                           a_offset + block_start * a_ld + trailing_start;
+    const auto trailing_offset = a_offset + trailing_start * a_ld + trailing_start;
+    auto trsm_event = Event();
+    auto trsm = Xtrsm<T>(queue_, trsm_event.pointer());
+    trsm.DoTrsm(Layout::kColMajor, (is_upper) ? Side::kLeft : Side::kRight, col_major_triangle,
+                Transpose::kConjugate, Diagonal::kNonUnit,
+                (is_upper) ? block_size : trailing_size, (is_upper) ? trailing_size : block_size,
+                ConstantOne<T>(), a_buffer, diagonal_offset, a_ld,
+                a_buffer, panel_offset, a_ld, {panel_event});
+
+    // Updates the trailing matrix: A22 := A22 - L21 * L21^H (lower) or A22 - U12^H * U12 (upper)
+    auto update_event = Event();
+    RankKUpdate<T>(queue_, update_event.pointer(), col_major_triangle, is_upper,
+                   trailing_size, block_size, a_buffer, panel_offset, a_ld,
+                   trailing_offset, {trsm_event});
+    events = {update_event};
+  }
+}
+
+// =================================================================================================
+
+// Factors the diagonal block of a single panel
+template <typename T>
+void Xpotrf<T>::FactorPanel(const size_t block_start, const size_t block_size, const bool is_upper,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer<int> &info_buffer, const size_t info_offset,
+                            EventPointer event, const std::vector<Event> &waitForEvents) {
+  auto kernel = Kernel(program_, "XpotrfPanel");
+  kernel.SetArgument(0, static_cast<int>(block_start));
+  kernel.SetArgument(1, static_cast<int>(block_size));
+  kernel.SetArgument(2, a_buffer());
+  kernel.SetArgument(3, static_cast<int>(a_offset));
+  kernel.SetArgument(4, static_cast<int>(a_ld));
+  kernel.SetArgument(5, static_cast<int>(is_upper));
+  kernel.SetArgument(6, info_buffer());
+  kernel.SetArgument(7, static_cast<int>(info_offset));
+  kernel.SetArgument(8, static_cast<int>(block_start == 0));
+
+  // Launches a single work-group
+  const auto local = std::vector<size_t>{db_["POTRF_NB"]};
+  const auto global = std::vector<size_t>{db_["POTRF_NB"]};
+  RunKernel(kernel, queue_, device_, global, local, event, waitForEvents);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xpotrf<float>;
+template class Xpotrf<double>;
+template class Xpotrf<float2>;
+template class Xpotrf<double2>;
+
+// =================================================================================================
+} // namespace clblast
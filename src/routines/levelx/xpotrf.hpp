@@ -0,0 +1,56 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xpotrf routine: the Cholesky factorization of a symmetric (real) or
+// hermitian (complex) positive-definite matrix, computed as a blocked right-looking algorithm. Per
+// panel of POTRF_NB columns (tunable through the database), the diagonal block is factored by a
+// small kernel running in a single work-group, the off-diagonal block is solved with TRSM, and the
+// trailing matrix is updated with SYRK (real) or HERK (complex). All steps are chained through
+// events: the host never waits, and the result ('info') is written to a device buffer.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XPOTRF_H_
+#define CLBLAST_ROUTINES_XPOTRF_H_
+
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xpotrf: public Routine {
+ public:
+
+  // Constructor
+  Xpotrf(Queue &queue, EventPointer event, const std::string &name = "POTRF");
+
+  // Templated-precision implementation of the routine
+  void DoPotrf(const Layout layout, const Triangle triangle, const size_t n,
+               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+               const Buffer<int> &info_buffer, const size_t info_offset);
+
+ private:
+
+  // Factors the diagonal block of size 'block_size' starting at 'block_start' using a single
+  // work-group. This also reports the result in the 'info' buffer.
+  void FactorPanel(const size_t block_start, const size_t block_size, const bool is_upper,
+                   const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                   const Buffer<int> &info_buffer, const size_t info_offset,
+                   EventPointer event, const std::vector<Event> &waitForEvents);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XPOTRF_H_
+#endif
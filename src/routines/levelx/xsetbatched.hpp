@@ -0,0 +1,43 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XsetBatched routine. This is a non-blas batched version of SET.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XSETBATCHED_H_
+#define CLBLAST_ROUTINES_XSETBATCHED_H_
+
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XsetBatched: public Routine {
+ public:
+
+  // Constructor
+  XsetBatched(Queue &queue, EventPointer event, const std::string &name = "SETBATCHED");
+
+  // Templated-precision implementation of the routine
+  void DoSetBatched(const size_t n, const std::vector<T> &alphas,
+                    const Buffer<T> &x_buffer, const std::vector<size_t> &x_offsets,
+                    const size_t x_inc,
+                    const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XSETBATCHED_H_
+#endif
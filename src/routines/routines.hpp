@@ -15,6 +15,10 @@
 #define CLBLAST_ROUTINES_ROUTINES_H_
 
 // BLAS level-1 includes
+#include "routines/level1/xrotg.hpp"
+#include "routines/level1/xrotmg.hpp"
+#include "routines/level1/xrot.hpp"
+#include "routines/level1/xrotm.hpp"
 #include "routines/level1/xswap.hpp"
 #include "routines/level1/xscal.hpp"
 #include "routines/level1/xcopy.hpp"
@@ -43,6 +47,8 @@
 #include "routines/level2/xtbmv.hpp"
 #include "routines/level2/xtpmv.hpp"
 #include "routines/level2/xtrsv.hpp"
+#include "routines/level2/xtbsv.hpp"
+#include "routines/level2/xtpsv.hpp"
 #include "routines/level2/xger.hpp"
 #include "routines/level2/xgeru.hpp"
 #include "routines/level2/xgerc.hpp"
@@ -68,13 +74,34 @@
 
 // Level-x includes (non-BLAS)
 #include "routines/levelx/xhad.hpp"
+#include "routines/levelx/xaxpby.hpp"
+#include "routines/levelx/xset.hpp"
+#include "routines/levelx/xaxpy2.hpp"
+#include "routines/levelx/xaxpydot.hpp"
+#include "routines/levelx/xaxpynrm2.hpp"
 #include "routines/levelx/xomatcopy.hpp"
 #include "routines/levelx/xim2col.hpp"
 #include "routines/levelx/xcol2im.hpp"
 #include "routines/levelx/xconvgemm.hpp"
 #include "routines/levelx/xaxpybatched.hpp"
+#include "routines/levelx/xaxpbybatched.hpp"
+#include "routines/levelx/xsetbatched.hpp"
 #include "routines/levelx/xgemmbatched.hpp"
 #include "routines/levelx/xgemmstridedbatched.hpp"
+#include "routines/levelx/xgemvbatched.hpp"
+#include "routines/levelx/xgemvstridedbatched.hpp"
+#include "routines/levelx/xdotbatched.hpp"
+#include "routines/levelx/xdotstridedbatched.hpp"
+#include "routines/levelx/xnrm2batched.hpp"
+#include "routines/levelx/xnrm2stridedbatched.hpp"
+#include "routines/levelx/xasumbatched.hpp"
+#include "routines/levelx/xasumstridedbatched.hpp"
+#include "routines/levelx/xgemmgrouped.hpp"
+#include "routines/levelx/xgemmstrassen.hpp"
+#include "routines/levelx/xpotrf.hpp"
+#include "routines/levelx/xgetrf.hpp"
+#include "routines/levelx/xgesvmixed.hpp"
+#include "routines/levelx/xgerk.hpp"
 
 // CLBLAST_ROUTINES_ROUTINES_H_
 #endif
@@ -38,6 +38,7 @@ TunerSettings XdotGetTunerSettings(const int V, const Arguments<T> &args) {
   settings.kernel_family = "xdot_"+std::to_string(V);
   settings.kernel_name = (V==1) ? "Xdot" : "XdotEpilogue";
   settings.sources =
+#include "../src/kernels/level1/reduction.opencl"
 #include "../src/kernels/level1/xdot.opencl"
   ;
 
@@ -242,12 +242,14 @@ void XgemmSetArguments(const int, Kernel &kernel, const Arguments<T> &args, std:
   kernel.SetArgument(1, static_cast<int>(args.n));
   kernel.SetArgument(2, static_cast<int>(args.k));
   kernel.SetArgument(3, GetRealArg(args.alpha));
-  kernel.SetArgument(4, GetRealArg(args.beta));
-  kernel.SetArgument(5, buffers[2]()); // 2 == A matrix
-  kernel.SetArgument(6, buffers[3]()); // 3 == B matrix
-  kernel.SetArgument(7, buffers[4]()); // 4 == C matrix
-  kernel.SetArgument(8, 0);
-  kernel.SetArgument(9, 0);
+  kernel.SetArgument(4, 0);
+  kernel.SetArgument(5, GetRealArg(args.beta));
+  kernel.SetArgument(6, 0);
+  kernel.SetArgument(7, buffers[2]()); // 2 == A matrix
+  kernel.SetArgument(8, buffers[3]()); // 3 == B matrix
+  kernel.SetArgument(9, buffers[4]()); // 4 == C matrix
+  kernel.SetArgument(10, 0);
+  kernel.SetArgument(11, 0);
 }
 
 // =================================================================================================
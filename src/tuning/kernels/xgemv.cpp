@@ -37,6 +37,10 @@ int main(int argc, char *argv[]) {
     StartVariation<1>(argc, argv);
     StartVariation<2>(argc, argv);
     StartVariation<3>(argc, argv);
+    StartVariation<4>(argc, argv);
+    StartVariation<5>(argc, argv);
+    StartVariation<6>(argc, argv);
+    StartVariation<7>(argc, argv);
     return 0;
   } catch (...) { return static_cast<int>(clblast::DispatchException()); }
 }
@@ -7,10 +7,14 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file uses the auto-tuner to tune the xgemv OpenCL kernels. Three variants are tuned:
+// This file uses the auto-tuner to tune the xgemv OpenCL kernels. Seven variants are tuned:
 // 1: The full version of the kernel
 // 2: The fast version for non-transposed matrices
 // 3: The fast version for transposed matrices
+// 4: The (strided) batched version of the kernel, for many small matrices
+// 5: The banded version of the kernel
+// 6: The version for matrices stored as a triangle
+// 7: The tiled symmetric/hermitian version of the kernel
 //
 // =================================================================================================
 
@@ -23,13 +27,29 @@
 namespace clblast {
 // =================================================================================================
 
+// The number of work-groups of the symmetric version, as limited by the SYMV routine for large 'n'
+constexpr auto kXsymvNumGroups = size_t{128};
+
 // Settings for this kernel (default command-line arguments)
-TunerDefaults XgemvGetTunerDefaults(const int) {
+TunerDefaults XgemvGetTunerDefaults(const int V) {
   auto settings = TunerDefaults();
   settings.options = {kArgM, kArgN, kArgAlpha, kArgBeta};
   settings.default_m = 2048;
   settings.default_n = 2048;
   settings.default_num_runs = 4;
+  if (V==4) {
+    settings.options.push_back(kArgBatchCount);
+    settings.default_m = 128;
+    settings.default_n = 128;
+    settings.default_batch_count = 256;
+  }
+  if (V==5) {
+    settings.options.push_back(kArgK); // The number of sub- and super-diagonals of the band
+    settings.default_k = 8;
+  }
+  if (V==6 || V==7) {
+    settings.options = {kArgN, kArgAlpha, kArgBeta}; // Square matrices only
+  }
   return settings;
 }
 
@@ -39,31 +59,51 @@ TunerSettings XgemvGetTunerSettings(const int V, const Arguments<T> &args) {
   auto settings = TunerSettings();
 
   // Identification of the kernel
-  settings.kernel_family = (V==1) ? "xgemv" : ((V==2) ? "xgemv_fast" : "xgemv_fast_rot");
-  settings.kernel_name = (V==1) ? "Xgemv" : ((V==2) ? "XgemvFast" : "XgemvFastRot");
-  settings.sources =
+  settings.kernel_family = (V==1) ? "xgemv" : ((V==2) ? "xgemv_fast" : ((V==3) ? "xgemv_fast_rot" : ((V==4) ? "xgemv_batched" : ((V==5) ? "xgbmv" : ((V==6) ? "xtrmv" : "xsymv")))));
+  settings.kernel_name = (V==1) ? "Xgemv" : ((V==2) ? "XgemvFast" : ((V==3) ? "XgemvFastRot" : ((V==4) ? "XgemvStridedBatched" : ((V==5) ? "Xgbmv" : ((V==6) ? "Xtrmv" : "Xsymv")))));
+  settings.sources = std::string{(V==5) ? "#define ROUTINE_GBMV\n" : ((V==6) ? "#define ROUTINE_SPMV\n" : ((V==7) ? "#define ROUTINE_SYMV\n" : ""))} +
 #include "../src/kernels/level2/xgemv.opencl"
 #include "../src/kernels/level2/xgemv_fast.opencl"
+#include "../src/kernels/level2/xgemv_batched.opencl"
+#include "../src/kernels/level2/xgbmv.opencl"
+#include "../src/kernels/level2/xtrmv.opencl"
+#include "../src/kernels/level2/xsymv.opencl"
   ;
 
-  // Buffer sizes
-  settings.size_x = args.n;
-  settings.size_y = args.m;
-  settings.size_a = args.m * args.n;
+  // Buffer sizes. The banded version stores 'k' diagonals on both sides of the main diagonal, the
+  // triangular/packed version is tuned for a square symmetric matrix in packed storage. The
+  // symmetric version reads only a triangle of a square matrix and writes the partial results of
+  // each work-group to the temporary buffer, sized for the largest tile.
+  const auto batch_count = (V==4) ? args.batch_count : size_t{1};
+  const auto m = (V==6 || V==7) ? args.n : args.m;
+  const auto a_size = (V==5) ? (2*args.k + 1) * args.n :
+                      ((V==6 || V==7) ? (args.n * (args.n + 1)) / 2 : args.m * args.n);
+  settings.size_x = args.n * batch_count;
+  settings.size_y = m * batch_count;
+  settings.size_a = (V==7) ? args.n * args.n : a_size * batch_count;
+  settings.size_temp = (V==7) ? kXsymvNumGroups * CeilDiv(args.n, size_t{128}) * 128 : size_t{1};
 
-  // Inputs and outputs IDs (X:0, Y:1, A:2, B:3, C:4, temp:5)
-  settings.inputs = {0, 1, 2};
-  settings.outputs = {1};
+  // Inputs and outputs IDs (X:0, Y:1, A:2, B:3, C:4, temp:5). The partial results of the symmetric
+  // version depend on the tile size, so they are summed into Y by its reduction kernel first.
+  settings.inputs = std::vector<size_t>{0, 1, 2};
+  settings.outputs = std::vector<size_t>{1};
+  if (V==7) { settings.epilogue_kernel_name = "XsymvReduce"; }
 
   // Sets the base thread configuration
-  settings.global_size = {args.m};
+  settings.global_size = {m, batch_count};
   settings.global_size_ref = settings.global_size;
-  settings.local_size = {1};
-  settings.local_size_ref = {64};
+  settings.local_size = {1, 1};
+  settings.local_size_ref = {64, 1};
+  if (V==7) {
+    settings.global_size = {kXsymvNumGroups, 1}; // A fixed number of work-groups
+    settings.global_size_ref = {kXsymvNumGroups * 32, 1};
+    settings.local_size_ref = {32, 1};
+  }
 
   // Transforms the thread configuration based on the parameters
   settings.mul_local = {{"WGS"+std::to_string(V)}};
-  settings.div_global = (V==1 || V==2) ? TransformVector{{"WPT"+std::to_string(V)}} : TransformVector{};
+  settings.div_global = (V!=3) ? TransformVector{{"WPT"+std::to_string(V)}} : TransformVector{};
+  if (V==7) { settings.div_global = {}; }
 
   // Sets the tuning parameters and their possible values
   if (V==1) {
@@ -86,9 +126,27 @@ TunerSettings XgemvGetTunerSettings(const int V, const Arguments<T> &args) {
       {"VW"+std::to_string(V), {1, 2, 4, 8}},
     };
   }
+  if (V==4) {
+    settings.parameters = {
+      {"WGS"+std::to_string(V), {16, 32, 64, 128}},
+      {"WPT"+std::to_string(V), {1, 2, 4}},
+    };
+  }
+  if (V==5 || V==6) {
+    settings.parameters = {
+      {"WGS"+std::to_string(V), {16, 32, 64, 128, 256}},
+      {"WPT"+std::to_string(V), {1, 2, 4}},
+    };
+  }
+  if (V==7) {
+    settings.parameters = {
+      {"WGS"+std::to_string(V), {16, 32, 64}},
+      {"WPT"+std::to_string(V), {1, 2}},
+    };
+  }
 
   // Describes how to compute the performance metrics
-  settings.metric_amount = (args.m*args.n + 2*args.m + args.n) * GetBytes(args.precision);
+  settings.metric_amount = batch_count * (a_size + 2*m + args.n) * GetBytes(args.precision);
   settings.performance_unit = "GB/s";
 
   return settings;
@@ -111,7 +169,19 @@ std::vector<Constraint> XgemvSetConstraints(const int V) {
 }
 template <typename T>
 LocalMemSizeInfo XgemvComputeLocalMemSize(const int V) {
-  if (V == 1 || V == 2) {
+  if (V == 5) {
+    return { [] (std::vector<size_t>) -> size_t { return 0; }, {} };
+  }
+  if (V == 7) {
+    return {
+        [] (std::vector<size_t> v) -> size_t {
+            const auto tile = v[0] * v[1];
+            return GetBytes(PrecisionValue<T>()) * (tile * (tile + 1) + 2 * tile);
+        },
+        {"WGS7", "WPT7"}
+    };
+  }
+  if (V == 1 || V == 2 || V == 4 || V == 6) {
     return {
         [V] (std::vector<size_t> v) -> size_t {
             return GetBytes(PrecisionValue<T>()) * v[0];
@@ -130,25 +200,125 @@ LocalMemSizeInfo XgemvComputeLocalMemSize(const int V) {
 // Sets the kernel's arguments
 template <typename T>
 void XgemvSetArguments(const int V, Kernel &kernel, const Arguments<T> &args, std::vector<Buffer<T>>& buffers) {
+  if (V==4) {
+    kernel.SetArgument(0, static_cast<int>(args.m));
+    kernel.SetArgument(1, static_cast<int>(args.n));
+    kernel.SetArgument(2, GetRealArg(args.alpha));
+    kernel.SetArgument(3, GetRealArg(args.beta));
+    kernel.SetArgument(4, 0); // Not rotated
+    kernel.SetArgument(5, buffers[2]()); // 2 == A matrix
+    kernel.SetArgument(6, 0);
+    kernel.SetArgument(7, static_cast<int>(args.m));
+    kernel.SetArgument(8, static_cast<int>(args.m * args.n));
+    kernel.SetArgument(9, buffers[0]()); // 0 == X vector
+    kernel.SetArgument(10, 0);
+    kernel.SetArgument(11, 1);
+    kernel.SetArgument(12, static_cast<int>(args.n));
+    kernel.SetArgument(13, buffers[1]()); // 1 == Y vector
+    kernel.SetArgument(14, 0);
+    kernel.SetArgument(15, 1);
+    kernel.SetArgument(16, static_cast<int>(args.m));
+    kernel.SetArgument(17, 0); // Conjugate transpose
+    return;
+  }
+  if (V==5) {
+    kernel.SetArgument(0, static_cast<int>(args.m));
+    kernel.SetArgument(1, static_cast<int>(args.n));
+    kernel.SetArgument(2, GetRealArg(args.alpha));
+    kernel.SetArgument(3, 0);
+    kernel.SetArgument(4, GetRealArg(args.beta));
+    kernel.SetArgument(5, 0);
+    kernel.SetArgument(6, 0); // Not rotated
+    kernel.SetArgument(7, buffers[2]()); // 2 == A matrix
+    kernel.SetArgument(8, 0);
+    kernel.SetArgument(9, static_cast<int>(2*args.k + 1));
+    kernel.SetArgument(10, buffers[0]()); // 0 == X vector
+    kernel.SetArgument(11, 0);
+    kernel.SetArgument(12, 1);
+    kernel.SetArgument(13, buffers[1]()); // 1 == Y vector
+    kernel.SetArgument(14, 0);
+    kernel.SetArgument(15, 1);
+    kernel.SetArgument(16, 0); // Conjugate transpose
+    kernel.SetArgument(17, 0); // Additional parameter
+    kernel.SetArgument(18, static_cast<int>(args.k)); // Banded 'kl'
+    kernel.SetArgument(19, static_cast<int>(args.k)); // Banded 'ku'
+    kernel.SetArgument(20, static_cast<int>(args.k)); // Band below the diagonal
+    kernel.SetArgument(21, static_cast<int>(args.k)); // Band above the diagonal
+    return;
+  }
+  if (V==6) {
+    kernel.SetArgument(0, static_cast<int>(args.n));
+    kernel.SetArgument(1, GetRealArg(args.alpha));
+    kernel.SetArgument(2, 0);
+    kernel.SetArgument(3, GetRealArg(args.beta));
+    kernel.SetArgument(4, 0);
+    kernel.SetArgument(5, 0); // Not rotated
+    kernel.SetArgument(6, buffers[2]()); // 2 == A matrix
+    kernel.SetArgument(7, 0);
+    kernel.SetArgument(8, static_cast<int>(args.n));
+    kernel.SetArgument(9, buffers[0]()); // 0 == X vector
+    kernel.SetArgument(10, 0);
+    kernel.SetArgument(11, 1);
+    kernel.SetArgument(12, buffers[1]()); // 1 == Y vector
+    kernel.SetArgument(13, 0);
+    kernel.SetArgument(14, 1);
+    kernel.SetArgument(15, 0); // Conjugate transpose
+    kernel.SetArgument(16, 1); // Upper triangle
+    kernel.SetArgument(17, 0); // Banded 'kl'
+    kernel.SetArgument(18, 0); // Banded 'ku'
+    kernel.SetArgument(19, static_cast<int>(args.n)); // Band below the diagonal
+    kernel.SetArgument(20, static_cast<int>(args.n)); // Band above the diagonal
+    kernel.SetArgument(21, 0); // Not in-place
+    kernel.SetArgument(22, buffers[0]()); // Flags, not used
+    return;
+  }
+  if (V==7 && kernel.GetFunctionName() == "XsymvReduce") {
+    kernel.SetArgument(0, static_cast<int>(args.n));
+    kernel.SetArgument(1, static_cast<int>(kXsymvNumGroups));
+    kernel.SetArgument(2, GetRealArg(args.alpha));
+    kernel.SetArgument(3, 0);
+    kernel.SetArgument(4, GetRealArg(args.beta));
+    kernel.SetArgument(5, 0);
+    kernel.SetArgument(6, buffers[5]()); // 5 == temporary buffer
+    kernel.SetArgument(7, buffers[1]()); // 1 == Y vector
+    kernel.SetArgument(8, 0);
+    kernel.SetArgument(9, 1);
+    return;
+  }
+  if (V==7) {
+    kernel.SetArgument(0, static_cast<int>(args.n));
+    kernel.SetArgument(1, 0); // Not rotated
+    kernel.SetArgument(2, buffers[2]()); // 2 == A matrix
+    kernel.SetArgument(3, 0);
+    kernel.SetArgument(4, static_cast<int>(args.n));
+    kernel.SetArgument(5, buffers[0]()); // 0 == X vector
+    kernel.SetArgument(6, 0);
+    kernel.SetArgument(7, 1);
+    kernel.SetArgument(8, buffers[5]()); // 5 == temporary buffer
+    kernel.SetArgument(9, 0); // Lower triangle
+    return;
+  }
   auto a_rotated = (V==3) ? 1 : 0;
   kernel.SetArgument(0, static_cast<int>(args.m));
   kernel.SetArgument(1, static_cast<int>(args.n));
   kernel.SetArgument(2, GetRealArg(args.alpha));
-  kernel.SetArgument(3, GetRealArg(args.beta));
-  kernel.SetArgument(4, a_rotated);
-  kernel.SetArgument(5, buffers[2]()); // 2 == A matrix
-  kernel.SetArgument(6, 0);
-  kernel.SetArgument(7, static_cast<int>(args.m));
-  kernel.SetArgument(8, buffers[0]()); // 0 == X vector
-  kernel.SetArgument(9, 0);
-  kernel.SetArgument(10, 1);
-  kernel.SetArgument(11, buffers[1]()); // 1 == Y vector
-  kernel.SetArgument(12, 0);
-  kernel.SetArgument(13, 1);
-  kernel.SetArgument(14, 0); // Conjugate transpose
-  kernel.SetArgument(15, 0); // Additional parameter
-  kernel.SetArgument(16, 0); // Banded 'kl'
-  kernel.SetArgument(17, 0); // Banded 'ku'
+  kernel.SetArgument(3, 0);
+  kernel.SetArgument(4, GetRealArg(args.beta));
+  kernel.SetArgument(5, 0);
+  kernel.SetArgument(6, a_rotated);
+  kernel.SetArgument(7, buffers[2]()); // 2 == A matrix
+  kernel.SetArgument(8, 0);
+  kernel.SetArgument(9, static_cast<int>(args.m));
+  kernel.SetArgument(10, buffers[0]()); // 0 == X vector
+  kernel.SetArgument(11, 0);
+  kernel.SetArgument(12, 1);
+  kernel.SetArgument(13, buffers[1]()); // 1 == Y vector
+  kernel.SetArgument(14, 0);
+  kernel.SetArgument(15, 1);
+  kernel.SetArgument(16, 0); // Conjugate transpose
+  kernel.SetArgument(17, 0); // Additional parameter
+  kernel.SetArgument(18, 0); // Banded 'kl'
+  kernel.SetArgument(19, 0); // Banded 'ku'
 }
 
 // =================================================================================================
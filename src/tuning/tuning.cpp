@@ -242,6 +242,8 @@ void Tuner(int argc, char* argv[], const int V,
                                     global, local);
     printf("      - |");
     if (time_ms == -1.0) { throw std::runtime_error("Error in reference implementation"); }
+    RunEpilogueKernel(V, settings, program, queue, device, args, device_buffers, SetArguments,
+                      global, local);
 
     // Saves the result
     for (const auto id : settings.outputs) {
@@ -313,6 +315,8 @@ void Tuner(int argc, char* argv[], const int V,
         printf(" <-- skipping\n");
         continue;
       }
+      RunEpilogueKernel(V, settings, program, queue, device, args, device_buffers, SetArguments,
+                        global, local);
 
       // Compares the results
       auto l2_error = 0.0;
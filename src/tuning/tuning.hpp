@@ -75,6 +75,11 @@ struct TunerSettings {
   std::vector<size_t> inputs = {};
   std::vector<size_t> outputs = {};
 
+  // An optional kernel from the same sources, run once (untimed) after the tuned kernel to compute
+  // the outputs, e.g. to sum partial results. It is launched with the first dimension of the thread
+  // configuration of the tuned kernel, and its arguments are set through 'SetArguments' as well.
+  std::string epilogue_kernel_name = "";
+
   // Sets the base thread configuration
   std::vector<size_t> global_size = {};
   std::vector<size_t> global_size_ref = {};
@@ -119,6 +124,19 @@ using ComputeLocalMemSizeFunc = std::function<LocalMemSizeInfo(const int V)>;
 template <typename T>
 using SetArgumentsFunc = std::function<void(const int V, Kernel &kernel, const Arguments<T> &args, std::vector<Buffer<T>>& buffers)>;
 
+// Runs the epilogue kernel of the settings (if any) once after the tuned kernel has completed
+template <typename T>
+void RunEpilogueKernel(const int V, const TunerSettings &settings,
+                       const std::shared_ptr<Program> &program, Queue &queue, const Device &device,
+                       const Arguments<T> &args, std::vector<Buffer<T>>& buffers,
+                       SetArgumentsFunc<T> SetArguments,
+                       const std::vector<size_t> &global, const std::vector<size_t> &local) {
+  if (settings.epilogue_kernel_name.empty()) { return; }
+  auto kernel = Kernel(program, settings.epilogue_kernel_name);
+  SetArguments(V, kernel, args, buffers);
+  RunKernelTimed(1, kernel, queue, device, {global[0]}, {local[0]});
+}
+
 // Function to get command-line argument, set-up the input buffers, configure the tuner, and collect
 // the results. Used for all types of kernel families. Note that this is a header-only function so
 // that it is automatically compiled for the various kernels (given as the 'C' template argument).
@@ -295,6 +295,8 @@ StatusCode TunerAPI(Queue &queue, const Arguments<T> &args, const int V,
     const auto time_ms = TimeKernel(args.num_runs, kernel, queue, device,
                                     settings.global_size_ref, settings.local_size_ref, true);
     if (time_ms == -1.0) { throw std::runtime_error("Error in reference implementation"); }
+    RunEpilogueKernel(V, settings, program, queue, device, args, device_buffers, SetArguments,
+                      settings.global_size_ref, settings.local_size_ref);
 
     // Saves the result
     for (const auto id : settings.outputs) {
@@ -344,6 +346,8 @@ StatusCode TunerAPI(Queue &queue, const Arguments<T> &args, const int V,
       if (time_ms == -1.0) {
         continue;
       }
+      RunEpilogueKernel(V, settings, program, queue, device, args, device_buffers, SetArguments,
+                        global, local);
 
       // Compares the results
       auto l2_error = 0.0;
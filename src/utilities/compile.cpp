@@ -27,7 +27,8 @@ std::shared_ptr<Program> CompileFromSource(
                           const Device& device, const Context& context,
                           std::vector<std::string>& options,
                           const size_t run_preprocessor, // 0: platform dependent, 1: always, 2: never
-                          const bool silent) {
+                          const bool silent,
+                          const bool device_scalars) {
   auto header_string = std::string{""};
 
   header_string += "#define PRECISION " + ToString(static_cast<int>(precision)) + "\n";
@@ -35,6 +36,11 @@ std::shared_ptr<Program> CompileFromSource(
   // Adds the name of the routine as a define
   header_string += "#define ROUTINE_" + routine_name + "\n";
 
+  // Scalar arguments are read from device memory by the kernels of routines in device-scalar mode
+  if (device_scalars) {
+    header_string += "#define DEVICE_SCALARS 1\n";
+  }
+
   // Not all OpenCL compilers support the 'inline' keyword. The keyword is only used for devices on
   // which it is known to work with all OpenCL platforms.
   if (device.IsNVIDIA() || device.IsARM()) {
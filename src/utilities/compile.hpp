@@ -30,7 +30,8 @@ std::shared_ptr<Program> CompileFromSource(
                           const Device& device, const Context& context,
                           std::vector<std::string>& options,
                           const size_t run_preprocessor, // 0: platform dependent, 1: always, 2: never
-                          const bool silent = false);
+                          const bool silent = false,
+                          const bool device_scalars = false);
 
 // =================================================================================================
 } // namespace clblast
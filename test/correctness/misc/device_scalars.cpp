@@ -0,0 +1,184 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the device-scalar versions of AXPY, SCAL, AXPBY, GEMV and GEMM.
+// The results are compared against those of the regular functions with alpha and beta passed from
+// the host. Alpha is stored at a non-zero offset and beta at offset zero to test both cases.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <iostream>
+#include <functional>
+#include <algorithm>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunDeviceScalarsTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto m = GetArgument(arguments, help, kArgM, size_t{67});
+  const auto n = GetArgument(arguments, help, kArgN, size_t{53});
+  const auto k = GetArgument(arguments, help, kArgK, size_t{71});
+  const auto alpha = GetArgument(arguments, help, kArgAlpha, GetScalar<T>());
+  const auto beta  = GetArgument(arguments, help, kArgBeta, GetScalar<T>());
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  if (!PrecisionSupported<T>(device)) { return 0; }
+
+  // Populate host data with some example data
+  auto host_a = std::vector<T>(m * k);
+  auto host_b = std::vector<T>(k * n);
+  auto host_c = std::vector<T>(m * n);
+  auto host_x = std::vector<T>(std::max(m, n));
+  auto host_y = std::vector<T>(std::max(m, n));
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  PopulateVector(host_c, mt, dist);
+  PopulateVector(host_x, mt, dist);
+  PopulateVector(host_y, mt, dist);
+
+  // Copy the data to the device. The scalars are stored as {0, alpha} and {beta}.
+  auto device_a = Buffer<T>(context, host_a.size());
+  auto device_b = Buffer<T>(context, host_b.size());
+  auto device_x = Buffer<T>(context, host_x.size());
+  auto device_alpha = Buffer<T>(context, 2);
+  auto device_beta = Buffer<T>(context, 1);
+  device_a.Write(queue, host_a.size(), host_a);
+  device_b.Write(queue, host_b.size(), host_b);
+  device_x.Write(queue, host_x.size(), host_x);
+  device_alpha.Write(queue, 2, std::vector<T>{ConstantZero<T>(), alpha});
+  device_beta.Write(queue, 1, std::vector<T>{beta});
+  const auto alpha_offset = size_t{1};
+  const auto beta_offset = size_t{0};
+
+  // Runs a routine twice on a copy of the given output data, once with host scalars and once with
+  // device scalars, and compares the results
+  const auto run_test = [&](const std::string &name, const std::vector<T> &host_output,
+                            const std::function<StatusCode(Buffer<T>&)> &run_host,
+                            const std::function<StatusCode(Buffer<T>&)> &run_device) {
+    auto output_host = Buffer<T>(context, host_output.size());
+    auto output_device = Buffer<T>(context, host_output.size());
+    output_host.Write(queue, host_output.size(), host_output);
+    output_device.Write(queue, host_output.size(), host_output);
+    auto status = run_host(output_host);
+    if (status != StatusCode::kSuccess) {
+      fprintf(stdout, "    %s with host scalars failed with status %d\n", name.c_str(), static_cast<int>(status));
+      errors++; return;
+    }
+    status = run_device(output_device);
+    if (status != StatusCode::kSuccess) {
+      fprintf(stdout, "    %s with device scalars failed with status %d\n", name.c_str(), static_cast<int>(status));
+      errors++; return;
+    }
+    auto reference = std::vector<T>(host_output.size());
+    auto result = std::vector<T>(host_output.size());
+    output_host.Read(queue, reference.size(), reference);
+    output_device.Read(queue, result.size(), result);
+    auto num_errors = size_t{0};
+    for (auto i = size_t{0}; i < result.size(); ++i) {
+      if (!TestSimilarity(reference[i], result[i])) { num_errors++; }
+    }
+    if (num_errors > 0) { errors++; } else { passed++; }
+  };
+
+  fprintf(stdout, "* Testing the device-scalar routines for '%s'\n", routine_name.c_str());
+  run_test("AXPY", host_y,
+    [&](Buffer<T> &y) { return Axpy(n, alpha, device_x(), 0, 1, y(), 0, 1, &queue_plain); },
+    [&](Buffer<T> &y) {
+      return AxpyDevice<T>(n, device_alpha(), alpha_offset, device_x(), 0, 1, y(), 0, 1, &queue_plain);
+    });
+  run_test("SCAL", host_x,
+    [&](Buffer<T> &x) { return Scal(n, alpha, x(), 0, 1, &queue_plain); },
+    [&](Buffer<T> &x) {
+      return ScalDevice<T>(n, device_alpha(), alpha_offset, x(), 0, 1, &queue_plain);
+    });
+  run_test("AXPBY", host_y,
+    [&](Buffer<T> &y) { return Axpby(n, alpha, device_x(), 0, 1, beta, y(), 0, 1, &queue_plain); },
+    [&](Buffer<T> &y) {
+      return AxpbyDevice<T>(n, device_alpha(), alpha_offset, device_x(), 0, 1,
+                            device_beta(), beta_offset, y(), 0, 1, &queue_plain);
+    });
+  for (const auto a_transpose : {Transpose::kNo, Transpose::kYes}) {
+    run_test("GEMV", host_y,
+      [&](Buffer<T> &y) {
+        return Gemv(Layout::kColMajor, a_transpose, m, n, alpha, device_a(), 0, m,
+                    device_x(), 0, 1, beta, y(), 0, 1, &queue_plain);
+      },
+      [&](Buffer<T> &y) {
+        return GemvDevice<T>(Layout::kColMajor, a_transpose, m, n, device_alpha(), alpha_offset,
+                             device_a(), 0, m, device_x(), 0, 1,
+                             device_beta(), beta_offset, y(), 0, 1, &queue_plain);
+      });
+  }
+  for (const auto layout : {Layout::kRowMajor, Layout::kColMajor}) {
+    const auto a_ld = (layout == Layout::kRowMajor) ? k : m;
+    const auto b_ld = (layout == Layout::kRowMajor) ? n : k;
+    const auto c_ld = (layout == Layout::kRowMajor) ? n : m;
+    run_test("GEMM", host_c,
+      [&](Buffer<T> &c) {
+        return Gemm(layout, Transpose::kNo, Transpose::kNo, m, n, k, alpha,
+                    device_a(), 0, a_ld, device_b(), 0, b_ld, beta, c(), 0, c_ld, &queue_plain);
+      },
+      [&](Buffer<T> &c) {
+        return GemmDevice<T>(layout, Transpose::kNo, Transpose::kNo, m, n, k,
+                             device_alpha(), alpha_offset, device_a(), 0, a_ld,
+                             device_b(), 0, b_ld, device_beta(), beta_offset,
+                             c(), 0, c_ld, &queue_plain);
+      });
+  }
+
+  // Tests that a too small scalar buffer is detected
+  auto y_check = Buffer<T>(context, host_y.size());
+  const auto status = AxpyDevice<T>(n, device_beta(), 1, device_x(), 0, 1, y_check(), 0, 1,
+                                    &queue_plain);
+  if (status != StatusCode::kInsufficientMemoryScalar) { errors++; } else { passed++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunDeviceScalarsTests<float>(argc, argv, false, "SDEVICESCALARS");
+  errors += clblast::RunDeviceScalarsTests<clblast::float2>(argc, argv, true, "CDEVICESCALARS");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,140 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the 3M algorithm of complex GEMM. The size from which on it is
+// used is overridden, such that the results for small matrices can be compared against those of
+// the regular complex GEMM kernels.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <iostream>
+#include <limits>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemm3mTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto m = GetArgument(arguments, help, kArgM, size_t{67});
+  const auto n = GetArgument(arguments, help, kArgN, size_t{53});
+  const auto k = GetArgument(arguments, help, kArgK, size_t{71});
+  const auto alpha = GetArgument(arguments, help, kArgAlpha, GetScalar<T>());
+  const auto beta  = GetArgument(arguments, help, kArgBeta, GetScalar<T>());
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  if (!PrecisionSupported<T>(device)) { return 0; }
+
+  // Sets the minimum size of the 3M algorithm: either always or never used for these tests
+  const auto set_3m_min_size = [&](const size_t min_size) {
+    return OverrideParameters(device(), "Gemm3m", PrecisionValue<T>(),
+                              {{"XGEMM_3M_MIN_SIZE", min_size}});
+  };
+
+  // Populate host matrices with some example data, large enough for any layout/transpose
+  auto host_a = std::vector<T>(m * k);
+  auto host_b = std::vector<T>(n * k);
+  auto host_c = std::vector<T>(m * n);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  PopulateVector(host_c, mt, dist);
+
+  // Copy the matrices to the device
+  auto device_a = Buffer<T>(context, host_a.size());
+  auto device_b = Buffer<T>(context, host_b.size());
+  auto device_c = Buffer<T>(context, host_c.size());
+  auto device_c_3m = Buffer<T>(context, host_c.size());
+  device_a.Write(queue, host_a.size(), host_a);
+  device_b.Write(queue, host_b.size(), host_b);
+
+  // Loops over the layout and transpose options, including the conjugate transpose
+  fprintf(stdout, "* Testing the 3M algorithm for '%s'\n", routine_name.c_str());
+  for (const auto layout : {Layout::kRowMajor, Layout::kColMajor}) {
+    for (const auto a_transpose : {Transpose::kNo, Transpose::kYes, Transpose::kConjugate}) {
+      for (const auto b_transpose : {Transpose::kNo, Transpose::kYes, Transpose::kConjugate}) {
+        const auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                               (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+        const auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                               (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+        const auto a_ld = (a_rotated) ? k : m;
+        const auto b_ld = (b_rotated) ? n : k;
+        const auto c_ld = (layout == Layout::kRowMajor) ? n : m;
+
+        // Computes the reference result with the regular complex GEMM
+        if (set_3m_min_size(std::numeric_limits<size_t>::max()) != StatusCode::kSuccess) { return 1; }
+        device_c.Write(queue, host_c.size(), host_c);
+        auto status = Gemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                           device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                           device_c(), 0, c_ld, &queue_plain);
+        if (status != StatusCode::kSuccess) { errors++; continue; }
+        auto reference = std::vector<T>(host_c.size());
+        device_c.Read(queue, reference.size(), reference);
+
+        // Runs the same GEMM again, but now with the 3M algorithm
+        if (set_3m_min_size(1) != StatusCode::kSuccess) { return 1; }
+        device_c_3m.Write(queue, host_c.size(), host_c);
+        status = Gemm(layout, a_transpose, b_transpose, m, n, k, alpha,
+                      device_a(), 0, a_ld, device_b(), 0, b_ld, beta,
+                      device_c_3m(), 0, c_ld, &queue_plain);
+        if (status != StatusCode::kSuccess) { errors++; continue; }
+        auto result = std::vector<T>(host_c.size());
+        device_c_3m.Read(queue, result.size(), result);
+
+        // Compares the results
+        auto num_errors = size_t{0};
+        for (auto i = size_t{0}; i < result.size(); ++i) {
+          if (!TestSimilarity(reference[i], result[i])) { num_errors++; }
+        }
+        if (num_errors > 0) { errors++; } else { passed++; }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemm3mTests<clblast::float2>(argc, argv, false, "CGEMM");
+  errors += clblast::RunGemm3mTests<clblast::double2>(argc, argv, true, "ZGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
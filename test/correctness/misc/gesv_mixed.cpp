@@ -0,0 +1,138 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the GesvMixed function. A well-conditioned system is solved
+// through refinement of a single-precision factorization, after which A * X is compared against B.
+// It also tests the fall-back to double precision, using a system which overflows in single
+// precision.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGesvMixedTests(int argc, char *argv[], const bool silent,
+                         const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto n = GetArgument(arguments, help, kArgN, size_t{67});
+  const auto nrhs = size_t{3};
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  if (!PrecisionSupported<T>(device)) { return 0; }
+
+  // Creates a diagonally dominant matrix A and a matrix B
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  auto host_a = std::vector<T>(n * n);
+  auto host_b = std::vector<T>(n * nrhs);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  for (auto i = size_t{0}; i < n; ++i) {
+    host_a[i*n + i] += static_cast<T>(static_cast<double>(n));
+  }
+
+  // Loops over the layouts and over a normal and an overflowing (scaled) system
+  fprintf(stdout, "* Testing GesvMixed for '%s'\n", routine_name.c_str());
+  for (const auto layout : {Layout::kRowMajor, Layout::kColMajor}) {
+    for (const auto scale : {1.0, 1.0e300}) {
+      const auto b_ld = (layout == Layout::kColMajor) ? n : nrhs;
+      const auto b_index = [&](const size_t row, const size_t col) {
+        return (layout == Layout::kColMajor) ? col*b_ld + row : row*b_ld + col;
+      };
+      auto scaled_a = host_a;
+      auto scaled_b = host_b;
+      for (auto &value: scaled_a) { value *= scale; }
+      for (auto &value: scaled_b) { value *= scale; }
+
+      // Solves the system
+      auto device_a = Buffer<T>(context, n * n);
+      auto device_b = Buffer<T>(context, n * nrhs);
+      auto device_x = Buffer<T>(context, n * nrhs);
+      auto device_ipiv = Buffer<int>(context, n);
+      auto device_info = Buffer<int>(context, 1);
+      auto device_iter = Buffer<int>(context, 1);
+      device_a.Write(queue, scaled_a.size(), scaled_a);
+      device_b.Write(queue, scaled_b.size(), scaled_b);
+      auto status = GesvMixed<T>(layout, n, nrhs, device_a(), 0, n, device_ipiv(), 0,
+                                 device_b(), 0, b_ld, device_x(), 0, b_ld,
+                                 device_info(), 0, device_iter(), 0, &queue_plain);
+      if (status != StatusCode::kSuccess) { errors++; continue; }
+      auto host_x = std::vector<T>(n * nrhs);
+      auto info = std::vector<int>(1);
+      auto iter = std::vector<int>(1);
+      device_x.Read(queue, host_x.size(), host_x);
+      device_info.Read(queue, info.size(), info);
+      device_iter.Read(queue, iter.size(), iter);
+
+      // The normal system should converge, the scaled one should fall back because of an overflow
+      const auto expected_fallback = (scale != 1.0);
+      if (info[0] != 0 || (expected_fallback && iter[0] != -2) ||
+          (!expected_fallback && iter[0] < 0)) { errors++; continue; }
+
+      // Computes A * X and compares it against B
+      auto num_errors = size_t{0};
+      for (auto i = size_t{0}; i < n; ++i) {
+        for (auto j = size_t{0}; j < nrhs; ++j) {
+          auto value = T{0};
+          for (auto l = size_t{0}; l < n; ++l) {
+            const auto a_value = (layout == Layout::kColMajor) ? scaled_a[l*n + i] :
+                                                                 scaled_a[i*n + l];
+            value += a_value * host_x[b_index(l, j)];
+          }
+          if (!TestSimilarity(scaled_b[b_index(i, j)] / scale, value / scale)) { num_errors++; }
+        }
+      }
+      if (num_errors > 0) { errors++; } else { passed++; }
+    }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGesvMixedTests<double>(argc, argv, false, "DGESVMIXED");
+  errors += clblast::RunGesvMixedTests<clblast::double2>(argc, argv, true, "ZGESVMIXED");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
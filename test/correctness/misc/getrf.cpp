@@ -0,0 +1,154 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the Getrf function. Square, tall, and wide matrices are factored
+// with a small panel width such that multiple panels are used, after which the product of the
+// factors with the row interchanges applied is compared against the original matrix. It also tests
+// that a singular matrix is reported through the 'info' value.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <iostream>
+#include <algorithm>
+#include <utility>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGetrfTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  if (!PrecisionSupported<T>(device)) { return 0; }
+
+  // Makes sure that multiple panels are used, including a partial one
+  const auto override_status = OverrideParameters(device(), "Getrf", PrecisionValue<T>(),
+                                                  {{"GETRF_NB", 16}, {"GETRF_WGS", 64}});
+  if (override_status != StatusCode::kSuccess) { return 1; }
+
+  // Loops over the matrix shapes and layouts
+  fprintf(stdout, "* Testing Getrf for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  const auto sizes = std::vector<std::pair<size_t, size_t>>{{67, 67}, {80, 45}, {45, 80}};
+  for (const auto &size : sizes) {
+    const auto m = size.first;
+    const auto n = size.second;
+    const auto min_mn = std::min(m, n);
+    for (const auto layout : {Layout::kRowMajor, Layout::kColMajor}) {
+      const auto a_ld = (layout == Layout::kColMajor) ? m : n;
+      const auto index = [&](const size_t row, const size_t col) {
+        return (layout == Layout::kColMajor) ? col*a_ld + row : row*a_ld + col;
+      };
+
+      // Populates and factors the matrix
+      auto host_a = std::vector<T>(m * n);
+      PopulateVector(host_a, mt, dist);
+      auto device_a = Buffer<T>(context, host_a.size());
+      auto device_ipiv = Buffer<int>(context, min_mn);
+      auto device_info = Buffer<int>(context, 1);
+      device_a.Write(queue, host_a.size(), host_a);
+      auto status = Getrf<T>(layout, m, n, device_a(), 0, a_ld, device_ipiv(), 0,
+                             device_info(), 0, &queue_plain);
+      if (status != StatusCode::kSuccess) { errors++; continue; }
+      auto result = std::vector<T>(m * n);
+      auto ipiv = std::vector<int>(min_mn);
+      auto info = std::vector<int>(1);
+      device_a.Read(queue, result.size(), result);
+      device_ipiv.Read(queue, ipiv.size(), ipiv);
+      device_info.Read(queue, info.size(), info);
+      if (info[0] != 0) { errors++; continue; }
+
+      // Multiplies the factors L * U
+      auto product = std::vector<T>(m * n);
+      for (auto i = size_t{0}; i < m; ++i) {
+        for (auto j = size_t{0}; j < n; ++j) {
+          auto value = T{0};
+          for (auto l = size_t{0}; l <= std::min(i, j) && l < min_mn; ++l) {
+            const auto l_value = (i == l) ? T{1} : result[index(i, l)];
+            value += l_value * result[index(l, j)];
+          }
+          product[index(i, j)] = value;
+        }
+      }
+
+      // Undoes the row interchanges in reverse order and compares against the original matrix
+      for (auto k = min_mn; k > 0; --k) {
+        const auto pivot_row = static_cast<size_t>(ipiv[k - 1] - 1);
+        for (auto j = size_t{0}; j < n; ++j) {
+          std::swap(product[index(k - 1, j)], product[index(pivot_row, j)]);
+        }
+      }
+      auto num_errors = size_t{0};
+      for (auto i = size_t{0}; i < m * n; ++i) {
+        if (!TestSimilarity(host_a[i], product[i])) { num_errors++; }
+      }
+      if (num_errors > 0) { errors++; } else { passed++; }
+    }
+  }
+
+  // Tests that a matrix with a zero column 'fail' is reported as singular
+  const auto n = size_t{67};
+  const auto fail = n / 2;
+  auto host_singular = std::vector<T>(n * n);
+  PopulateVector(host_singular, mt, dist);
+  for (auto i = size_t{0}; i < n; ++i) { host_singular[fail*n + i] = T{0}; }
+  auto device_a = Buffer<T>(context, host_singular.size());
+  auto device_ipiv = Buffer<int>(context, n);
+  auto device_info = Buffer<int>(context, 1);
+  device_a.Write(queue, host_singular.size(), host_singular);
+  const auto status = Getrf<T>(Layout::kColMajor, n, n, device_a(), 0, n, device_ipiv(), 0,
+                               device_info(), 0, &queue_plain);
+  auto info = std::vector<int>(1);
+  device_info.Read(queue, info.size(), info);
+  if (status != StatusCode::kSuccess || info[0] != static_cast<int>(fail + 1)) { errors++; }
+  else { passed++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGetrfTests<float>(argc, argv, false, "SGETRF");
+  errors += clblast::RunGetrfTests<clblast::float2>(argc, argv, true, "CGETRF");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,178 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the fallback paths of routines which are selected through a
+// database parameter (e.g. TRSV_SINGLE_LAUNCH, TRMV_IN_PLACE or REDUCTION_SINGLE_LAUNCH). The
+// parameter is set through OverrideParameters to enable and to disable the default path, and the
+// two results are compared.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <functional>
+#include <random>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Runs a routine once with the database parameter set to 1 and once with it set to 0. Both runs
+// start from the same output data, and their results are compared afterwards.
+template <typename T>
+bool TestFallback(const Device &device, Queue &queue, const std::string &kernel_name,
+                  const std::string &parameter_name, const std::vector<T> &host_output,
+                  Buffer<T> &device_output, const std::function<StatusCode()> &routine) {
+  auto results = std::vector<std::vector<T>>();
+  for (const auto parameter_value : {size_t{1}, size_t{0}}) {
+    const auto override_setting = std::unordered_map<std::string,size_t>{
+      {parameter_name, parameter_value}
+    };
+    auto status = OverrideParameters(device(), kernel_name, PrecisionValue<T>(), override_setting);
+    if (status != StatusCode::kSuccess) {
+      fprintf(stdout, "    OverrideParameters failed with status %d\n", static_cast<int>(status));
+      return false;
+    }
+    device_output.Write(queue, host_output.size(), host_output);
+    status = routine();
+    if (status != StatusCode::kSuccess) {
+      fprintf(stdout, "    %s=%zu: routine failed with status %d\n", parameter_name.c_str(),
+              parameter_value, static_cast<int>(status));
+      return false;
+    }
+    auto result = std::vector<T>(host_output.size());
+    device_output.Read(queue, result.size(), result);
+    results.push_back(result);
+  }
+  auto num_errors = size_t{0};
+  for (auto i = size_t{0}; i < host_output.size(); ++i) {
+    if (!TestSimilarity(results[0][i], results[1][i])) { num_errors++; }
+  }
+  if (num_errors > 0) {
+    fprintf(stdout, "    %s=0: %zu error(s)\n", parameter_name.c_str(), num_errors);
+    return false;
+  }
+  return true;
+}
+
+// =================================================================================================
+
+template <typename T>
+size_t RunFallbackTests(int argc, char *argv[], const bool silent,
+                        const std::string &precision_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto n = GetArgument(arguments, help, kArgN, size_t{293});
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  if (!PrecisionSupported<T>(device)) { return 0; }
+
+  // Populates host data with some example data. The diagonal of the matrix is made dominant, such
+  // that the triangular systems are well-conditioned.
+  auto host_a = std::vector<T>(n * n);
+  auto host_x = std::vector<T>(n);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_x, mt, dist);
+  for (auto i = size_t{0}; i < n; ++i) { host_a[i*n + i] += static_cast<T>(n); }
+
+  // Copies the data to the device
+  auto device_a = Buffer<T>(context, host_a.size());
+  auto device_x = Buffer<T>(context, host_x.size());
+  device_a.Write(queue, host_a.size(), host_a);
+
+  // TRSV with the substitution split over multiple kernel launches instead of a single launch
+  fprintf(stdout, "* Testing TRSV_SINGLE_LAUNCH=0 for '%s'\n", precision_name.c_str());
+  for (const auto layout : {Layout::kRowMajor, Layout::kColMajor}) {
+    for (const auto triangle : {Triangle::kUpper, Triangle::kLower}) {
+      for (const auto a_transpose : {Transpose::kNo, Transpose::kYes}) {
+        const auto trsv = [&]() {
+          return Trsv<T>(layout, triangle, a_transpose, Diagonal::kNonUnit, n,
+                         device_a(), 0, n, device_x(), 0, 1, &queue_plain);
+        };
+        if (TestFallback<T>(device, queue, "TrsvSingleLaunch", "TRSV_SINGLE_LAUNCH",
+                            host_x, device_x, trsv)) { passed++; } else { errors++; }
+      }
+    }
+  }
+
+  // TRMV reading from a copy of X instead of computing the result in-place. The in-place kernel is
+  // run multiple times, which also tests that it leaves its synchronisation flags zeroed.
+  fprintf(stdout, "* Testing TRMV_IN_PLACE=0 for '%s'\n", precision_name.c_str());
+  for (const auto layout : {Layout::kRowMajor, Layout::kColMajor}) {
+    for (const auto triangle : {Triangle::kUpper, Triangle::kLower}) {
+      for (const auto a_transpose : {Transpose::kNo, Transpose::kYes}) {
+        const auto trmv = [&]() {
+          return Trmv<T>(layout, triangle, a_transpose, Diagonal::kNonUnit, n,
+                         device_a(), 0, n, device_x(), 0, 1, &queue_plain);
+        };
+        if (TestFallback<T>(device, queue, "TrmvInPlace", "TRMV_IN_PLACE",
+                            host_x, device_x, trmv)) { passed++; } else { errors++; }
+      }
+    }
+  }
+
+  // DOT, NRM2 and ASUM with a separate epilogue kernel instead of a single launch, computed over
+  // the entire matrix. As above, the single-launch kernels run multiple times using one counter.
+  fprintf(stdout, "* Testing REDUCTION_SINGLE_LAUNCH=0 for '%s'\n", precision_name.c_str());
+  const auto size = host_a.size();
+  auto host_result = std::vector<T>(1);
+  auto device_result = Buffer<T>(context, 1);
+  const auto dot = [&]() {
+    return Dot<T>(size, device_result(), 0, device_a(), 0, 1, device_a(), 0, 1, &queue_plain);
+  };
+  const auto nrm2 = [&]() {
+    return Nrm2<T>(size, device_result(), 0, device_a(), 0, 1, &queue_plain);
+  };
+  const auto asum = [&]() {
+    return Asum<T>(size, device_result(), 0, device_a(), 0, 1, &queue_plain);
+  };
+  for (const auto &reduction : std::vector<std::function<StatusCode()>>{dot, nrm2, asum}) {
+    if (TestFallback<T>(device, queue, "ReductionSingleLaunch", "REDUCTION_SINGLE_LAUNCH",
+                        host_result, device_result, reduction)) { passed++; } else { errors++; }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunFallbackTests<float>(argc, argv, false, "single");
+  errors += clblast::RunFallbackTests<double>(argc, argv, true, "double");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,151 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the Potrf function. A positive-definite matrix is factored with a
+// small panel width such that multiple panels are used, after which the product of the factors is
+// compared against the original matrix. It also tests that a matrix which is not positive definite
+// is reported through the 'info' value.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <iostream>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Complex conjugate of a host value
+float Conjugate(const float value) { return value; }
+float2 Conjugate(const float2 value) { return std::conj(value); }
+
+template <typename T>
+size_t RunPotrfTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto n = GetArgument(arguments, help, kArgN, size_t{67});
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  if (!PrecisionSupported<T>(device)) { return 0; }
+
+  // Makes sure that multiple panels are used, including a partial one
+  const auto override_status = OverrideParameters(device(), "Potrf", PrecisionValue<T>(),
+                                                  {{"POTRF_NB", 16}});
+  if (override_status != StatusCode::kSuccess) { return 1; }
+
+  // Creates a positive-definite matrix A = B * B^H + n * I (stored as a full column-major matrix)
+  auto host_b = std::vector<T>(n * n);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_b, mt, dist);
+  auto host_a = std::vector<T>(n * n);
+  for (auto i = size_t{0}; i < n; ++i) {
+    for (auto j = size_t{0}; j < n; ++j) {
+      auto value = (i == j) ? static_cast<T>(static_cast<float>(n)) : T{0};
+      for (auto l = size_t{0}; l < n; ++l) {
+        value += host_b[l*n + i] * Conjugate(host_b[l*n + j]);
+      }
+      host_a[j*n + i] = value;
+    }
+  }
+  auto device_a = Buffer<T>(context, host_a.size());
+  auto device_info = Buffer<int>(context, 1);
+
+  // Loops over the layout and triangle options
+  fprintf(stdout, "* Testing Potrf for '%s'\n", routine_name.c_str());
+  for (const auto layout : {Layout::kRowMajor, Layout::kColMajor}) {
+    for (const auto triangle : {Triangle::kUpper, Triangle::kLower}) {
+      const auto index = [&](const size_t row, const size_t col) {
+        return (layout == Layout::kColMajor) ? col*n + row : row*n + col;
+      };
+
+      // Stores the matrix in the requested layout and factors it
+      auto host_stored = std::vector<T>(n * n);
+      for (auto i = size_t{0}; i < n; ++i) {
+        for (auto j = size_t{0}; j < n; ++j) { host_stored[index(i, j)] = host_a[j*n + i]; }
+      }
+      device_a.Write(queue, host_stored.size(), host_stored);
+      auto status = Potrf<T>(layout, triangle, n, device_a(), 0, n, device_info(), 0, &queue_plain);
+      if (status != StatusCode::kSuccess) { errors++; continue; }
+      auto result = std::vector<T>(n * n);
+      auto info = std::vector<int>(1);
+      device_a.Read(queue, result.size(), result);
+      device_info.Read(queue, info.size(), info);
+      if (info[0] != 0) { errors++; continue; }
+
+      // Multiplies the factors L * L^H or U^H * U and compares against the original matrix
+      const auto factor = [&](const size_t row, const size_t col) {
+        const auto in_triangle = (triangle == Triangle::kLower) ? (row >= col) : (row <= col);
+        return (in_triangle) ? result[index(row, col)] : T{0};
+      };
+      auto num_errors = size_t{0};
+      for (auto i = size_t{0}; i < n; ++i) {
+        for (auto j = size_t{0}; j < n; ++j) {
+          auto value = T{0};
+          for (auto l = size_t{0}; l < n; ++l) {
+            value += (triangle == Triangle::kLower) ? factor(i, l) * Conjugate(factor(j, l)) :
+                                                      Conjugate(factor(l, i)) * factor(l, j);
+          }
+          if (!TestSimilarity(host_a[j*n + i], value)) { num_errors++; }
+        }
+      }
+      if (num_errors > 0) { errors++; } else { passed++; }
+    }
+  }
+
+  // Tests that a matrix which is not positive definite in column 'fail' is reported as such
+  const auto fail = n / 2;
+  auto host_diagonal = std::vector<T>(n * n, T{0});
+  for (auto i = size_t{0}; i < n; ++i) { host_diagonal[i*n + i] = (i == fail) ? T{-1} : T{1}; }
+  device_a.Write(queue, host_diagonal.size(), host_diagonal);
+  const auto status = Potrf<T>(Layout::kColMajor, Triangle::kLower, n, device_a(), 0, n,
+                               device_info(), 0, &queue_plain);
+  auto info = std::vector<int>(1);
+  device_info.Read(queue, info.size(), info);
+  if (status != StatusCode::kSuccess || info[0] != static_cast<int>(fail + 1)) { errors++; }
+  else { passed++; }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunPotrfTests<float>(argc, argv, false, "SPOTRF");
+  errors += clblast::RunPotrfTests<clblast::float2>(argc, argv, true, "CPOTRF");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,137 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the Rotg and Rotmg functions, which construct (modified) Givens
+// rotations on the device. Since these operate on scalars only, they are not part of the regular
+// level-1 tests. Instead, the results are verified through the defining properties of the
+// rotations: the rotation applied to the input zeroes its second component and preserves its
+// (weighted) norm.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <iostream>
+#include <cmath>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunRotgTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  constexpr auto kNumTests = size_t{16};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  auto queue_plain = queue();
+  if (!PrecisionSupported<T>(device)) { return 0; }
+
+  // Device buffers for the scalars and for the modified rotation parameters
+  auto device_s = std::vector<Buffer<T>>();
+  for (auto i = size_t{0}; i < 4; ++i) { device_s.push_back(Buffer<T>(context, 1)); }
+  auto device_param = Buffer<T>(context, 5);
+  auto host_s = std::vector<std::vector<T>>(4, std::vector<T>(1));
+  auto host_param = std::vector<T>(5);
+
+  // Tests Rotg with random values, including the special cases of zeros
+  fprintf(stdout, "* Testing Rotg and Rotmg for '%s'\n", routine_name.c_str());
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  for (auto test = size_t{0}; test < kNumTests; ++test) {
+    const auto a = (test == 0) ? T{0} : static_cast<T>(dist(mt));
+    const auto b = (test == 1) ? T{0} : static_cast<T>(dist(mt));
+    device_s[0].Write(queue, 1, &a);
+    device_s[1].Write(queue, 1, &b);
+    const auto status = Rotg<T>(device_s[0](), 0, device_s[1](), 0, device_s[2](), 0,
+                                device_s[3](), 0, &queue_plain);
+    if (status != StatusCode::kSuccess) { errors++; continue; }
+    for (auto i = size_t{0}; i < 4; ++i) { device_s[i].Read(queue, 1, host_s[i]); }
+    const auto r = host_s[0][0];
+    const auto c = host_s[2][0];
+    const auto s = host_s[3][0];
+
+    // Verifies that [c s; -s c] * [a; b] equals [r; 0] and that the rotation is orthogonal
+    if (TestSimilarity(c * a + s * b, r) && TestSimilarity(c * b - s * a, T{0}) &&
+        TestSimilarity(c * c + s * s, T{1})) { passed++; } else { errors++; }
+  }
+
+  // Tests Rotmg with random values: positive weights and random vector components
+  std::uniform_real_distribution<double> weights(0.1, 2.0);
+  for (auto test = size_t{0}; test < kNumTests; ++test) {
+    const auto d1 = static_cast<T>(weights(mt));
+    const auto d2 = static_cast<T>(weights(mt));
+    const auto x1 = static_cast<T>(dist(mt));
+    const auto y1 = (test == 0) ? T{0} : static_cast<T>(dist(mt));
+    device_s[0].Write(queue, 1, &d1);
+    device_s[1].Write(queue, 1, &d2);
+    device_s[2].Write(queue, 1, &x1);
+    device_s[3].Write(queue, 1, &y1);
+    const auto status = Rotmg<T>(device_s[0](), 0, device_s[1](), 0, device_s[2](), 0,
+                                 device_s[3](), 0, device_param(), 0, &queue_plain);
+    if (status != StatusCode::kSuccess) { errors++; continue; }
+    for (auto i = size_t{0}; i < 3; ++i) { device_s[i].Read(queue, 1, host_s[i]); }
+    device_param.Read(queue, host_param.size(), host_param);
+    const auto flag = host_param[0];
+
+    // Nothing to do in case y1 is zero, in which case H is the identity
+    if (flag == T{-2}) {
+      if (y1 == T{0}) { passed++; } else { errors++; }
+      continue;
+    }
+
+    // Reconstructs H and verifies that it zeroes the second component and preserves the norm
+    const auto h11 = (flag == T{0}) ? T{1} : host_param[1];
+    const auto h21 = (flag > T{0}) ? T{-1} : host_param[2];
+    const auto h12 = (flag > T{0}) ? T{1} : host_param[3];
+    const auto h22 = (flag == T{0}) ? T{1} : host_param[4];
+    const auto new_d1 = host_s[0][0];
+    const auto new_x1 = host_s[2][0];
+    const auto norm = d1 * x1 * x1 + d2 * y1 * y1;
+    if (TestSimilarity(h11 * x1 + h12 * y1, new_x1) && TestSimilarity(h21 * x1 + h22 * y1, T{0}) &&
+        TestSimilarity(new_d1 * new_x1 * new_x1, norm)) { passed++; } else { errors++; }
+  }
+
+  // Prints and returns the statistics
+  std::cout << "    " << passed << " test(s) passed" << std::endl;
+  std::cout << "    " << errors << " test(s) failed" << std::endl;
+  std::cout << std::endl;
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunRotgTests<float>(argc, argv, false, "SROTG");
+  errors += clblast::RunRotgTests<double>(argc, argv, true, "DROTG");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
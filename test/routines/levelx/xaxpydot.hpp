@@ -0,0 +1,184 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xaxpydot routine. Examples of
+// such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XAXPYDOT_H_
+#define CLBLAST_TEST_ROUTINES_XAXPYDOT_H_
+
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXaxpydot {
+ public:
+
+  // Although it is a non-BLAS routine, it can still be tested against AXPY followed by DOT
+  static size_t BLASLevel() { return 1; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgN,
+            kArgXInc, kArgYInc,
+            kArgXOffset, kArgYOffset, kArgDotOffset,
+            kArgAlpha};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufVecX, kBufVecY, kBufMatC, kBufScalar}; }
+  static std::vector<std::string> BuffersOut() { return {kBufVecY, kBufScalar}; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeX(const Arguments<T> &args) {
+    return args.n * args.x_inc + args.x_offset;
+  }
+  static size_t GetSizeY(const Arguments<T> &args) {
+    return args.n * args.y_inc + args.y_offset;
+  }
+  static size_t GetSizeC(const Arguments<T> &args) { // used for 'vector z'
+    return args.n;
+  }
+  static size_t GetSizeDot(const Arguments<T> &args) {
+    return 1 + args.dot_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args, Queue&) {
+    args.x_size = GetSizeX(args);
+    args.y_size = GetSizeY(args);
+    args.c_size = GetSizeC(args); // used for 'vector z'
+    args.scalar_size = GetSizeDot(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDB(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T> &) { return 1; } // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &) { return {}; } // N/A for this routine
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T>&, Queue&, const int, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&) {} // N/A for this routine
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    #ifdef OPENCL_API
+      auto queue_plain = queue();
+      auto event = cl_event{};
+      auto status = Axpydot(args.n,
+                            buffers.scalar(), args.dot_offset, args.alpha,
+                            buffers.x_vec(), args.x_offset, args.x_inc,
+                            buffers.y_vec(), args.y_offset, args.y_inc,
+                            buffers.c_mat(), 0, 1, // used for 'vector z'
+                            &queue_plain, &event);
+      if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    #elif CUDA_API
+      auto status = Axpydot(args.n,
+                            buffers.scalar(), args.dot_offset, args.alpha,
+                            buffers.x_vec(), args.x_offset, args.x_inc,
+                            buffers.y_vec(), args.y_offset, args.y_inc,
+                            buffers.c_mat(), 0, 1, // used for 'vector z'
+                            queue.GetContext()(), queue.GetDevice()());
+      cuStreamSynchronize(queue());
+    #endif
+    return status;
+  }
+
+  // Describes how to run the clBLAS routine (for correctness/performance comparison)
+  #ifdef CLBLAST_REF_CLBLAS
+    static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+      auto queue_plain = queue();
+      auto event = cl_event{};
+      auto status = clblasXaxpy(args.n, args.alpha,
+                                buffers.x_vec, args.x_offset, args.x_inc,
+                                buffers.y_vec, args.y_offset, args.y_inc,
+                                1, &queue_plain, 0, nullptr, &event);
+      clWaitForEvents(1, &event);
+      if (static_cast<StatusCode>(status) != StatusCode::kSuccess) {
+        return static_cast<StatusCode>(status);
+      }
+      status = clblasXdot<T>(args.n,
+                             buffers.scalar, args.dot_offset,
+                             buffers.y_vec, args.y_offset, args.y_inc,
+                             buffers.c_mat, 0, 1,
+                             1, &queue_plain, 0, nullptr, &event);
+      clWaitForEvents(1, &event);
+      return static_cast<StatusCode>(status);
+    }
+  #endif
+
+  // Describes how to run the CPU BLAS routine (for correctness/performance comparison)
+  #ifdef CLBLAST_REF_CBLAS
+    static StatusCode RunReference2(const Arguments<T> &args, BuffersHost<T> &buffers_host, Queue &) {
+      cblasXaxpy(args.n, args.alpha,
+                 buffers_host.x_vec, args.x_offset, args.x_inc,
+                 buffers_host.y_vec, args.y_offset, args.y_inc);
+      cblasXdot(args.n,
+                buffers_host.scalar, args.dot_offset,
+                buffers_host.y_vec, args.y_offset, args.y_inc,
+                buffers_host.c_mat, 0, 1);
+      return StatusCode::kSuccess;
+    }
+  #endif
+
+  // Describes how to run the cuBLAS routine (for correctness/performance comparison)
+  #ifdef CLBLAST_REF_CUBLAS
+    static StatusCode RunReference3(const Arguments<T> &args, BuffersCUDA<T> &buffers, Queue &) {
+      auto handle = reinterpret_cast<cublasHandle_t>(args.cublas_handle);
+      auto status = cublasXaxpy(handle, args.n, args.alpha,
+                                buffers.x_vec, args.x_offset, args.x_inc,
+                                buffers.y_vec, args.y_offset, args.y_inc);
+      if (status != CUBLAS_STATUS_SUCCESS) { return StatusCode::kUnknownError; }
+      status = cublasXdot(handle, args.n,
+                          buffers.scalar, args.dot_offset,
+                          buffers.y_vec, args.y_offset, args.y_inc,
+                          buffers.c_mat, 0, 1);
+      if (status == CUBLAS_STATUS_SUCCESS) { return StatusCode::kSuccess; } else { return StatusCode::kUnknownError; }
+    }
+  #endif
+
+  // Describes how to download the results of the computation: vector y followed by the result
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.y_size + args.scalar_size, static_cast<T>(0));
+    buffers.y_vec.Read(queue, args.y_size, &result[0]);
+    buffers.scalar.Read(queue, args.scalar_size, &result[args.y_size]);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &args) { return args.n; }
+  static size_t ResultID2(const Arguments<T> &) { return 2; } // y_vec and the dot result
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t id2) {
+    return (id2 == 0) ? id1*args.y_inc + args.y_offset : args.y_size + args.dot_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    return 4 * args.n;
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    return ((4 * args.n) + 1) * sizeof(T);
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XAXPYDOT_H_
+#endif
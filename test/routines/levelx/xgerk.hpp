@@ -0,0 +1,193 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xgerk routine. Examples of
+// such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XGERK_H_
+#define CLBLAST_TEST_ROUTINES_XGERK_H_
+
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+// The m-by-k matrix X and the n-by-k matrix Y are passed as the B and C matrices of the arguments.
+template <typename T>
+class TestXgerk {
+ public:
+
+  // Although it is a non-BLAS routine, it can still be tested against level-3 routines
+  static size_t BLASLevel() { return 3; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgM, kArgN, kArgK,
+            kArgLayout,
+            kArgALeadDim, kArgBLeadDim, kArgCLeadDim,
+            kArgAOffset, kArgBOffset, kArgCOffset,
+            kArgAlpha};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufMatA, kBufMatB, kBufMatC}; }
+  static std::vector<std::string> BuffersOut() { return {kBufMatA}; }
+
+  // Describes how to obtain the sizes of the buffers. In both layouts the columns of X and Y are the
+  // vectors of the individual rank-1 updates.
+  static size_t GetSizeA(const Arguments<T> &args) {
+    auto a_rotated = (args.layout == Layout::kRowMajor);
+    auto a_two = (a_rotated) ? args.m : args.n;
+    return a_two * args.a_ld + args.a_offset;
+  }
+  static size_t GetSizeB(const Arguments<T> &args) {
+    auto b_rotated = (args.layout == Layout::kRowMajor);
+    auto b_two = (b_rotated) ? args.m : args.k;
+    return b_two * args.b_ld + args.b_offset;
+  }
+  static size_t GetSizeC(const Arguments<T> &args) {
+    auto c_rotated = (args.layout == Layout::kRowMajor);
+    auto c_two = (c_rotated) ? args.n : args.k;
+    return c_two * args.c_ld + args.c_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args, Queue&) {
+    args.a_size = GetSizeA(args);
+    args.b_size = GetSizeB(args);
+    args.c_size = GetSizeC(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &args) { return args.n; }
+  static size_t DefaultLDB(const Arguments<T> &args) { return args.k; }
+  static size_t DefaultLDC(const Arguments<T> &args) { return args.k; }
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &) { return {}; } // N/A for this routine
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T>&, Queue&, const int, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&) {} // N/A for this routine
+
+  // Describes how to run the CLBlast routine. This routine is only available in the OpenCL API.
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = Gerk(args.layout,
+                       args.m, args.n, args.k, args.alpha,
+                       buffers.b_mat(), args.b_offset, args.b_ld,
+                       buffers.c_mat(), args.c_offset, args.c_ld,
+                       buffers.a_mat(), args.a_offset, args.a_ld,
+                       &queue_plain, &event);
+    if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    return status;
+  }
+
+  // Helpers for the references, which perform the k rank-1 updates one by one with GER: the offset
+  // of the i-th vector of X or Y and the increment within such a vector
+  static size_t VectorOffset(const Arguments<T> &args, const size_t offset, const size_t ld,
+                             const size_t i) {
+    return offset + ((args.layout == Layout::kRowMajor) ? i : i * ld);
+  }
+  static size_t VectorInc(const Arguments<T> &args, const size_t ld) {
+    return (args.layout == Layout::kRowMajor) ? ld : 1;
+  }
+
+  // Describes how to run the clBLAS routine (for correctness/performance comparison)
+  #ifdef CLBLAST_REF_CLBLAS
+    static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+      auto queue_plain = queue();
+      for (auto i = size_t{0}; i < args.k; ++i) {
+        auto event = cl_event{};
+        auto status = clblasXger(convertToCLBLAS(args.layout),
+                                 args.m, args.n, args.alpha,
+                                 buffers.b_mat, VectorOffset(args, args.b_offset, args.b_ld, i),
+                                 VectorInc(args, args.b_ld),
+                                 buffers.c_mat, VectorOffset(args, args.c_offset, args.c_ld, i),
+                                 VectorInc(args, args.c_ld),
+                                 buffers.a_mat, args.a_offset, args.a_ld,
+                                 1, &queue_plain, 0, nullptr, &event);
+        clWaitForEvents(1, &event);
+        if (static_cast<StatusCode>(status) != StatusCode::kSuccess) {
+          return static_cast<StatusCode>(status);
+        }
+      }
+      return StatusCode::kSuccess;
+    }
+  #endif
+
+  // Describes how to run the CPU BLAS routine (for correctness/performance comparison)
+  #ifdef CLBLAST_REF_CBLAS
+    static StatusCode RunReference2(const Arguments<T> &args, BuffersHost<T> &buffers_host, Queue &) {
+      for (auto i = size_t{0}; i < args.k; ++i) {
+        cblasXger(convertToCBLAS(args.layout),
+                  args.m, args.n, args.alpha,
+                  buffers_host.b_mat, VectorOffset(args, args.b_offset, args.b_ld, i),
+                  VectorInc(args, args.b_ld),
+                  buffers_host.c_mat, VectorOffset(args, args.c_offset, args.c_ld, i),
+                  VectorInc(args, args.c_ld),
+                  buffers_host.a_mat, args.a_offset, args.a_ld);
+      }
+      return StatusCode::kSuccess;
+    }
+  #endif
+
+  // Describes how to run the cuBLAS routine (for correctness/performance comparison)
+  #ifdef CLBLAST_REF_CUBLAS
+    static StatusCode RunReference3(const Arguments<T> &args, BuffersCUDA<T> &buffers, Queue &) {
+      for (auto i = size_t{0}; i < args.k; ++i) {
+        auto status = cublasXger(reinterpret_cast<cublasHandle_t>(args.cublas_handle), args.layout,
+                                 args.m, args.n, args.alpha,
+                                 buffers.b_mat, VectorOffset(args, args.b_offset, args.b_ld, i),
+                                 VectorInc(args, args.b_ld),
+                                 buffers.c_mat, VectorOffset(args, args.c_offset, args.c_ld, i),
+                                 VectorInc(args, args.c_ld),
+                                 buffers.a_mat, args.a_offset, args.a_ld);
+        if (status != CUBLAS_STATUS_SUCCESS) { return StatusCode::kUnknownError; }
+      }
+      return StatusCode::kSuccess;
+    }
+  #endif
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.a_size, static_cast<T>(0));
+    buffers.a_mat.Read(queue, args.a_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &args) { return args.m; }
+  static size_t ResultID2(const Arguments<T> &args) { return args.n; }
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t id2) {
+    return (args.layout == Layout::kRowMajor) ?
+           id1*args.a_ld + id2 + args.a_offset:
+           id2*args.a_ld + id1 + args.a_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    return 2 * args.m * args.n * args.k;
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    return (2*args.m*args.n + args.m*args.k + args.n*args.k) * sizeof(T);
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XGERK_H_
+#endif